@@ -40,8 +40,9 @@ const AuxDataType *tbcxAuxNewForeach = NULL;
 static _Atomic int tbcxTypesLoaded   = 0;
 
 /* tbcxHostIsLE: host byte-order flag (1 = little-endian, 0 = big-endian).
- * Written once during TbcxInitTypes, thereafter read from hot paths
- * (W_U32, W_U64, R_U32, R_U64) without locking.
+ * Written once during TbcxInitTypes.  The codecs in tbcx.h read it only
+ * on targets whose byte order is unknown at compile time (TBCX_HOST_LE
+ * undefined), without locking.
  * Declared _Atomic (C11) to guarantee visibility across threads on
  * weakly-ordered architectures (ARM, POWER). */
 _Atomic int        tbcxHostIsLE      = 1;
@@ -59,12 +60,22 @@ TCL_DECLARE_MUTEX(tbcxTypeMutex);
 /* Forward declarations for command implementations in other TUs */
 extern int                Tbcx_SaveObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
 extern int                Tbcx_LoadObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+extern int                Tbcx_LoadBytesObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
 extern int                Tbcx_DumpObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+extern int                Tbcx_VerifyObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+extern int                Tbcx_InfoObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
 extern int                Tbcx_GcObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
-
-/* Internal init helper — called exactly once from TbcxInitTypes() under
+extern int                Tbcx_InternObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+extern int                Tbcx_BundleObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+extern int                Tbcx_CacheObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+extern int                Tbcx_PrefetchObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+extern int                Tbcx_PreloadObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+extern int                Tbcx_TrustObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+
+/* Internal init helpers — called exactly once from TbcxInitTypes() under
  * tbcxTypeMutex.  Not exposed in tbcx.h to prevent unprotected calls. */
 extern void               TbcxSaveInitOpcodesLocked(void);
+extern void               TbcxLoadInitOpsLocked(void);
 
 /* ==========================================================================
  * Forward Declarations
@@ -80,7 +91,7 @@ DLLEXPORT int             tbcx_SafeInit(Tcl_Interp *ip);
 DLLEXPORT int             tbcx_Init(Tcl_Interp *interp);
 
 /* ==========================================================================
- * Explicit ApplyShim purge
+ * Explicit ApplyShim and intern-table purge
  *
  * Synopsis:   tbcx::gc
  * Arguments:  none
@@ -95,6 +106,7 @@ int                       Tbcx_GcObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp,
         return TCL_ERROR;
     }
     TbcxApplyShimPurgeAll(interp);
+    TbcxInternPurge(interp);
     return TCL_OK;
 }
 
@@ -230,6 +242,16 @@ static int TbcxInitTypes(Tcl_Interp *interp) {
         }
         return TCL_ERROR;
     }
+#if defined(TBCX_HOST_LE)
+    /* The codecs trust the compile-time byte order; a build that got it
+     * wrong would read and write every fixed-width field swapped. */
+    if (hostLE != TBCX_HOST_LE) {
+        if (interp) {
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx: byte order differs from the build target"));
+        }
+        return TCL_ERROR;
+    }
+#endif
 
     /* ---- Phase 2: Assign globals under the mutex ---- */
     Tcl_MutexLock(&tbcxTypeMutex);
@@ -262,6 +284,8 @@ static int TbcxInitTypes(Tcl_Interp *interp) {
     /* Publish: all type pointer stores above must be visible to any
      * thread that subsequently observes tbcxTypesLoaded == 1. */
     TbcxSaveInitOpcodesLocked();
+    TbcxLoadInitOpsLocked();
+    Tbcx_CrcInit();
     atomic_store_explicit(&tbcxTypesLoaded, 1, memory_order_release);
 
     Tcl_MutexUnlock(&tbcxTypeMutex);
@@ -274,8 +298,11 @@ static int TbcxInitTypes(Tcl_Interp *interp) {
  * Synopsis:   package require tbcx
  * Arguments:  interp — the interpreter to initialize in.
  * Returns:    TCL_OK on success, TCL_ERROR on failure.
- * Side effects: Registers tbcx::save, tbcx::load, tbcx::dump, tbcx::gc
- *               commands and provides package tbcx
+ * Side effects: Registers tbcx::save, tbcx::load, tbcx::loadbytes,
+ *               tbcx::dump, tbcx::verify, tbcx::info, tbcx::gc, tbcx::intern,
+ *               tbcx::bundle, tbcx::cache, tbcx::prefetch,
+ *               tbcx::preload, tbcx::trust commands
+ *               and provides package tbcx
  * Thread:     must be called on the interp-owning thread.  Performs
  *             one-time global type initialization under tbcxTypeMutex;
  *             may call Tcl_EvalObjv for lambda type probing.
@@ -301,7 +328,12 @@ DLLEXPORT int tbcx_Init(Tcl_Interp *interp) {
     }
 
     if (!Tcl_CreateObjCommand2(interp, "tbcx::save", Tbcx_SaveObjCmd, NULL, NULL) || !Tcl_CreateObjCommand2(interp, "tbcx::load", Tbcx_LoadObjCmd, NULL, NULL) ||
-        !Tcl_CreateObjCommand2(interp, "tbcx::dump", Tbcx_DumpObjCmd, NULL, NULL) || !Tcl_CreateObjCommand2(interp, "tbcx::gc", Tbcx_GcObjCmd, NULL, NULL)) {
+        !Tcl_CreateObjCommand2(interp, "tbcx::loadbytes", Tbcx_LoadBytesObjCmd, NULL, NULL) || !Tcl_CreateObjCommand2(interp, "tbcx::dump", Tbcx_DumpObjCmd, NULL, NULL) ||
+        !Tcl_CreateObjCommand2(interp, "tbcx::verify", Tbcx_VerifyObjCmd, NULL, NULL) || !Tcl_CreateObjCommand2(interp, "tbcx::info", Tbcx_InfoObjCmd, NULL, NULL) ||
+        !Tcl_CreateObjCommand2(interp, "tbcx::gc", Tbcx_GcObjCmd, NULL, NULL) || !Tcl_CreateObjCommand2(interp, "tbcx::intern", Tbcx_InternObjCmd, NULL, NULL) ||
+        !Tcl_CreateObjCommand2(interp, "tbcx::bundle", Tbcx_BundleObjCmd, NULL, NULL) || !Tcl_CreateObjCommand2(interp, "tbcx::cache", Tbcx_CacheObjCmd, NULL, NULL) ||
+        !Tcl_CreateObjCommand2(interp, "tbcx::prefetch", Tbcx_PrefetchObjCmd, NULL, NULL) || !Tcl_CreateObjCommand2(interp, "tbcx::preload", Tbcx_PreloadObjCmd, NULL, NULL) ||
+        !Tcl_CreateObjCommand2(interp, "tbcx::trust", Tbcx_TrustObjCmd, NULL, NULL)) {
         Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx: failed to register commands"));
         return TCL_ERROR;
     }
@@ -27,12 +27,65 @@
 #include "tclTomMath.h"
 
 #define TBCX_MAGIC 0x58434254u
-/* TBCX_FORMAT 92u — current on-wire format for Tcl 9.1.
+/* TBCX_FORMAT 93u — current on-wire format for Tcl 9.1.
+ *
+ * v93 extends the v92 header with a flags word, the proc/class/method
+ * counts, and a SECTION DIRECTORY: one (kind, offset, length, crc) entry for
+ * the string table, the top-level block, each proc record, the classes
+ * table and each method record, in stream order.  Offsets are relative to
+ * the first byte after the directory (the "data base"), so the directory's
+ * own size never shifts them.  A sequential reader may ignore the
+ * directory entirely, while a random-access reader (mapped file, byte
+ * array) can seek straight to any section.  crc is the CRC32C of the
+ * section's stored bytes (the frame, when compressed); loaders check it
+ * before decoding (memory readers) or as each section is consumed
+ * (channel readers).
+ *
+ * The header and directory are fixed-width.  Past the data base every
+ * 32-bit field — counts, literal and AuxData tags, LPString lengths,
+ * string refs, local indexes, code and exception offsets — is a VARINT:
+ * unsigned LEB128, 7 bits per byte, low group first, high bit set on all
+ * but the last byte, at most TBCX_VAR_MAX bytes.  64-bit payloads (wide
+ * integers, doubles, jump-table numeric keys) stay fixed little-endian.
+ *
+ * With TBCX_HDR_FL_LZ set (tbcx::save -compress) every section is stored
+ * as a self-contained compressed frame (see TBCX_FRAME_*).  Readers inflate
+ * the frames once, right after the directory, and then decode exactly as
+ * for an uncompressed artifact.
+ *
+ * With TBCX_HDR_FL_NATIVE set (tbcx::save -native) every compiled block is
+ * stored in the order the loader lays out a ByteCode: its shape (code
+ * length, literal, AuxData and exception counts, max stack, local count)
+ * first, then the code bytes and the exception ranges as raw host
+ * ExceptionRange structs, then literals, AuxData entries and local names.
+ * The loader sizes every part of the block from the shape up front and
+ * takes the ranges as they are, without per-field decoding.  Like any
+ * block, it is decoded into descriptors first (the code in place from a
+ * memory image, the ranges copied for alignment) and then copied once into
+ * the ByteCode.  Such artifacts are tagged with the host ABI
+ * (TBCX_HDR_ABI_*) and only decode where the tag matches.
+ *
+ * With TBCX_HDR_FL_DEDUP set some compiled blocks are back-references: a
+ * proc, method or top-level block whose serialized bytes (and namespace)
+ * match an earlier one is stored as a single varint, TBCX_BLOCK_REF_BASE
+ * plus its distance in bytes back to the start of that earlier block.  The
+ * value sits where the block's code length (or -native shape) would and is
+ * above TBCX_MAX_CODE, so it cannot be mistaken for one.  Loaders decode
+ * each referenced block once and clone it for every use.
+ *
+ * The STRING TABLE comes first: a count followed by that many LPStrings,
+ * each distinct string stored once per artifact.  Identifiers that repeat
+ * across records — namespace and class FQNs, proc and method names,
+ * argument specs, lambda argument names, local-variable names — are
+ * written as an index into it (a "string ref"), as are string literals of
+ * at most TBCX_STRTAB_INTERN_MAX bytes (TBCX_LIT_STRREF).  The loader
+ * creates one Tcl_Obj per entry and shares it among every reference.
  *
  * Each proc record and each method record carries an LPString body-source
- * field immediately before its compiled block.  The loader attaches that
- * text as the body Tcl_Obj's string rep (via Tcl_InitStringRep) without
- * touching the ByteCode internal rep.  By default the body source is
+ * field immediately before its compiled block.  The loader reads that text
+ * into a Tcl_Obj and hands its buffer over as the body Tcl_Obj's string rep
+ * without a copy (AdoptStringRep in tbcxload.c), leaving the ByteCode
+ * internal rep untouched.  By default the body source is
  * STRIPPED from the artifact: bodies are stored as "" on the wire and the
  * loader substitutes the diagnostic sentinel TBCX_STRIPPED_SOURCE_SENTINEL,
  * so `info body` returns a loud string instead of silently returning empty.
@@ -53,7 +106,7 @@
  * consumes the front record.  Rewritten stub bodies use the recognizable
  * TBCX_METH_STUB_BODY / TBCX_PROC_MARKER_PFX sentinels so a verbatim
  * (non-literal) body is never patched from a stale same-key record. */
-#define TBCX_FORMAT 92u
+#define TBCX_FORMAT 93u
 
 /* Method visibility scope (method record `scope` u8).  Mirrors the
  * TclOO SCOPE_FLAGS (PUBLIC_METHOD / unexported / TRUE_PRIVATE_METHOD),
@@ -76,6 +129,11 @@
                                             bodies are emitted as "" on the
                                             wire and the loader installs
                                             the diagnostic sentinel. */
+#define TBCX_SAVE_FL_COMPRESS 0x2u       /* frame and compress every
+                                            section (TBCX_HDR_FL_LZ) */
+#define TBCX_SAVE_FL_NATIVE 0x4u         /* store blocks in the host
+                                            ByteCode layout
+                                            (TBCX_HDR_FL_NATIVE) */
 
 /* Diagnostic sentinel installed as body string-rep when the artifact was
  * written without -include-source (the default).  Two-line shape matches
@@ -119,9 +177,9 @@
 
 /* Thread-ownership check for Tcl command entry points.  Always active
  * in all builds (debug and release).  Returns TCL_ERROR with a
- * diagnostic message instead of crashing — use at the four public
- * Tcl commands (save, load, dump, gc) where the caller can handle
- * the error through the normal Tcl result channel.
+ * diagnostic message instead of crashing — use at the entry of every
+ * public Tcl command, where the caller can handle the error through the
+ * normal Tcl result channel.
  *
  * Cost: one pointer comparison + one Tcl_GetCurrentThread() call per
  * command invocation — negligible relative to I/O and compilation. */
@@ -144,6 +202,12 @@
 #define TBCX_LIT_WIDEUINT 8u
 #define TBCX_LIT_LAMBDA_BC 9u
 #define TBCX_LIT_BYTESRC 10u
+#define TBCX_LIT_STRREF 11u /* varint string-table index */
+
+/* String literals up to this many bytes are written as TBCX_LIT_STRREF;
+ * longer ones stay inline (TBCX_LIT_STRING) so one-off text blobs do not
+ * sit in the shared table. */
+#define TBCX_STRTAB_INTERN_MAX 256u
 
 #define TBCX_AUX_JT_STR 0u
 #define TBCX_AUX_JT_NUM 1u
@@ -183,21 +247,91 @@
 #define TBCX_PROC_MARKER_PFX "\x01TBCX"
 #define TBCX_PROC_MARKER_PFX_LEN 5
 
+/* Section directory entry kinds (v93 header). */
+#define TBCX_SEC_TOP 1u     /* top-level compiled block                  */
+#define TBCX_SEC_PROC 2u    /* one proc record (name .. compiled block)  */
+#define TBCX_SEC_CLASSES 3u /* classes table, including its varint count */
+#define TBCX_SEC_METHOD 4u  /* one method record (class .. block)        */
+#define TBCX_SEC_STRINGS 5u /* string table, including its varint count  */
+
+/* Header flags (v93 `flags` word). */
+#define TBCX_HDR_FL_SOURCE 0x1u /* saved with -include-source */
+#define TBCX_HDR_FL_LZ 0x2u     /* sections are compressed frames */
+#define TBCX_HDR_FL_NATIVE 0x4u /* blocks use the host ByteCode layout */
+#define TBCX_HDR_FL_DEDUP 0x8u  /* some blocks are back-references */
+
+/* ABI tag of a TBCX_HDR_FL_NATIVE artifact, kept in bits 8..15 of the
+ * flags word: sizeof(ExceptionRange), plus 0x80 on big-endian hosts. */
+#define TBCX_HDR_ABI_SHIFT 8u
+#define TBCX_HDR_ABI_MASK 0xFF00u
+
+/* Compressed section frame (TBCX_HDR_FL_LZ): u8 codec, u32 raw length
+ * (fixed-width), then the payload — the raw bytes for STORED, an LZ block
+ * (tbcxlz.c) for LZ.  Each section is framed on its own, so the directory
+ * still addresses every section directly; offsets and lengths in it are
+ * those of the frames. */
+#define TBCX_FRAME_STORED 0u
+#define TBCX_FRAME_LZ 1u
+#define TBCX_FRAME_HDR 5u /* codec byte + u32 raw length */
+
+/* Fixed-width header layout: TBCX_HDR_FIXED bytes (magic, format,
+ * tcl_version, u64 codeLenTop, five u32 top-block counts, u32 source path
+ * length), the source path, TBCX_DIR_COUNTS bytes (flags and the four
+ * u32 counts) and numSections entries of TBCX_DIR_ENTRY bytes. */
+#define TBCX_HDR_FIXED 44u
+#define TBCX_DIR_COUNTS 20u
+#define TBCX_DIR_ENTRY 24u
+
+/* Appended-payload trailer: the last TBCX_TRAILER_SIZE bytes of a file
+ * that carries an artifact after other content (a single-file executable):
+ * u64 offset of the artifact from the start of the file, u64 its length,
+ * then the 8 bytes TBCX_TRAILER_MAGIC.  See Tbcx_FindPayload. */
+#define TBCX_TRAILER_SIZE 24u
+#define TBCX_TRAILER_MAGIC "TBCXTAIL"
+
+/* tbcx::trust digests: SHA-256 of an artifact's bytes (tbcxtrust.c). */
+#define TBCX_SHA256_LEN 32
+
+/* Directory entry: wire form is u32 kind, u64 offset, u64 length,
+ * u32 crc (24 bytes). */
+typedef struct TbcxSection {
+    uint32_t kind;   /* TBCX_SEC_* */
+    uint64_t offset; /* relative to the data base */
+    uint64_t length;
+    uint32_t crc;    /* CRC32C of the stored bytes (tbcxcrc.c) */
+} TbcxSection;
+
 typedef struct TbcxHeader {
-    uint32_t magic;       /* "TBCX" */
-    uint32_t format;      /* format version */
-    uint32_t tcl_version; /* mmjjppTT */
-    uint64_t codeLenTop;
-    uint32_t numExceptTop;
-    uint32_t numLitsTop;
-    uint32_t numAuxTop;
-    uint32_t numLocalsTop;
-    uint32_t maxStackTop;
+    uint32_t     magic;       /* "TBCX" */
+    uint32_t     format;      /* format version */
+    uint32_t     tcl_version; /* mmjjppTT */
+    uint64_t     codeLenTop;
+    uint32_t     numExceptTop;
+    uint32_t     numLitsTop;
+    uint32_t     numAuxTop;
+    uint32_t     numLocalsTop;
+    uint32_t     maxStackTop;
     /* Staging fields — NOT serialized as fixed-size.  sourcePath is
      * written/read as an LPString immediately after maxStackTop. */
-    Tcl_Obj *sourcePath;  /* LPString; NULL or empty = no path */
+    Tcl_Obj     *sourcePath;  /* LPString; NULL or empty = no path */
+    uint32_t     flags;       /* TBCX_HDR_FL_* */
+    uint32_t     numProcs;
+    uint32_t     numClasses;
+    uint32_t     numMethods;
+    uint32_t     numSections; /* == 3 + numProcs + numMethods */
+    TbcxSection *sections;    /* owned; release with Tbcx_FreeHeader */
+    uint64_t     dataBase;    /* reader: absolute offset of the data base */
 } TbcxHeader;
 
+/* Loaded string table (TBCX_SEC_STRINGS).  Refcounted because lazily
+ * decoded bodies (tbcx::load -lazy) resolve string refs long after the
+ * load itself returned; each objs[i] holds one reference. */
+typedef struct TbcxStrTab {
+    Tcl_Size  refCount;
+    uint32_t  count;
+    Tcl_Obj **objs;
+} TbcxStrTab;
+
 extern _Atomic int tbcxHostIsLE;
 
 uint32_t           Tbcx_PackTclVersion(void);
@@ -216,9 +350,45 @@ uint32_t           Tbcx_PackTclVersion(void);
 #define TBCX_MAX_PROCS (256u * 1024u)
 #define TBCX_MAX_CLASSES (256u * 1024u)
 #define TBCX_MAX_METHODS (256u * 1024u)
+#define TBCX_MAX_STRINGS (4u * 1024u * 1024u)
+#define TBCX_VAR_MAX 5u /* longest varint encoding of a 32-bit value */
+/* First varint of a back-referenced block (TBCX_HDR_FL_DEDUP): this base
+ * plus the distance to the block it repeats. */
+#define TBCX_BLOCK_REF_BASE (TBCX_MAX_CODE + 1u)
+/* Largest artifact held in memory whole — slurped from a channel for
+ * -lazy, or inflated from a compressed artifact (the saver's cap). */
+#define TBCX_MAX_IMAGE (256u * 1024u * 1024u)
 
 #define TBCX_BUFSIZE (64u * 1024u)
 
+/* Process-wide artifact cache (tbcxcache.c).  Files modified less than
+ * TBCX_CACHE_SETTLE seconds ago are never cached: a rewrite in place within
+ * the file system's timestamp granularity could otherwise keep the same
+ * identity.  Least recently used entries go once the images held exceed
+ * TBCX_CACHE_MAX_BYTES. */
+#define TBCX_CACHE_SETTLE 2
+#define TBCX_CACHE_MAX_BYTES (64u * 1024u * 1024u)
+
+/* Files whose operands a load validated are remembered by identity, up to
+ * TBCX_CHECKED_MAX of them (Tbcx_FileChecked). */
+#define TBCX_CHECKED_MAX 4096
+
+/* tbcx::intern holds at most TBCX_INTERN_MAX literals; a full table drops
+ * those no loaded code uses before it takes another. */
+#define TBCX_INTERN_MAX 65536
+
+/* Bundle file (tbcx::bundle, tbcxbundle.c): many artifacts in one file.
+ * A fixed header — u32 magic, u32 version, u32 member count, u32 reserved
+ * (0), u64 index length — is followed by the index, one entry per member:
+ * LPString name, LPString source path, u64 offset from the start of the
+ * file and u64 length.  Members are complete artifacts, each starting on
+ * a TBCX_BUNDLE_ALIGN boundary.  Fixed fields are little-endian. */
+#define TBCX_BUNDLE_MAGIC 0x42584254u /* "TBXB" */
+#define TBCX_BUNDLE_VERSION 1u
+#define TBCX_BUNDLE_HDR 24u
+#define TBCX_BUNDLE_ALIGN 8u
+#define TBCX_MAX_BUNDLE_MEMBERS 65536u
+
 /* Hardened Tcl object accessors.
  *
  * Tcl string/bytearray accessors can return NULL on corrupted or
@@ -390,21 +560,100 @@ extern const AuxDataType *tbcxAuxNewForeach;
  * ========================================================================== */
 
 typedef struct TbcxIn {
-    Tcl_Interp   *interp;
-    Tcl_Channel   chan;
-    int           err;
-    unsigned char buf[TBCX_BUFSIZE];
-    Tcl_Size      bufPos;  /* next byte to consume */
-    Tcl_Size      bufFill; /* valid bytes in buf */
+    Tcl_Interp          *interp;
+    Tcl_Channel          chan; /* NULL when reading from a memory span */
+    int                  err;
+    /* Memory-span source (see Tbcx_R_InitMem).  When mem is non-NULL every
+     * read is served straight from [mem, mem + memLen) with a bounds check;
+     * chan and buf are unused. */
+    const unsigned char *mem;
+    size_t               memLen;
+    size_t               memPos;  /* next byte to consume */
+    unsigned char        buf[TBCX_BUFSIZE];
+    Tcl_Size             bufPos;  /* next byte to consume */
+    Tcl_Size             bufFill; /* valid bytes in buf */
+    uint64_t             chanPos; /* bytes pulled from chan so far */
+    TbcxStrTab          *strs;    /* string table for string refs (borrowed) */
+    /* Running section checksum for channel readers (Tbcx_R_VerifySections):
+     * crc covers buf[crcPos .. bufPos) plus whatever earlier refills folded
+     * in since the last Tbcx_R_CrcMark. */
+    int                  crcOn;
+    uint32_t             crc;
+    Tcl_Size             crcPos;
+    struct TbcxArena    *arena;   /* block decode scratch (borrowed; see R_Arena) */
+    int                  native;    /* blocks use the -native layout */
+    uint32_t             nativeAbi; /* their ABI tag (TBCX_HDR_ABI_*) */
+    int                  dedup;     /* blocks may be back-references */
+    struct TbcxBlockTab *blocks;    /* their decoded targets (borrowed) */
+    int                  verified;  /* sections already checked (cached image) */
+    int                  trusted;   /* registered with tbcx::trust: skip shape checks */
+    int                  checked;   /* operands validated by an earlier load (cache memo) */
+    const unsigned char *trustHash; /* the artifact's digest if known (cache memo) */
+    Tcl_HashTable       *intern;    /* tbcx::intern table, NULL when off */
+    const char          *errMsg;    /* first error, when interp is NULL */
+    char                 errBuf[128];
+    struct TbcxParDecode *par;      /* tbcx::load -threads workers, or NULL */
 } TbcxIn;
 
+/* Blocks decoded for TBCX_HDR_FL_DEDUP back-references, keyed by image
+ * offset; each use gets a clone.  Zero-initialize; the table is set up on
+ * first use and released with Tbcx_BlockTabFree. */
+typedef struct TbcxBlockTab {
+    Tcl_HashTable ht; /* ONE_WORD_KEYS: offset -> TbcxSharedBlock* */
+    int           init;
+} TbcxBlockTab;
+
+/* Read-only mapping of a regular file (Tbcx_MapFile).  base/len describe
+ * the whole file; the view stays valid until Tbcx_UnmapFile. */
+typedef struct TbcxMap {
+    const unsigned char *base;
+    size_t               len;
+} TbcxMap;
+
+/* Identity of an artifact file: a change to any field means the file is
+ * not the one that was read.  No padding: it is also a hash key. */
+typedef struct TbcxFileId {
+    unsigned long long dev;
+    unsigned long long ino;
+    long long          mtime;
+    long long          ctime;
+    unsigned long long size;
+} TbcxFileId;
+
+/* A verified artifact image in the process-wide cache (Tbcx_CacheGet),
+ * shared read-only by every interp and thread.  Always a complete
+ * uncompressed artifact: the file mapping itself (or the artifact appended
+ * to it), or for -compress the inflated form with a rewritten directory.  Freed with the last
+ * reference (Tbcx_CacheRelease). */
+typedef struct TbcxCached {
+    atomic_size_t        refCount; /* the cache's own, plus one per user */
+    const unsigned char *base;
+    size_t               len;
+    TbcxMap              map;      /* base lies inside map when not inflated */
+    unsigned char       *owned;    /* the inflated image otherwise */
+    TbcxFileId           id;
+    int                  hashed;   /* trustHash is set (Tbcx_TrustMayMatch held at fill) */
+    unsigned char        trustHash[TBCX_SHA256_LEN]; /* of the file's artifact bytes */
+    atomic_int           checked;  /* operands validated (Tbcx_FileChecked) */
+    Tcl_HashEntry       *entry;    /* NULL once evicted */
+    struct TbcxCached   *prev;     /* LRU list, most recent first */
+    struct TbcxCached   *next;
+} TbcxCached;
+
 typedef struct {
-    Tcl_Interp   *interp;
-    Tcl_Channel   chan;
-    int           err;
-    unsigned char buf[TBCX_BUFSIZE];
-    Tcl_Size      bufPos;     /* next free position in buf */
-    uint64_t      totalBytes; /* total bytes written (buf flushes + current bufPos) */
+    Tcl_Interp    *interp;
+    Tcl_Channel    chan; /* NULL when writing to memory */
+    int            err;
+    /* Memory sink (see Tbcx_W_InitMem).  When toMem is set each flush
+     * appends buf to the growable mem buffer instead of the channel. */
+    int            toMem;
+    unsigned char *mem;
+    size_t         memLen;
+    size_t         memCap;
+    unsigned char  buf[TBCX_BUFSIZE];
+    Tcl_Size       bufPos;     /* next free position in buf */
+    uint64_t       totalBytes; /* total bytes written (buf flushes + current bufPos) */
+    struct TbcxStrPool *strs;  /* string table being built (save side) */
 } TbcxOut;
 
 /* ==========================================================================
@@ -417,20 +666,184 @@ Tcl_Namespace    *Tbcx_EnsureNamespace(Tcl_Interp *ip, const char *fqn);
 void              Tbcx_FreeLocals(CompiledLocal *first);
 int               Tbcx_ProbeOpenChannel(Tcl_Interp *interp, Tcl_Obj *obj, Tcl_Channel *chPtr);
 int               Tbcx_ProbeReadableFile(Tcl_Interp *interp, Tcl_Obj *pathObj);
+int               Tbcx_MapFile(Tcl_Obj *pathObj, TbcxMap *m);
+void              Tbcx_UnmapFile(TbcxMap *m);
+void              Tbcx_FindPayload(const unsigned char *p, size_t n, size_t *offOut, size_t *lenOut);
+TbcxCached       *Tbcx_CacheGet(Tcl_Interp *ip, Tcl_Obj *pathObj);
+TbcxCached       *Tbcx_CacheFetch(Tcl_Obj *pathObj);
+void              Tbcx_CacheRelease(TbcxCached *ce);
+void              Tbcx_CacheTrustChanged(void);
+int               Tbcx_FileId(Tcl_Obj *pathObj, TbcxFileId *id);
+int               Tbcx_FileChecked(const TbcxFileId *id);
+void              Tbcx_FileNoteChecked(const TbcxFileId *id);
+int               Tbcx_LoadSpan(Tcl_Interp *ip, TbcxMap *m, const unsigned char *p, size_t n, Tcl_Obj *scriptFilePath, int lazy);
+int               Tbcx_SaveFile(Tcl_Interp *interp, Tcl_Obj *pathObj, unsigned saveFlags, TbcxOut *w, Tcl_Obj **sourcePathOut);
+Tcl_Channel       Tbcx_OpenTempOutput(Tcl_Interp *interp, Tcl_Obj *outObj, Tcl_Obj **tmpPathOut);
+int               Tbcx_CommitTempOutput(Tcl_Interp *interp, Tcl_Channel ch, Tcl_Obj *tmpPath, Tcl_Obj *outObj, int rc);
 void              Tbcx_R_Init(TbcxIn *r, Tcl_Interp *ip, Tcl_Channel ch);
+void              Tbcx_R_InitMem(TbcxIn *r, Tcl_Interp *ip, const unsigned char *p, size_t n);
 int               Tbcx_R_Bytes(TbcxIn *r, void *p, Tcl_Size n);
+int               Tbcx_R_View(TbcxIn *r, size_t n, const unsigned char **pp);
 int               Tbcx_R_LPString(TbcxIn *r, char **sp, uint32_t *lenp);
+Tcl_Obj          *Tbcx_R_StringObj(TbcxIn *r);
 int               Tbcx_R_U32(TbcxIn *r, uint32_t *vp);
+int               Tbcx_R_Var(TbcxIn *r, uint32_t *vp);
 int               Tbcx_R_U64(TbcxIn *r, uint64_t *vp);
+int               Tbcx_R_VarArray(TbcxIn *r, uint32_t *dst, uint32_t n);
 int               Tbcx_R_U8(TbcxIn *r, uint8_t *v);
+int               Tbcx_R_StrRef(TbcxIn *r, Tcl_Obj **objOut);
+TbcxStrTab       *Tbcx_ReadStrTab(TbcxIn *r);
+void              Tbcx_StrTabRelease(TbcxStrTab *st);
 void              Tbcx_W_Init(TbcxOut *w, Tcl_Interp *ip, Tcl_Channel ch);
+void              Tbcx_W_InitMem(TbcxOut *w, Tcl_Interp *ip);
+void              Tbcx_W_FreeMem(TbcxOut *w);
 int               Tbcx_W_Flush(TbcxOut *w);
 Tcl_Obj          *Tbcx_ReadBlock(TbcxIn *r, Tcl_Interp *ip, Namespace *nsForDefault, uint32_t *numLocalsOut, int setPrecompiled, int dumpOnly);
 int               Tbcx_ReadHeader(TbcxIn *r, TbcxHeader *H);
+void              Tbcx_FreeHeader(TbcxHeader *H);
+uint64_t          Tbcx_R_Tell(const TbcxIn *r);
+int               Tbcx_R_Seek(TbcxIn *r, const TbcxHeader *H, uint64_t dataOff);
+unsigned char    *Tbcx_R_Inflate(TbcxIn *r, TbcxHeader *H);
+unsigned char    *Tbcx_R_Slurp(TbcxIn *r, const TbcxHeader *H);
+void              Tbcx_BlockTabFree(TbcxBlockTab *t);
+int               Tbcx_R_VerifySections(TbcxIn *r, const TbcxHeader *H);
+void              Tbcx_R_CrcMark(TbcxIn *r);
+int               Tbcx_R_CrcCheck(TbcxIn *r, const TbcxHeader *H, uint32_t idx);
+void              Tbcx_CrcInit(void);
+const char       *Tbcx_CrcImpl(void);
+uint32_t          Tbcx_Crc32c(uint32_t crc, const void *p, size_t n);
+void              Tbcx_Sha256(const void *p, size_t n, unsigned char hash[TBCX_SHA256_LEN]);
+int               Tbcx_TrustActive(void);
+int               Tbcx_TrustMayMatch(size_t len);
+int               Tbcx_TrustLookup(const unsigned char hash[TBCX_SHA256_LEN]);
+size_t            Tbcx_LzBound(size_t n);
+size_t            Tbcx_LzCompress(const unsigned char *src, size_t n, unsigned char *dst, size_t cap);
+int               Tbcx_LzDecompress(const unsigned char *src, size_t n, unsigned char *dst, size_t rawLen);
 void              TbcxApplyShimPurgeAll(Tcl_Interp *ip);
+void              TbcxInternPurge(Tcl_Interp *ip);
 void              TbcxFixupByteCode(ByteCode *bc, Proc *proc, Tcl_Interp *ip, Namespace *ns, int cacheMode);
 int               TbcxVerifyLoadedBC(ByteCode *bc, Tcl_Interp *ip, const char *label);
 
+/* Tbcx_DecodeVar — decode one varint from [p, p + avail).  Returns the
+ * number of bytes consumed, or 0 when the encoding is not complete within
+ * avail bytes or is malformed (longer than TBCX_VAR_MAX, or > 32 bits). */
+static inline size_t Tbcx_DecodeVar(const unsigned char *p, size_t avail, uint32_t *vp) {
+    uint32_t v = 0;
+    for (size_t i = 0; i < avail && i < TBCX_VAR_MAX; i++) {
+        v |= (uint32_t)(p[i] & 0x7Fu) << (7u * i);
+        if (!(p[i] & 0x80u)) {
+            if (i == TBCX_VAR_MAX - 1u && p[i] > 0x0Fu)
+                return 0;
+            *vp = v;
+            return i + 1u;
+        }
+    }
+    return 0;
+}
+
+/* Byte order.  Fixed-width wire fields are little-endian.  TBCX_HOST_LE is
+ * 1 or 0 when the compiler names the target's byte order, so the codecs
+ * below fold to a plain load or a bswap; only on a target it cannot name
+ * do they consult tbcxHostIsLE at run time. */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define TBCX_HOST_LE 1
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define TBCX_HOST_LE 0
+#elif defined(_WIN32) || defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86) || defined(_M_ARM64)
+#define TBCX_HOST_LE 1
+#endif
+
+static inline int Tbcx_HostIsLE(void) {
+#if defined(TBCX_HOST_LE)
+    return TBCX_HOST_LE;
+#else
+    return atomic_load_explicit(&tbcxHostIsLE, memory_order_relaxed);
+#endif
+}
+
+static inline uint32_t Tbcx_Swap32(uint32_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(v);
+#else
+    return ((v & 0xFFu) << 24) | ((v & 0xFF00u) << 8) | ((v >> 8) & 0xFF00u) | (v >> 24);
+#endif
+}
+
+static inline uint64_t Tbcx_Swap64(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(v);
+#else
+    return ((uint64_t)Tbcx_Swap32((uint32_t)v) << 32) | Tbcx_Swap32((uint32_t)(v >> 32));
+#endif
+}
+
+/* Tbcx_GetLe32 / Tbcx_GetLe64 / Tbcx_PutLe32 / Tbcx_PutLe64 — fixed-width
+ * little-endian fields at any alignment. */
+static inline uint32_t Tbcx_GetLe32(const unsigned char *p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return Tbcx_HostIsLE() ? v : Tbcx_Swap32(v);
+}
+
+static inline uint64_t Tbcx_GetLe64(const unsigned char *p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return Tbcx_HostIsLE() ? v : Tbcx_Swap64(v);
+}
+
+static inline void Tbcx_PutLe32(unsigned char *p, uint32_t v) {
+    if (!Tbcx_HostIsLE())
+        v = Tbcx_Swap32(v);
+    memcpy(p, &v, 4);
+}
+
+static inline void Tbcx_PutLe64(unsigned char *p, uint64_t v) {
+    if (!Tbcx_HostIsLE())
+        v = Tbcx_Swap64(v);
+    memcpy(p, &v, 8);
+}
+
+/* Tbcx_NativeAbi — this build's TBCX_HDR_FL_NATIVE ABI tag (unshifted). */
+static inline uint32_t Tbcx_NativeAbi(void) {
+    return (uint32_t)(sizeof(ExceptionRange) & 0x7Fu) | (Tbcx_HostIsLE() ? 0u : 0x80u);
+}
+
+/* Tbcx_DecodeVars — decode up to n varints from [p, p + avail) into dst.
+ * Returns the number of values decoded; *usedOut receives the bytes they
+ * took.  Stops early at the first encoding that is incomplete (or
+ * malformed) within avail, leaving the caller to continue from there. */
+static inline uint32_t Tbcx_DecodeVars(const unsigned char *p, size_t avail, uint32_t *dst, uint32_t n, size_t *usedOut) {
+    size_t   pos = 0;
+    uint32_t k   = 0;
+    for (; k < n; k++) {
+        if (pos < avail && p[pos] < 0x80u) {
+            dst[k] = p[pos++]; /* one-byte values dominate: indices, small offsets */
+            continue;
+        }
+        size_t used = Tbcx_DecodeVar(p + pos, avail - pos, &dst[k]);
+        if (!used)
+            break;
+        pos += used;
+    }
+    *usedOut = pos;
+    return k;
+}
+
+/* Tbcx_EncodeVars — encode n values as varints at dst, which must have
+ * room for n * TBCX_VAR_MAX bytes.  Returns the bytes written. */
+static inline size_t Tbcx_EncodeVars(unsigned char *dst, const uint32_t *v, size_t n) {
+    unsigned char *op = dst;
+    for (size_t k = 0; k < n; k++) {
+        uint32_t x = v[k];
+        while (x >= 0x80u) {
+            *op++ = (unsigned char)(x | 0x80u);
+            x >>= 7;
+        }
+        *op++ = (unsigned char)x;
+    }
+    return (size_t)(op - dst);
+}
+
 /* Checked multiplication for allocation sizes.  Returns 1 on success
  * (result stored in *out), 0 if the multiplication would overflow size_t. */
 static inline int tbcx_checked_mul(size_t a, size_t b, size_t *out) {
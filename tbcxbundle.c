@@ -0,0 +1,498 @@
+/* ==========================================================================
+ * tbcxbundle.c — Multi-artifact bundles for .tbcx (Tcl 9.1)
+ *
+ * An application made of many scripts would otherwise ship one artifact
+ * per script and pay an open, a header check and a mapping for each.  A
+ * bundle packs the artifacts behind one index (layout: TBCX_BUNDLE_* in
+ * tbcx.h).  Loading a member reads the header and index only, then
+ * decodes the member's bytes in place — straight out of the bundle's
+ * mapping when the file can be mapped, otherwise after one seek and one
+ * read.  Members are complete artifacts with their own header, directory
+ * and checksums.  Each index entry also records the member's source
+ * path, which is what `info script` reports while the member loads.
+ * ========================================================================== */
+
+#include "tbcx.h"
+
+/* One decoded index entry.  name and path point into the index bytes. */
+typedef struct {
+    const unsigned char *name;
+    uint32_t             nameLen;
+    const unsigned char *path;
+    uint32_t             pathLen;
+    uint64_t             offset;
+    uint64_t             length;
+} BundleEntry;
+
+/* An open bundle: the whole file mapped, or a channel positioned after the
+ * index with a private copy of the index. */
+typedef struct {
+    TbcxMap              map;
+    Tcl_Channel          chan;
+    uint64_t             fileLen;
+    uint32_t             count;
+    const unsigned char *index;
+    uint64_t             indexLen;
+    unsigned char       *indexBuf;
+} Bundle;
+
+/* One member while a bundle is being written. */
+typedef struct {
+    Tcl_Obj *sourcePath;
+    TbcxOut  art;
+    uint64_t offset;
+} BundleMember;
+
+/* ==========================================================================
+ * Forward Declarations
+ * ========================================================================== */
+
+static inline uint64_t BundleAlign(uint64_t v);
+static inline size_t   BundleVarLen(uint32_t v);
+static int             BundleCheckHeader(Tcl_Interp *ip, const unsigned char *hdr, uint64_t fileLen, Bundle *b);
+static int             BundleNext(const unsigned char **pp, const unsigned char *end, uint64_t fileLen, BundleEntry *e);
+static int             BundleCorrupt(Tcl_Interp *ip);
+static int             BundleOpen(Tcl_Interp *ip, Tcl_Obj *pathObj, Bundle *b);
+static void            BundleClose(Bundle *b);
+static int             BundleFind(Tcl_Interp *ip, Bundle *b, Tcl_Obj *nameObj, BundleEntry *e);
+static int             BundleWrite(Tcl_Interp *ip, Tcl_Channel ch, const void *p, size_t n);
+static int             BundleCreate(Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const objv[]);
+static int             BundleLoad(Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const objv[]);
+static int             BundleList(Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const objv[]);
+int                    Tbcx_BundleObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+
+/* ==========================================================================
+ * Index
+ * ========================================================================== */
+
+static inline uint64_t BundleAlign(uint64_t v) {
+    return (v + (TBCX_BUNDLE_ALIGN - 1u)) & ~(uint64_t)(TBCX_BUNDLE_ALIGN - 1u);
+}
+
+static inline size_t BundleVarLen(uint32_t v) {
+    size_t n = 1;
+    while (v >= 0x80u) {
+        v >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static int BundleCorrupt(Tcl_Interp *ip) {
+    Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx::bundle: corrupt bundle index", -1));
+    Tcl_SetErrorCode(ip, "TBCX", "BUNDLE", "CORRUPT", NULL);
+    return TCL_ERROR;
+}
+
+/* BundleCheckHeader — validate the fixed header of a fileLen-byte bundle
+ * and record its member count and index length in b. */
+static int BundleCheckHeader(Tcl_Interp *ip, const unsigned char *hdr, uint64_t fileLen, Bundle *b) {
+    if (Tbcx_GetLe32(hdr) != TBCX_BUNDLE_MAGIC) {
+        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx::bundle: not a tbcx bundle", -1));
+        Tcl_SetErrorCode(ip, "TBCX", "BUNDLE", "MAGIC", NULL);
+        return TCL_ERROR;
+    }
+    uint32_t version = Tbcx_GetLe32(hdr + 4);
+    if (version != TBCX_BUNDLE_VERSION) {
+        Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::bundle: unsupported bundle version %u", (unsigned)version));
+        Tcl_SetErrorCode(ip, "TBCX", "BUNDLE", "VERSION", NULL);
+        return TCL_ERROR;
+    }
+    b->count    = Tbcx_GetLe32(hdr + 8);
+    b->indexLen = Tbcx_GetLe64(hdr + 16);
+    if (b->count > TBCX_MAX_BUNDLE_MEMBERS || b->indexLen > fileLen - TBCX_BUNDLE_HDR || b->indexLen > TBCX_MAX_IMAGE)
+        return BundleCorrupt(ip);
+    return TCL_OK;
+}
+
+/* BundleNext — decode the index entry at *pp and advance past it.  Returns
+ * 0 when the entry runs past end or its member lies outside the file. */
+static int BundleNext(const unsigned char **pp, const unsigned char *end, uint64_t fileLen, BundleEntry *e) {
+    const unsigned char *p    = *pp;
+    size_t               used = Tbcx_DecodeVar(p, (size_t)(end - p), &e->nameLen);
+    if (!used || e->nameLen > (size_t)(end - p) - used)
+        return 0;
+    p += used;
+    e->name = p;
+    p += e->nameLen;
+    used = Tbcx_DecodeVar(p, (size_t)(end - p), &e->pathLen);
+    if (!used || e->pathLen > (size_t)(end - p) - used)
+        return 0;
+    p += used;
+    e->path = p;
+    p += e->pathLen;
+    if ((size_t)(end - p) < 16u)
+        return 0;
+    e->offset = Tbcx_GetLe64(p);
+    e->length = Tbcx_GetLe64(p + 8);
+    p += 16;
+    if (e->offset > fileLen || e->length > fileLen - e->offset || e->length > TBCX_MAX_IMAGE)
+        return 0;
+    *pp = p;
+    return 1;
+}
+
+/* BundleOpen — open the bundle at pathObj and bring its index into memory.
+ * Regular files are mapped whole; anything else (VFS, pipes) is read
+ * through a channel that BundleClose releases. */
+static int BundleOpen(Tcl_Interp *ip, Tcl_Obj *pathObj, Bundle *b) {
+    memset(b, 0, sizeof(*b));
+    if (!Tbcx_ProbeReadableFile(ip, pathObj)) {
+        Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::bundle: cannot read \"%s\"", Tbcx_GetStringSafe(pathObj)));
+        Tcl_SetErrorCode(ip, "TBCX", "BUNDLE", "BADINPUT", NULL);
+        return TCL_ERROR;
+    }
+    if (Tbcx_MapFile(pathObj, &b->map)) {
+        b->fileLen = b->map.len;
+        if (b->fileLen < TBCX_BUNDLE_HDR || BundleCheckHeader(ip, b->map.base, b->fileLen, b) != TCL_OK) {
+            if (b->fileLen < TBCX_BUNDLE_HDR)
+                BundleCorrupt(ip);
+            BundleClose(b);
+            return TCL_ERROR;
+        }
+        b->index = b->map.base + TBCX_BUNDLE_HDR;
+        return TCL_OK;
+    }
+
+    unsigned char hdr[TBCX_BUNDLE_HDR];
+    b->chan = Tcl_FSOpenFileChannel(ip, pathObj, "r", 0);
+    if (!b->chan)
+        return TCL_ERROR;
+    if (Tbcx_CheckBinaryChan(ip, b->chan) != TCL_OK)
+        goto fail;
+    long long end = Tcl_Seek(b->chan, 0, SEEK_END);
+    if (end < 0 || Tcl_Seek(b->chan, 0, SEEK_SET) < 0) {
+        Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::bundle: cannot seek in \"%s\": %s", Tbcx_GetStringSafe(pathObj), Tcl_PosixError(ip)));
+        goto fail;
+    }
+    b->fileLen = (uint64_t)end;
+    if (b->fileLen < TBCX_BUNDLE_HDR || Tcl_Read(b->chan, (char *)hdr, TBCX_BUNDLE_HDR) != TBCX_BUNDLE_HDR) {
+        BundleCorrupt(ip);
+        goto fail;
+    }
+    if (BundleCheckHeader(ip, hdr, b->fileLen, b) != TCL_OK)
+        goto fail;
+    b->indexBuf = (unsigned char *)Tcl_AttemptAlloc(b->indexLen ? (size_t)b->indexLen : 1u);
+    if (!b->indexBuf) {
+        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx::bundle: allocation failed (index)", -1));
+        goto fail;
+    }
+    if (b->indexLen && Tcl_Read(b->chan, (char *)b->indexBuf, (Tcl_Size)b->indexLen) != (Tcl_Size)b->indexLen) {
+        BundleCorrupt(ip);
+        goto fail;
+    }
+    b->index = b->indexBuf;
+    return TCL_OK;
+
+fail:
+    BundleClose(b);
+    return TCL_ERROR;
+}
+
+static void BundleClose(Bundle *b) {
+    Tbcx_UnmapFile(&b->map);
+    if (b->chan) {
+        Tcl_Close(NULL, b->chan);
+        b->chan = NULL;
+    }
+    if (b->indexBuf) {
+        Tcl_Free((char *)b->indexBuf);
+        b->indexBuf = NULL;
+    }
+    b->index = NULL;
+}
+
+/* BundleFind — index lookup by member name.  Linear: the index is read
+ * once per load and a name compare is far cheaper than the decode that
+ * follows. */
+static int BundleFind(Tcl_Interp *ip, Bundle *b, Tcl_Obj *nameObj, BundleEntry *e) {
+    Tcl_Size             nameLen = 0;
+    const char          *name    = Tcl_GetStringFromObj(nameObj, &nameLen);
+    const unsigned char *p       = b->index;
+    const unsigned char *end     = b->index + b->indexLen;
+    for (uint32_t i = 0; i < b->count; i++) {
+        if (!BundleNext(&p, end, b->fileLen, e))
+            return BundleCorrupt(ip);
+        if ((Tcl_Size)e->nameLen == nameLen && memcmp(e->name, name, (size_t)nameLen) == 0)
+            return TCL_OK;
+    }
+    Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::bundle: no member \"%s\" in bundle", name));
+    Tcl_SetErrorCode(ip, "TBCX", "BUNDLE", "NOMEMBER", name, NULL);
+    return TCL_ERROR;
+}
+
+/* ==========================================================================
+ * Subcommands
+ * ========================================================================== */
+
+static int BundleWrite(Tcl_Interp *ip, Tcl_Channel ch, const void *p, size_t n) {
+    if (n && Tcl_WriteRaw(ch, (const char *)p, (Tcl_Size)n) != (Tcl_Size)n) {
+        Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::bundle: write failed: %s", Tcl_PosixError(ip)));
+        return TCL_ERROR;
+    }
+    return TCL_OK;
+}
+
+/* bundle create out ?-include-source? ?-compress? ?-native? ?--? file ... */
+static int BundleCreate(Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    static const char *const opts[] = {"-include-source", "-compress", "-native", "--", NULL};
+    static const unsigned    optFl[] = {TBCX_SAVE_FL_INCLUDE_SOURCE, TBCX_SAVE_FL_COMPRESS, TBCX_SAVE_FL_NATIVE, 0};
+    unsigned                 saveFlags = 0;
+    Tcl_Size                 i         = 3;
+
+    if (objc < 4) {
+        Tcl_WrongNumArgs(ip, 2, objv, "out ?-include-source? ?-compress? ?-native? ?--? file ?file ...?");
+        return TCL_ERROR;
+    }
+    while (i < objc && Tcl_GetString(objv[i])[0] == '-') {
+        int idx;
+        if (Tcl_GetIndexFromObj(ip, objv[i], opts, "option", 0, &idx) != TCL_OK)
+            return TCL_ERROR;
+        i++;
+        if (optFl[idx] == 0)
+            break;
+        saveFlags |= optFl[idx];
+    }
+    Tcl_Size nMembers = objc - i;
+    if (nMembers < 1) {
+        Tcl_WrongNumArgs(ip, 2, objv, "out ?-include-source? ?-compress? ?-native? ?--? file ?file ...?");
+        return TCL_ERROR;
+    }
+    if ((uint64_t)nMembers > TBCX_MAX_BUNDLE_MEMBERS) {
+        Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::bundle: too many members (limit %u)", TBCX_MAX_BUNDLE_MEMBERS));
+        return TCL_ERROR;
+    }
+    Tcl_Obj *const *files = objv + i;
+
+    BundleMember  *mem = (BundleMember *)Tcl_Alloc(sizeof(BundleMember) * (size_t)nMembers);
+    Tcl_HashTable  names;
+    int            rc       = TCL_OK;
+    uint64_t       indexLen = 0;
+    Tcl_InitHashTable(&names, TCL_STRING_KEYS);
+    for (Tcl_Size k = 0; k < nMembers; k++) {
+        mem[k].sourcePath = NULL;
+        mem[k].offset     = 0;
+        Tbcx_W_InitMem(&mem[k].art, ip);
+    }
+
+    /* Compile every member before touching the output. */
+    for (Tcl_Size k = 0; k < nMembers && rc == TCL_OK; k++) {
+        int isNew;
+        Tcl_CreateHashEntry(&names, Tcl_GetString(files[k]), &isNew);
+        if (!isNew) {
+            Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::bundle: duplicate member \"%s\"", Tcl_GetString(files[k])));
+            Tcl_SetErrorCode(ip, "TBCX", "BUNDLE", "DUPLICATE", NULL);
+            rc = TCL_ERROR;
+            break;
+        }
+        if (!Tbcx_ProbeReadableFile(ip, files[k])) {
+            Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::bundle: cannot read \"%s\"", Tbcx_GetStringSafe(files[k])));
+            Tcl_SetErrorCode(ip, "TBCX", "BUNDLE", "BADINPUT", NULL);
+            rc = TCL_ERROR;
+            break;
+        }
+        rc = Tbcx_SaveFile(ip, files[k], saveFlags, &mem[k].art, &mem[k].sourcePath);
+        if (rc != TCL_OK)
+            break;
+        Tcl_Size nameLen = 0, pathLen = 0;
+        (void)Tcl_GetStringFromObj(files[k], &nameLen);
+        (void)Tcl_GetStringFromObj(mem[k].sourcePath, &pathLen);
+        indexLen += BundleVarLen((uint32_t)nameLen) + (uint64_t)nameLen + BundleVarLen((uint32_t)pathLen) + (uint64_t)pathLen + 16u;
+    }
+    Tcl_DeleteHashTable(&names);
+
+    /* Lay out, then stream header, index and members in file order. */
+    if (rc == TCL_OK) {
+        uint64_t pos = BundleAlign(TBCX_BUNDLE_HDR + indexLen);
+        for (Tcl_Size k = 0; k < nMembers; k++) {
+            mem[k].offset = pos;
+            pos           = BundleAlign(pos + mem[k].art.memLen);
+        }
+
+        unsigned char *index = (unsigned char *)Tcl_AttemptAlloc((size_t)indexLen);
+        if (!index) {
+            Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx::bundle: allocation failed (index)", -1));
+            rc = TCL_ERROR;
+        } else {
+            unsigned char *q = index;
+            for (Tcl_Size k = 0; k < nMembers; k++) {
+                Tcl_Size    nameLen = 0, pathLen = 0;
+                const char *name = Tcl_GetStringFromObj(files[k], &nameLen);
+                const char *path = Tcl_GetStringFromObj(mem[k].sourcePath, &pathLen);
+                uint32_t    v    = (uint32_t)nameLen;
+                q += Tbcx_EncodeVars(q, &v, 1);
+                memcpy(q, name, (size_t)nameLen);
+                q += nameLen;
+                v = (uint32_t)pathLen;
+                q += Tbcx_EncodeVars(q, &v, 1);
+                memcpy(q, path, (size_t)pathLen);
+                q += pathLen;
+                Tbcx_PutLe64(q, mem[k].offset);
+                Tbcx_PutLe64(q + 8, (uint64_t)mem[k].art.memLen);
+                q += 16;
+            }
+
+            unsigned char hdr[TBCX_BUNDLE_HDR];
+            Tbcx_PutLe32(hdr, TBCX_BUNDLE_MAGIC);
+            Tbcx_PutLe32(hdr + 4, TBCX_BUNDLE_VERSION);
+            Tbcx_PutLe32(hdr + 8, (uint32_t)nMembers);
+            Tbcx_PutLe32(hdr + 12, 0u);
+            Tbcx_PutLe64(hdr + 16, indexLen);
+
+            Tcl_Obj    *tmpPath = NULL;
+            Tcl_Channel ch      = Tbcx_OpenTempOutput(ip, objv[2], &tmpPath);
+            if (!ch) {
+                rc = TCL_ERROR;
+            } else {
+                static const unsigned char zeros[TBCX_BUNDLE_ALIGN] = {0};
+                uint64_t                   at                       = TBCX_BUNDLE_HDR + indexLen;
+                rc = BundleWrite(ip, ch, hdr, sizeof(hdr));
+                if (rc == TCL_OK)
+                    rc = BundleWrite(ip, ch, index, (size_t)indexLen);
+                for (Tcl_Size k = 0; k < nMembers && rc == TCL_OK; k++) {
+                    rc = BundleWrite(ip, ch, zeros, (size_t)(mem[k].offset - at));
+                    if (rc == TCL_OK)
+                        rc = BundleWrite(ip, ch, mem[k].art.mem, mem[k].art.memLen);
+                    at = mem[k].offset + mem[k].art.memLen;
+                }
+                rc = Tbcx_CommitTempOutput(ip, ch, tmpPath, objv[2], rc);
+            }
+            Tcl_Free((char *)index);
+        }
+    }
+
+    for (Tcl_Size k = 0; k < nMembers; k++) {
+        Tbcx_W_FreeMem(&mem[k].art);
+        if (mem[k].sourcePath)
+            Tcl_DecrRefCount(mem[k].sourcePath);
+    }
+    Tcl_Free((char *)mem);
+    return rc;
+}
+
+/* bundle load ?-lazy? bundle member */
+static int BundleLoad(Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    int lazy = (objc == 5 && strcmp(Tcl_GetString(objv[2]), "-lazy") == 0);
+    if (objc != 4 && !lazy) {
+        Tcl_WrongNumArgs(ip, 2, objv, "?-lazy? bundle member");
+        return TCL_ERROR;
+    }
+    Tcl_Obj    *pathObj = objv[objc - 2];
+    Bundle      b;
+    BundleEntry e;
+    if (BundleOpen(ip, pathObj, &b) != TCL_OK)
+        return TCL_ERROR;
+    if (BundleFind(ip, &b, objv[objc - 1], &e) != TCL_OK) {
+        BundleClose(&b);
+        return TCL_ERROR;
+    }
+
+    /* `info script` during the member's top-level code names the script
+     * the member was compiled from, as recorded in the index. */
+    Tcl_Obj *scriptPath = e.pathLen ? Tcl_NewStringObj((const char *)e.path, (Tcl_Size)e.pathLen) : pathObj;
+    Tcl_IncrRefCount(scriptPath);
+    int rc;
+    if (b.map.base) {
+        rc = Tbcx_LoadSpan(ip, &b.map, b.map.base + e.offset, (size_t)e.length, scriptPath, lazy);
+        BundleClose(&b);
+        Tcl_DecrRefCount(scriptPath);
+        return rc;
+    }
+
+    unsigned char *buf = (unsigned char *)Tcl_AttemptAlloc(e.length ? (size_t)e.length : 1u);
+    if (!buf) {
+        BundleClose(&b);
+        Tcl_DecrRefCount(scriptPath);
+        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx::bundle: allocation failed (member)", -1));
+        return TCL_ERROR;
+    }
+    if (Tcl_Seek(b.chan, (long long)e.offset, SEEK_SET) < 0 || Tcl_Read(b.chan, (char *)buf, (Tcl_Size)e.length) != (Tcl_Size)e.length) {
+        Tcl_Free((char *)buf);
+        BundleClose(&b);
+        Tcl_DecrRefCount(scriptPath);
+        return BundleCorrupt(ip);
+    }
+    BundleClose(&b);
+    rc = Tbcx_LoadSpan(ip, NULL, buf, (size_t)e.length, scriptPath, lazy);
+    Tcl_Free((char *)buf);
+    Tcl_DecrRefCount(scriptPath);
+    return rc;
+}
+
+/* bundle list bundle — one {name source offset size} dict per member */
+static int BundleList(Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    if (objc != 3) {
+        Tcl_WrongNumArgs(ip, 2, objv, "bundle");
+        return TCL_ERROR;
+    }
+    Bundle b;
+    if (BundleOpen(ip, objv[2], &b) != TCL_OK)
+        return TCL_ERROR;
+    Tcl_Obj             *out = Tcl_NewListObj(0, NULL);
+    Tcl_IncrRefCount(out);
+    const unsigned char *p   = b.index;
+    const unsigned char *end = b.index + b.indexLen;
+    for (uint32_t i = 0; i < b.count; i++) {
+        BundleEntry e;
+        if (!BundleNext(&p, end, b.fileLen, &e)) {
+            Tcl_DecrRefCount(out);
+            BundleClose(&b);
+            return BundleCorrupt(ip);
+        }
+        Tcl_Obj *d = Tcl_NewDictObj();
+        Tcl_DictObjPut(NULL, d, Tcl_NewStringObj("name", -1), Tcl_NewStringObj((const char *)e.name, (Tcl_Size)e.nameLen));
+        Tcl_DictObjPut(NULL, d, Tcl_NewStringObj("source", -1), Tcl_NewStringObj((const char *)e.path, (Tcl_Size)e.pathLen));
+        Tcl_DictObjPut(NULL, d, Tcl_NewStringObj("offset", -1), Tcl_NewWideIntObj((Tcl_WideInt)e.offset));
+        Tcl_DictObjPut(NULL, d, Tcl_NewStringObj("size", -1), Tcl_NewWideIntObj((Tcl_WideInt)e.length));
+        Tcl_ListObjAppendElement(NULL, out, d);
+    }
+    BundleClose(&b);
+    Tcl_SetObjResult(ip, out);
+    Tcl_DecrRefCount(out);
+    return TCL_OK;
+}
+
+/* ==========================================================================
+ * Tcl command: tbcx::bundle
+ *
+ * Synopsis:   tbcx::bundle create out ?-include-source? ?-compress?
+ *                                 ?-native? ?--? file ?file ...?
+ *             tbcx::bundle load ?-lazy? bundle member
+ *             tbcx::bundle list bundle
+ * Arguments:  create — compile each script file (as tbcx::save would, with
+ *                   the same options) and write them all to out.  Each
+ *                   member is named by its file argument as given.
+ *             load — load one member as tbcx::load would load it from a
+ *                   file of its own (-lazy likewise), except that `info
+ *                   script` reports the member's recorded source path.
+ *             list — describe the index.
+ * Returns:    create: the normalized output path.  load: the result of the
+ *             member's top-level code.  list: a list of dicts with keys
+ *             name, source, offset and size.
+ * Errors:     TCL_ERROR on duplicate or unreadable inputs, a malformed
+ *             bundle, an unknown member, or any error tbcx::save or
+ *             tbcx::load would raise for the member itself.
+ * Thread:     Must be called on the interp-owning thread.
+ * ========================================================================== */
+
+int Tbcx_BundleObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    static const char *const subs[] = {"create", "list", "load", NULL};
+    enum { SUB_CREATE, SUB_LIST, SUB_LOAD };
+    int                      idx;
+
+    TBCX_CHECK_INTERP_THREAD(interp);
+    if (objc < 2) {
+        Tcl_WrongNumArgs(interp, 1, objv, "subcommand ?arg ...?");
+        return TCL_ERROR;
+    }
+    if (Tcl_GetIndexFromObj(interp, objv[1], subs, "subcommand", 0, &idx) != TCL_OK)
+        return TCL_ERROR;
+    switch (idx) {
+    case SUB_CREATE:
+        return BundleCreate(interp, objc, objv);
+    case SUB_LIST:
+        return BundleList(interp, objc, objv);
+    default:
+        return BundleLoad(interp, objc, objv);
+    }
+}
@@ -0,0 +1,949 @@
+/* ==========================================================================
+ * tbcxcache.c — Process-wide artifact cache and prefetch for .tbcx (Tcl 9.1)
+ *
+ * Many interps, often on many threads, load the same artifacts.  Each
+ * tbcx::load of a file would otherwise map it again, recompute every
+ * section checksum and, for -compress artifacts, inflate every frame.
+ * Once enabled (tbcx::cache enable), this cache keeps one verified image
+ * per file for the whole process,
+ * keyed by normalized path and checked against the file's identity
+ * (device, inode, mtime, ctime, size) on every lookup.  Images are plain
+ * bytes — a compiled block holds per-interp Tcl_Objs, so decoding stays
+ * with each interp — and are never written once published, so any thread
+ * reads them without holding the lock.
+ *
+ * The lock covers the table and the LRU list only: a lookup is a hash
+ * probe and a reference bump under it; mapping, checksumming and
+ * inflating all happen outside.
+ *
+ * The cache is off by default because an entry holds its file for as long
+ * as it is cached.  A mapped image keeps the file's pages: on POSIX an
+ * unlinked or renamed-over file stays pinned, and rewriting the file in
+ * place (truncating it) under a cached image is as undefined as under a
+ * live load (SIGBUS, or foreign bytes in a deferred body).  On Windows a
+ * view would block deleting or renaming over the file — tbcx::save to the
+ * same path among them — so entries there hold a private copy instead.
+ *
+ * Operand validation is remembered apart from the cache, per file identity
+ * (Tbcx_FileChecked), so it runs once per file whether or not the cache
+ * is enabled.
+ * ========================================================================== */
+
+#include "tbcx.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+TCL_DECLARE_MUTEX(tbcxCacheMutex);
+
+/* All below guarded by tbcxCacheMutex. */
+static Tcl_HashTable cacheTable; /* normalized path -> TbcxCached* */
+static int           cacheInit;
+static TbcxCached   *cacheHead; /* most recently used */
+static TbcxCached   *cacheTail;
+static size_t        cacheBytes;
+static Tcl_WideInt   cacheHits;
+static Tcl_WideInt   cacheMisses;
+static int           cacheClosed; /* the process is exiting: fill nothing more */
+
+/* Read without the lock on every tbcx::load; written under it. */
+static atomic_int cacheEnabled;
+
+/* Guarded by tbcxCacheMutex: identities of the files a complete load has
+ * validated (TbcxFileId -> NULL). */
+static Tcl_HashTable checkedTable;
+static int           checkedInit;
+
+/* One tbcx::prefetch call: its paths, worked through in order by a thread
+ * of its own, and where to report.  interp, cmd and the list links belong
+ * to the owner thread; the prefetch thread only reads the path strings and
+ * writes status.  A call with -command is on its owner thread's list of
+ * outstanding reports until the report runs, or the interp is deleted or
+ * the owner thread exits first, which cancel it. */
+typedef struct TbcxPrefetch {
+    Tcl_Interp          *interp;    /* -command target; NULL once cancelled */
+    Tcl_ThreadId         owner;
+    Tcl_Obj             *cmd;       /* -command prefix, or NULL */
+    int                  report;    /* a -command report is due (fixed at creation) */
+    int                  cache;     /* -cache: fill the artifact cache too */
+    int                  refCount;  /* tbcxPrefetchMutex: thread, owner list, queued event */
+    int                  cancelled; /* tbcxPrefetchMutex: the report is off */
+    struct TbcxPrefetch *prev;      /* owner thread's outstanding list */
+    struct TbcxPrefetch *next;
+    Tcl_Size             numPaths;
+    char               **names;     /* as given (the report's keys) */
+    char               **paths;     /* normalized */
+    int                 *status;    /* TBCX_PF_* per path */
+    struct TbcxPrefetchRun *run;    /* the thread's, which it marks done */
+} TbcxPrefetch;
+
+enum { TBCX_PF_FAILED, TBCX_PF_READ, TBCX_PF_CACHED };
+
+typedef struct TbcxPrefetchEvent {
+    Tcl_Event     header;
+    TbcxPrefetch *pf;
+} TbcxPrefetchEvent;
+
+/* Per thread: the -command prefetches whose report is still due. */
+typedef struct {
+    TbcxPrefetch *head;
+    int           exitHandler; /* PrefetchThreadExit is registered */
+} TbcxPrefetchTsd;
+
+static Tcl_ThreadDataKey prefetchKey;
+TCL_DECLARE_MUTEX(tbcxPrefetchMutex);
+
+/* One prefetch thread, from creation until it is joined: by the next
+ * tbcx::prefetch once it is done, or at process exit (PrefetchFinalize).
+ * Kept apart from TbcxPrefetch, which its report may free first. */
+typedef struct TbcxPrefetchRun {
+    Tcl_ThreadId            id;
+    int                     done; /* the thread is about to exit */
+    struct TbcxPrefetchRun *next;
+} TbcxPrefetchRun;
+
+/* All below guarded by tbcxPrefetchMutex. */
+static TbcxPrefetchRun *prefetchRuns;
+static int              prefetchExitHandler; /* PrefetchFinalize is registered */
+static int              prefetchClosed;      /* the process is exiting: start nothing more */
+
+/* Read by prefetch threads between paths; set once, at process exit. */
+static atomic_int prefetchStop;
+
+#define TBCX_PREFETCH_KEY "tbcx::prefetch"
+
+/* ==========================================================================
+ * Forward Declarations
+ * ========================================================================== */
+
+static int         CacheStat(Tcl_Obj *pathObj, TbcxFileId *id);
+static int         CacheSameId(const TbcxFileId *a, const TbcxFileId *b);
+static int         CacheSettled(const TbcxFileId *id);
+static void        CheckedFinalize(void *cd);
+static int         CacheNormalize(const unsigned char *orig, unsigned char *buf, const TbcxHeader *H);
+static TbcxCached *CacheFill(Tcl_Interp *ip, Tcl_Obj *pathObj, const TbcxFileId *id);
+#ifdef _WIN32
+static int         CacheDetach(TbcxCached *ce);
+#endif
+static TbcxCached *CacheLookup(Tcl_Interp *ip, Tcl_Obj *pathObj, int any);
+static void        CacheFree(TbcxCached *ce);
+static void        CacheUnlinkLocked(TbcxCached *ce);
+static void        CacheFinalize(void *cd);
+static int         PrefetchPages(Tcl_Obj *pathObj);
+static int         PrefetchCached(Tcl_Obj *pathObj);
+static Tcl_ThreadCreateType PrefetchThread(void *cd);
+static void        PrefetchJoin(TbcxPrefetchRun *runs);
+static void        PrefetchReap(void);
+static void        PrefetchFinalize(void *cd);
+static int         PrefetchEventProc(Tcl_Event *evPtr, int flags);
+static int         PrefetchEventDelete(Tcl_Event *evPtr, void *cd);
+static void        PrefetchUnlink(TbcxPrefetchTsd *tsd, TbcxPrefetch *pf);
+static void        PrefetchCancel(TbcxPrefetchTsd *tsd, TbcxPrefetch *pf);
+static void        PrefetchInterpDeleted(void *cd, Tcl_Interp *interp);
+static void        PrefetchThreadExit(void *cd);
+static void        PrefetchRelease(TbcxPrefetch *pf);
+static void        PrefetchFree(TbcxPrefetch *pf);
+int                Tbcx_CacheObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+int                Tbcx_PrefetchObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+
+/* ==========================================================================
+ * File identity
+ * ========================================================================== */
+
+/* CacheStat — identity of the regular file at pathObj.  Returns 0 for
+ * anything else, or when it cannot be stat'ed. */
+static int CacheStat(Tcl_Obj *pathObj, TbcxFileId *id) {
+    Tcl_StatBuf *sb = Tcl_AllocStatBuf();
+    if (!sb)
+        return 0;
+    int ok = Tcl_FSStat(pathObj, sb) == 0 && S_ISREG(Tcl_GetModeFromStat(sb));
+    if (ok) {
+        id->dev   = (unsigned long long)Tcl_GetFSDeviceFromStat(sb);
+        id->ino   = (unsigned long long)Tcl_GetFSInodeFromStat(sb);
+        id->mtime = (long long)Tcl_GetModificationTimeFromStat(sb);
+        id->ctime = (long long)Tcl_GetChangeTimeFromStat(sb);
+        id->size  = (unsigned long long)Tcl_GetSizeFromStat(sb);
+    }
+    Tcl_Free((char *)sb);
+    return ok;
+}
+
+static int CacheSameId(const TbcxFileId *a, const TbcxFileId *b) {
+    return a->dev == b->dev && a->ino == b->ino && a->mtime == b->mtime && a->ctime == b->ctime && a->size == b->size;
+}
+
+/* CacheSettled — whether the file was last modified TBCX_CACHE_SETTLE
+ * seconds ago or more, so its identity will change with its bytes. */
+static int CacheSettled(const TbcxFileId *id) {
+    Tcl_Time now;
+    Tcl_GetTime(&now);
+    return (long long)now.sec - id->mtime >= TBCX_CACHE_SETTLE;
+}
+
+/* Tbcx_FileId — CacheStat for the loader. */
+int Tbcx_FileId(Tcl_Obj *pathObj, TbcxFileId *id) {
+    return CacheStat(pathObj, id);
+}
+
+/* ==========================================================================
+ * Validation memo
+ *
+ * A complete load that validated the operands of every block records its
+ * file's identity, and later loads of a file with that identity skip the
+ * walk — cached or not, in any interp.  Only settled files are recorded,
+ * as only those are cached.  At TBCX_CHECKED_MAX identities the set starts
+ * over rather than track which ones are stale.
+ * ========================================================================== */
+
+/* Tbcx_FileChecked — whether a load has validated the file with identity
+ * id. */
+int Tbcx_FileChecked(const TbcxFileId *id) {
+    Tcl_MutexLock(&tbcxCacheMutex);
+    int found = checkedInit && Tcl_FindHashEntry(&checkedTable, (const char *)id) != NULL;
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+    return found;
+}
+
+/* Tbcx_FileNoteChecked — a load validated every block of the file with
+ * identity id. */
+void Tbcx_FileNoteChecked(const TbcxFileId *id) {
+    if (!CacheSettled(id))
+        return;
+    Tcl_MutexLock(&tbcxCacheMutex);
+    if (!cacheClosed) {
+        if (!checkedInit) {
+            Tcl_InitHashTable(&checkedTable, (int)(sizeof(TbcxFileId) / sizeof(int)));
+            checkedInit = 1;
+            Tcl_CreateExitHandler(CheckedFinalize, NULL);
+        } else if (checkedTable.numEntries >= TBCX_CHECKED_MAX) {
+            Tcl_DeleteHashTable(&checkedTable);
+            Tcl_InitHashTable(&checkedTable, (int)(sizeof(TbcxFileId) / sizeof(int)));
+        }
+        int isNew;
+        Tcl_CreateHashEntry(&checkedTable, (const char *)id, &isNew);
+    }
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+}
+
+static void CheckedFinalize(TCL_UNUSED(void *)) {
+    Tcl_MutexLock(&tbcxCacheMutex);
+    if (checkedInit) {
+        Tcl_DeleteHashTable(&checkedTable);
+        checkedInit = 0;
+    }
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+}
+
+/* ==========================================================================
+ * Filling
+ * ========================================================================== */
+
+/* CacheNormalize — turn the inflated sections in buf (Tbcx_R_Inflate) into
+ * a complete uncompressed artifact: the original header and directory go
+ * into the zeroed prefix, with the LZ flag cleared and every entry
+ * rewritten to the inflated offset, length and checksum. */
+static int CacheNormalize(const unsigned char *orig, unsigned char *buf, const TbcxHeader *H) {
+    size_t base = (size_t)H->dataBase;
+    size_t at   = TBCX_HDR_FIXED + (size_t)Tbcx_GetLe32(orig + 40);
+    if (at + TBCX_DIR_COUNTS + (size_t)H->numSections * TBCX_DIR_ENTRY != base)
+        return 0;
+    memcpy(buf, orig, base);
+    Tbcx_PutLe32(buf + at, Tbcx_GetLe32(buf + at) & ~TBCX_HDR_FL_LZ);
+    unsigned char *ep = buf + at + TBCX_DIR_COUNTS;
+    for (uint32_t i = 0; i < H->numSections; i++, ep += TBCX_DIR_ENTRY) {
+        const TbcxSection *sp = &H->sections[i];
+        Tbcx_PutLe64(ep + 4, sp->offset);
+        Tbcx_PutLe64(ep + 12, sp->length);
+        Tbcx_PutLe32(ep + 20, Tbcx_Crc32c(0, buf + base + sp->offset, (size_t)sp->length));
+    }
+    return 1;
+}
+
+/* CacheFill — map, verify and (for -compress) inflate the file, returning
+ * a new entry with one reference, or NULL when the file cannot be mapped
+ * or does not verify.  The interp result (if ip is not NULL) is left clean
+ * either way: the ordinary load path that runs instead reports the failure
+ * itself. */
+static TbcxCached *CacheFill(Tcl_Interp *ip, Tcl_Obj *pathObj, const TbcxFileId *id) {
+    TbcxMap map;
+    if (!Tbcx_MapFile(pathObj, &map))
+        return NULL;
+    if ((unsigned long long)map.len != id->size) {
+        Tbcx_UnmapFile(&map);
+        return NULL;
+    }
+    size_t off, len; /* an appended payload is cached as its own span */
+    Tbcx_FindPayload(map.base, map.len, &off, &len);
+    TbcxIn     r;
+    TbcxHeader H;
+    memset(&H, 0, sizeof(H));
+    Tbcx_R_InitMem(&r, ip, map.base + off, len);
+    unsigned char *inflated = NULL;
+    int            ok       = Tbcx_ReadHeader(&r, &H) && Tbcx_R_VerifySections(&r, &H);
+    if (ok && (H.flags & TBCX_HDR_FL_LZ)) {
+        inflated = Tbcx_R_Inflate(&r, &H);
+        ok       = inflated && CacheNormalize(map.base + off, inflated, &H);
+    }
+    Tbcx_FreeHeader(&H);
+    if (!ok) {
+        if (inflated)
+            Tcl_Free((char *)inflated);
+        Tbcx_UnmapFile(&map);
+        if (ip)
+            Tcl_ResetResult(ip);
+        return NULL;
+    }
+
+    TbcxCached *ce = (TbcxCached *)Tcl_Alloc(sizeof(TbcxCached));
+    memset(ce, 0, sizeof(*ce));
+    atomic_init(&ce->refCount, 1);
+    ce->id = *id;
+    atomic_init(&ce->checked, Tbcx_FileChecked(id));
+    /* The image may be inflated: take the digest tbcx::trust compares
+     * while the file's own bytes are still at hand, if a registered
+     * artifact could have this length.  An entry filled without one is
+     * dropped when digests are registered (Tbcx_CacheTrustChanged). */
+    if (Tbcx_TrustMayMatch(len)) {
+        Tbcx_Sha256(map.base + off, len, ce->trustHash);
+        ce->hashed = 1;
+    }
+    if (inflated) {
+        Tbcx_UnmapFile(&map);
+        ce->owned = inflated;
+        ce->base  = inflated;
+        ce->len   = r.memLen;
+    } else {
+        ce->map  = map;
+        ce->base = map.base + off;
+        ce->len  = len;
+    }
+    return ce;
+}
+
+#ifdef _WIN32
+/* CacheDetach — replace the mapped image of ce, which is not yet published,
+ * with a private copy, so a cached entry never holds a view of its file.
+ * Returns 0 (ce unchanged) if the copy cannot be allocated. */
+static int CacheDetach(TbcxCached *ce) {
+    if (ce->owned)
+        return 1;
+    unsigned char *copy = (unsigned char *)Tcl_AttemptAlloc(ce->len ? ce->len : 1);
+    if (!copy)
+        return 0;
+    memcpy(copy, ce->base, ce->len);
+    Tbcx_UnmapFile(&ce->map);
+    ce->owned = copy;
+    ce->base  = copy;
+    return 1;
+}
+#endif
+
+static void CacheFree(TbcxCached *ce) {
+    if (ce->owned)
+        Tcl_Free((char *)ce->owned);
+    Tbcx_UnmapFile(&ce->map);
+    Tcl_Free((char *)ce);
+}
+
+/* CacheUnlinkLocked — drop ce from the table and the LRU list and release
+ * the cache's reference.  Users still holding it keep it alive. */
+static void CacheUnlinkLocked(TbcxCached *ce) {
+    Tcl_DeleteHashEntry(ce->entry);
+    ce->entry = NULL;
+    if (ce->prev)
+        ce->prev->next = ce->next;
+    else
+        cacheHead = ce->next;
+    if (ce->next)
+        ce->next->prev = ce->prev;
+    else
+        cacheTail = ce->prev;
+    ce->prev = ce->next = NULL;
+    cacheBytes -= ce->len;
+    Tbcx_CacheRelease(ce);
+}
+
+/* CacheFinalize — exit handler: release every entry the cache holds. */
+static void CacheFinalize(TCL_UNUSED(void *)) {
+    Tcl_MutexLock(&tbcxCacheMutex);
+    while (cacheHead)
+        CacheUnlinkLocked(cacheHead);
+    if (cacheInit) {
+        Tcl_DeleteHashTable(&cacheTable);
+        cacheInit = 0;
+    }
+    cacheClosed = 1;
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+}
+
+/* ==========================================================================
+ * Lookup
+ * ========================================================================== */
+
+/* CacheLookup — the cached image for pathObj, filling the cache on a miss.
+ * An oversized file yields a private image; so does one modified too
+ * recently to cache, or any file while the cache is disabled, but only when
+ * any is set (NULL otherwise). */
+static TbcxCached *CacheLookup(Tcl_Interp *ip, Tcl_Obj *pathObj, int any) {
+    if (!atomic_load_explicit(&cacheEnabled, memory_order_relaxed) && !any)
+        return NULL;
+    Tcl_Obj   *norm = Tcl_FSGetNormalizedPath(NULL, pathObj);
+    TbcxFileId id;
+    if (!norm || !CacheStat(pathObj, &id))
+        return NULL;
+    if (!atomic_load_explicit(&cacheEnabled, memory_order_relaxed))
+        return CacheFill(ip, pathObj, &id);
+    const char *key = Tcl_GetString(norm);
+
+    Tcl_MutexLock(&tbcxCacheMutex);
+    Tcl_HashEntry *e = cacheInit ? Tcl_FindHashEntry(&cacheTable, key) : NULL;
+    if (e) {
+        TbcxCached *ce = (TbcxCached *)Tcl_GetHashValue(e);
+        if (CacheSameId(&ce->id, &id)) {
+            atomic_fetch_add_explicit(&ce->refCount, 1, memory_order_relaxed);
+            if (ce != cacheHead) {
+                ce->prev->next = ce->next;
+                if (ce->next)
+                    ce->next->prev = ce->prev;
+                else
+                    cacheTail = ce->prev;
+                ce->prev        = NULL;
+                ce->next        = cacheHead;
+                cacheHead->prev = ce;
+                cacheHead       = ce;
+            }
+            cacheHits++;
+            Tcl_MutexUnlock(&tbcxCacheMutex);
+            return ce;
+        }
+        CacheUnlinkLocked(ce); /* the file changed */
+    }
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+
+    if (!CacheSettled(&id))
+        return any ? CacheFill(ip, pathObj, &id) : NULL;
+    TbcxCached *ce = CacheFill(ip, pathObj, &id);
+    if (!ce || ce->len > TBCX_CACHE_MAX_BYTES)
+        return ce; /* too big to keep: this load only */
+#ifdef _WIN32
+    if (!CacheDetach(ce))
+        return ce;
+#endif
+
+    Tcl_MutexLock(&tbcxCacheMutex);
+    if (cacheClosed || !atomic_load_explicit(&cacheEnabled, memory_order_relaxed)) {
+        Tcl_MutexUnlock(&tbcxCacheMutex);
+        return ce;
+    }
+    if (!cacheInit) {
+        Tcl_InitHashTable(&cacheTable, TCL_STRING_KEYS);
+        cacheInit = 1;
+        Tcl_CreateExitHandler(CacheFinalize, NULL);
+    }
+    int isNew;
+    e = Tcl_CreateHashEntry(&cacheTable, key, &isNew);
+    if (!isNew) { /* another thread filled it meanwhile: newest wins */
+        CacheUnlinkLocked((TbcxCached *)Tcl_GetHashValue(e));
+        e = Tcl_CreateHashEntry(&cacheTable, key, &isNew);
+    }
+    atomic_fetch_add_explicit(&ce->refCount, 1, memory_order_relaxed);
+    Tcl_SetHashValue(e, ce);
+    ce->entry = e;
+    ce->next  = cacheHead;
+    if (cacheHead)
+        cacheHead->prev = ce;
+    cacheHead = ce;
+    if (!cacheTail)
+        cacheTail = ce;
+    cacheBytes += ce->len;
+    cacheMisses++;
+    while (cacheBytes > TBCX_CACHE_MAX_BYTES && cacheTail != ce)
+        CacheUnlinkLocked(cacheTail);
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+    return ce;
+}
+
+/* Tbcx_CacheGet — the verified image of the artifact file at pathObj, with
+ * a reference for the caller (Tbcx_CacheRelease), or NULL when the caller
+ * should load the file itself: the cache is disabled, the path does not
+ * name a settled regular file, or it cannot be mapped or does not verify.
+ * Never sets an error.  ip may be NULL (tbcx::prefetch calls this off the interp
+ * thread). */
+TbcxCached *Tbcx_CacheGet(Tcl_Interp *ip, Tcl_Obj *pathObj) {
+    return CacheLookup(ip, pathObj, 0);
+}
+
+/* Tbcx_CacheFetch — Tbcx_CacheGet for a caller that wants the verified
+ * image even when the cache will not keep it (tbcx::preload): a freshly
+ * written file, or any file while the cache is disabled, comes back as a
+ * private image, freed with its last reference.  NULL only when the file cannot be mapped or does not verify.
+ * Needs no interp. */
+TbcxCached *Tbcx_CacheFetch(Tcl_Obj *pathObj) {
+    return CacheLookup(NULL, pathObj, 1);
+}
+
+/* Tbcx_CacheTrustChanged — tbcx::trust registered digests: drop every
+ * entry filled without a digest, so the next load of its file refills it
+ * and hashes it if it could now be trusted. */
+void Tbcx_CacheTrustChanged(void) {
+    Tcl_MutexLock(&tbcxCacheMutex);
+    for (TbcxCached *ce = cacheHead, *next; ce; ce = next) {
+        next = ce->next;
+        if (!ce->hashed)
+            CacheUnlinkLocked(ce);
+    }
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+}
+
+/* Tbcx_CacheRelease — drop one reference; the last frees the image. */
+void Tbcx_CacheRelease(TbcxCached *ce) {
+    if (ce && atomic_fetch_sub_explicit(&ce->refCount, 1, memory_order_acq_rel) == 1)
+        CacheFree(ce);
+}
+
+/* ==========================================================================
+ * Prefetch
+ *
+ * tbcx::prefetch moves the slow part of a first load off the interp thread:
+ * a thread per call reads each file into the page cache and, under -cache,
+ * fills the artifact cache with its verified image, so the tbcx::load that
+ * follows only decodes.  Completion is reported as an event queued to the
+ * interp thread; nothing waits for it.  The threads are joinable: each is
+ * joined by the first tbcx::prefetch after it finishes, and at process
+ * exit the ones still reading are told to stop and joined.
+ * ========================================================================== */
+
+/* PrefetchPages — bring the file at pathObj into the page cache.  Returns
+ * 0 when it cannot be mapped (Tbcx_MapFile). */
+static int PrefetchPages(Tcl_Obj *pathObj) {
+    TbcxMap map;
+    if (!Tbcx_MapFile(pathObj, &map))
+        return 0;
+#if !defined(_WIN32) && defined(MADV_WILLNEED)
+    (void)madvise((void *)map.base, map.len, MADV_WILLNEED);
+#endif
+    /* The hint is only a hint: touch a byte per page so the file is
+     * resident by the time this thread reports. */
+    volatile unsigned char sink = 0;
+    for (size_t i = 0; i < map.len; i += 4096)
+        sink ^= map.base[i];
+    (void)sink;
+    Tbcx_UnmapFile(&map);
+    return 1;
+}
+
+/* PrefetchCached — Tbcx_CacheGet for the prefetch thread: 1 when the file's
+ * image is in the cache afterwards (not too big, settled, verified). */
+static int PrefetchCached(Tcl_Obj *pathObj) {
+    TbcxCached *ce = Tbcx_CacheGet(NULL, pathObj);
+    if (!ce)
+        return 0;
+    Tcl_MutexLock(&tbcxCacheMutex);
+    int kept = ce->entry != NULL;
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+    Tbcx_CacheRelease(ce);
+    return kept;
+}
+
+static Tcl_ThreadCreateType PrefetchThread(void *cd) {
+    TbcxPrefetch    *pf  = (TbcxPrefetch *)cd;
+    TbcxPrefetchRun *run = pf->run; /* pf may be gone by the time we are */
+    int              stop = 0;
+    for (Tcl_Size i = 0; i < pf->numPaths; i++) {
+        if (atomic_load_explicit(&prefetchStop, memory_order_relaxed)) {
+            stop = 1;
+            break;
+        }
+        Tcl_Obj *pathObj = Tcl_NewStringObj(pf->paths[i], -1);
+        Tcl_IncrRefCount(pathObj);
+        if (pf->cache && PrefetchCached(pathObj))
+            pf->status[i] = TBCX_PF_CACHED;
+        else
+            pf->status[i] = PrefetchPages(pathObj) ? TBCX_PF_READ : TBCX_PF_FAILED;
+        Tcl_DecrRefCount(pathObj);
+    }
+    /* Queued under the mutex, so a cancel either sees the event in the
+     * owner's queue or stops it from being queued at all.  The event takes
+     * over this thread's reference.  Nothing is reported once the process
+     * is exiting. */
+    int queued = 0;
+    Tcl_MutexLock(&tbcxPrefetchMutex);
+    if (pf->report && !pf->cancelled && !stop) {
+        TbcxPrefetchEvent *ev = (TbcxPrefetchEvent *)Tcl_Alloc(sizeof(TbcxPrefetchEvent));
+        ev->header.proc       = PrefetchEventProc;
+        ev->header.nextPtr    = NULL;
+        ev->pf                = pf;
+        Tcl_ThreadQueueEvent(pf->owner, (Tcl_Event *)ev, TCL_QUEUE_TAIL);
+        Tcl_ThreadAlert(pf->owner);
+        queued = 1;
+    }
+    Tcl_MutexUnlock(&tbcxPrefetchMutex);
+    if (!queued)
+        PrefetchRelease(pf);
+    Tcl_MutexLock(&tbcxPrefetchMutex);
+    run->done = 1;
+    Tcl_MutexUnlock(&tbcxPrefetchMutex);
+    Tcl_ExitThread(0);
+    TCL_THREAD_CREATE_RETURN;
+}
+
+/* PrefetchJoin — join and free every thread on the list runs. */
+static void PrefetchJoin(TbcxPrefetchRun *runs) {
+    while (runs) {
+        TbcxPrefetchRun *next = runs->next;
+        int              code;
+        Tcl_JoinThread(runs->id, &code);
+        Tcl_Free((char *)runs);
+        runs = next;
+    }
+}
+
+/* PrefetchReap — join the prefetch threads that have finished. */
+static void PrefetchReap(void) {
+    TbcxPrefetchRun *done = NULL;
+    Tcl_MutexLock(&tbcxPrefetchMutex);
+    for (TbcxPrefetchRun **pp = &prefetchRuns; *pp;) {
+        TbcxPrefetchRun *run = *pp;
+        if (run->done) {
+            *pp       = run->next;
+            run->next = done;
+            done      = run;
+        } else {
+            pp = &run->next;
+        }
+    }
+    Tcl_MutexUnlock(&tbcxPrefetchMutex);
+    PrefetchJoin(done);
+}
+
+/* PrefetchFinalize — exit handler: stop the prefetch threads after the
+ * file each is on, and join them all.  None of them holds a lock while it
+ * is waited for. */
+static void PrefetchFinalize(TCL_UNUSED(void *)) {
+    atomic_store_explicit(&prefetchStop, 1, memory_order_relaxed);
+    Tcl_MutexLock(&tbcxPrefetchMutex);
+    TbcxPrefetchRun *runs = prefetchRuns;
+    prefetchRuns          = NULL;
+    prefetchClosed        = 1;
+    Tcl_MutexUnlock(&tbcxPrefetchMutex);
+    PrefetchJoin(runs);
+}
+
+/* PrefetchEventProc — on the owner thread: run the -command prefix with
+ * the report appended, at global level.  An error goes to the background
+ * error handler.  Skipped if the call was cancelled meanwhile. */
+static int PrefetchEventProc(Tcl_Event *evPtr, TCL_UNUSED(int)) {
+    TbcxPrefetch *pf = ((TbcxPrefetchEvent *)evPtr)->pf;
+    Tcl_MutexLock(&tbcxPrefetchMutex);
+    int live      = !pf->cancelled;
+    pf->cancelled = 1;
+    Tcl_MutexUnlock(&tbcxPrefetchMutex);
+    if (live) {
+        Tcl_Interp *interp = pf->interp;
+        Tcl_Obj    *prefix = pf->cmd;
+        PrefetchUnlink((TbcxPrefetchTsd *)Tcl_GetThreadData(&prefetchKey, sizeof(TbcxPrefetchTsd)), pf);
+        if (!Tcl_InterpDeleted(interp)) {
+            static const char *const names[] = {"failed", "read", "cached"};
+            Tcl_Obj                 *report  = Tcl_NewDictObj();
+            for (Tcl_Size i = 0; i < pf->numPaths; i++)
+                Tcl_DictObjPut(NULL, report, Tcl_NewStringObj(pf->names[i], -1), Tcl_NewStringObj(names[pf->status[i]], -1));
+            Tcl_Obj *cmd = Tcl_DuplicateObj(prefix);
+            Tcl_IncrRefCount(cmd);
+            Tcl_ListObjAppendElement(NULL, cmd, report);
+            Tcl_Preserve(interp);
+            int rc = Tcl_EvalObjEx(interp, cmd, TCL_EVAL_GLOBAL);
+            if (rc != TCL_OK)
+                Tcl_BackgroundException(interp, rc);
+            Tcl_Release(interp);
+            Tcl_DecrRefCount(cmd);
+        }
+        Tcl_DecrRefCount(prefix);
+        PrefetchRelease(pf); /* the owner list's reference */
+    }
+    PrefetchRelease(pf); /* the event's */
+    return 1;
+}
+
+/* PrefetchEventDelete — Tcl_DeleteEvents filter for a thread going away:
+ * take every pending report event off the queue, chaining its call onto
+ * the list at cd.  The references are dropped once the queue is unlocked
+ * again, as PrefetchRelease takes tbcxPrefetchMutex. */
+static int PrefetchEventDelete(Tcl_Event *evPtr, void *cd) {
+    if (evPtr->proc != PrefetchEventProc)
+        return 0;
+    TbcxPrefetch **dead = (TbcxPrefetch **)cd;
+    TbcxPrefetch  *pf   = ((TbcxPrefetchEvent *)evPtr)->pf;
+    pf->next            = *dead; /* cancelled, so off the owner list */
+    *dead               = pf;
+    return 1;
+}
+
+static void PrefetchUnlink(TbcxPrefetchTsd *tsd, TbcxPrefetch *pf) {
+    if (pf->prev)
+        pf->prev->next = pf->next;
+    else
+        tsd->head = pf->next;
+    if (pf->next)
+        pf->next->prev = pf->prev;
+    pf->prev = pf->next = NULL;
+}
+
+/* PrefetchCancel — on the owner thread: call off pf's report and let go of
+ * its interp and command.  The prefetch thread finishes its reads and
+ * frees pf with the last reference. */
+static void PrefetchCancel(TbcxPrefetchTsd *tsd, TbcxPrefetch *pf) {
+    Tcl_MutexLock(&tbcxPrefetchMutex);
+    pf->cancelled = 1;
+    Tcl_MutexUnlock(&tbcxPrefetchMutex);
+    PrefetchUnlink(tsd, pf);
+    Tcl_DecrRefCount(pf->cmd);
+    pf->cmd    = NULL;
+    pf->interp = NULL;
+    PrefetchRelease(pf);
+}
+
+/* PrefetchInterpDeleted — assoc data delete callback: cancel the reports
+ * still due to interp. */
+static void PrefetchInterpDeleted(TCL_UNUSED(void *), Tcl_Interp *interp) {
+    TbcxPrefetchTsd *tsd = (TbcxPrefetchTsd *)Tcl_GetThreadData(&prefetchKey, sizeof(TbcxPrefetchTsd));
+    for (TbcxPrefetch *pf = tsd->head, *next; pf; pf = next) {
+        next = pf->next;
+        if (pf->interp == interp)
+            PrefetchCancel(tsd, pf);
+    }
+}
+
+/* PrefetchThreadExit — thread exit handler: cancel every report still due
+ * on this thread and drop the events already queued for them, which the
+ * notifier would otherwise free without running. */
+static void PrefetchThreadExit(TCL_UNUSED(void *)) {
+    TbcxPrefetchTsd *tsd = (TbcxPrefetchTsd *)Tcl_GetThreadData(&prefetchKey, sizeof(TbcxPrefetchTsd));
+    while (tsd->head)
+        PrefetchCancel(tsd, tsd->head);
+    tsd->exitHandler  = 0;
+    TbcxPrefetch *dead = NULL;
+    Tcl_DeleteEvents(PrefetchEventDelete, &dead);
+    while (dead) {
+        TbcxPrefetch *next = dead->next;
+        PrefetchRelease(dead);
+        dead = next;
+    }
+}
+
+/* PrefetchRelease — drop one reference; the last frees pf. */
+static void PrefetchRelease(TbcxPrefetch *pf) {
+    Tcl_MutexLock(&tbcxPrefetchMutex);
+    int last = --pf->refCount == 0;
+    Tcl_MutexUnlock(&tbcxPrefetchMutex);
+    if (last)
+        PrefetchFree(pf);
+}
+
+/* PrefetchFree — release everything but interp and cmd, which the owner
+ * thread lets go of itself. */
+static void PrefetchFree(TbcxPrefetch *pf) {
+    for (Tcl_Size i = 0; i < pf->numPaths; i++) {
+        Tcl_Free(pf->names[i]);
+        Tcl_Free(pf->paths[i]);
+    }
+    Tcl_Free((char *)pf->names);
+    Tcl_Free((char *)pf->paths);
+    Tcl_Free((char *)pf->status);
+    Tcl_Free((char *)pf);
+}
+
+/* ==========================================================================
+ * Tcl command: tbcx::cache
+ *
+ * Synopsis:   tbcx::cache ?flush? | tbcx::cache enable boolean
+ * Arguments:  flush  — drop every entry and forget which files have been
+ *                      validated.  Loads in progress keep the images they
+ *                      hold.
+ *             enable — turn the cache on or off for the whole process.
+ *                      Off (the default) also drops every entry.
+ * Returns:    A dict: enabled, entries, bytes (images held), hits and
+ *             misses (images filled) since the process started, and
+ *             checked (files whose operands have been validated).  The cache
+ *             is process-wide, so the figures cover every interp and thread.
+ * Errors:     TCL_ERROR on a bad argument.
+ * Thread:     Must be called on the interp-owning thread.
+ * ========================================================================== */
+
+int Tbcx_CacheObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_CHECK_INTERP_THREAD(interp);
+    static const char *const subs[] = {"enable", "flush", NULL};
+    enum { SUB_ENABLE, SUB_FLUSH };
+    int idx = -1, on = 0;
+    if (objc > 3) {
+        Tcl_WrongNumArgs(interp, 1, objv, "?flush? | enable boolean");
+        return TCL_ERROR;
+    }
+    if (objc >= 2 && Tcl_GetIndexFromObj(interp, objv[1], subs, "subcommand", 0, &idx) != TCL_OK)
+        return TCL_ERROR;
+    if ((idx == SUB_ENABLE) != (objc == 3)) {
+        Tcl_WrongNumArgs(interp, 2, objv, idx == SUB_ENABLE ? "boolean" : NULL);
+        return TCL_ERROR;
+    }
+    if (idx == SUB_ENABLE && Tcl_GetBooleanFromObj(interp, objv[2], &on) != TCL_OK)
+        return TCL_ERROR;
+
+    Tcl_MutexLock(&tbcxCacheMutex);
+    if (idx == SUB_ENABLE)
+        atomic_store_explicit(&cacheEnabled, on, memory_order_relaxed);
+    if (idx == SUB_FLUSH || (idx == SUB_ENABLE && !on)) {
+        while (cacheHead)
+            CacheUnlinkLocked(cacheHead);
+    }
+    if (idx == SUB_FLUSH && checkedInit) {
+        Tcl_DeleteHashTable(&checkedTable);
+        Tcl_InitHashTable(&checkedTable, (int)(sizeof(TbcxFileId) / sizeof(int)));
+    }
+    int         enabled = atomic_load_explicit(&cacheEnabled, memory_order_relaxed);
+    Tcl_Size    entries = cacheInit ? cacheTable.numEntries : 0;
+    Tcl_Size    checked = checkedInit ? checkedTable.numEntries : 0;
+    size_t      bytes   = cacheBytes;
+    Tcl_WideInt hits = cacheHits, misses = cacheMisses;
+    Tcl_MutexUnlock(&tbcxCacheMutex);
+
+    Tcl_Obj *res = Tcl_NewDictObj();
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("enabled", -1), Tcl_NewBooleanObj(enabled));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("entries", -1), Tcl_NewWideIntObj((Tcl_WideInt)entries));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("bytes", -1), Tcl_NewWideIntObj((Tcl_WideInt)bytes));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("hits", -1), Tcl_NewWideIntObj(hits));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("misses", -1), Tcl_NewWideIntObj(misses));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("checked", -1), Tcl_NewWideIntObj((Tcl_WideInt)checked));
+    Tcl_SetObjResult(interp, res);
+    return TCL_OK;
+}
+
+/* ==========================================================================
+ * Tcl command: tbcx::prefetch
+ *
+ * Synopsis:   tbcx::prefetch ?-cache? ?-command cmd? ?--? path ?path ...?
+ * Arguments:  -cache    — also fill the artifact cache (tbcx::cache) with
+ *                         each settled file's verified image, if the cache
+ *                         is enabled.
+ *             -command  — on completion, evaluate cmd at global level
+ *                         with a dict appended: each path as given, mapped
+ *                         to cached, read (in the page cache only) or
+ *                         failed (could not be read).  Not run if the
+ *                         interp is deleted, or its thread exits, first.
+ *             --        — ends the options.
+ *             path      — artifact files; not checked until they are read.
+ * Returns:    The empty string, at once: the files are read on a thread
+ *             of this call's own, joined once it is done or at exit.  A damaged artifact is not reported here;
+ *             it stays out of the cache and tbcx::load reports it.
+ * Errors:     TCL_ERROR on bad arguments or if the thread cannot start.
+ * Thread:     Must be called on the interp-owning thread.  The -command
+ *             report needs the event loop.
+ * ========================================================================== */
+
+int Tbcx_PrefetchObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_CHECK_INTERP_THREAD(interp);
+    static const char *const opts[] = {"-cache", "-command", NULL};
+    enum { OPT_CACHE, OPT_COMMAND };
+    int      cache = 0;
+    Tcl_Obj *cmd   = NULL;
+    Tcl_Size i     = 1;
+    for (; i < objc; i++) {
+        const char *a = Tcl_GetString(objv[i]);
+        int         idx;
+        if (a[0] != '-')
+            break;
+        if (strcmp(a, "--") == 0) {
+            i++;
+            break;
+        }
+        if (Tcl_GetIndexFromObj(interp, objv[i], opts, "option", 0, &idx) != TCL_OK)
+            return TCL_ERROR;
+        if (idx == OPT_CACHE) {
+            cache = 1;
+        } else {
+            if (++i >= objc)
+                break;
+            cmd = objv[i];
+        }
+    }
+    if (i >= objc) {
+        Tcl_WrongNumArgs(interp, 1, objv, "?-cache? ?-command cmd? ?--? path ?path ...?");
+        return TCL_ERROR;
+    }
+    if (cmd) {
+        Tcl_Size n;
+        if (Tcl_ListObjLength(interp, cmd, &n) != TCL_OK)
+            return TCL_ERROR;
+    }
+
+    TbcxPrefetch *pf = (TbcxPrefetch *)Tcl_Alloc(sizeof(TbcxPrefetch));
+    memset(pf, 0, sizeof(*pf));
+    pf->interp   = interp;
+    pf->owner    = Tcl_GetCurrentThread();
+    pf->cache    = cache;
+    pf->numPaths = objc - i;
+    pf->names    = (char **)Tcl_Alloc(sizeof(char *) * (size_t)pf->numPaths);
+    pf->paths    = (char **)Tcl_Alloc(sizeof(char *) * (size_t)pf->numPaths);
+    pf->status   = (int *)Tcl_Alloc(sizeof(int) * (size_t)pf->numPaths);
+    for (Tcl_Size k = 0; k < pf->numPaths; k++) {
+        Tcl_Obj    *norm = Tcl_FSGetNormalizedPath(NULL, objv[i + k]);
+        Tcl_Size    nameLen, pathLen;
+        const char *name = Tcl_GetStringFromObj(objv[i + k], &nameLen);
+        const char *path = norm ? Tcl_GetStringFromObj(norm, &pathLen) : name;
+        if (!norm)
+            pathLen = nameLen;
+        pf->names[k] = (char *)Tcl_Alloc((size_t)nameLen + 1);
+        memcpy(pf->names[k], name, (size_t)nameLen + 1);
+        pf->paths[k] = (char *)Tcl_Alloc((size_t)pathLen + 1);
+        memcpy(pf->paths[k], path, (size_t)pathLen + 1);
+        pf->status[k] = TBCX_PF_FAILED;
+    }
+
+    pf->refCount = 1; /* the prefetch thread's */
+    TbcxPrefetchTsd *tsd = NULL;
+    if (cmd) { /* released by PrefetchEventProc or PrefetchCancel */
+        pf->cmd    = cmd;
+        pf->report = 1;
+        pf->refCount++;
+        Tcl_IncrRefCount(cmd);
+        tsd = (TbcxPrefetchTsd *)Tcl_GetThreadData(&prefetchKey, sizeof(TbcxPrefetchTsd));
+        pf->next = tsd->head;
+        if (tsd->head)
+            tsd->head->prev = pf;
+        tsd->head = pf;
+        if (!tsd->exitHandler) {
+            Tcl_CreateThreadExitHandler(PrefetchThreadExit, NULL);
+            tsd->exitHandler = 1;
+        }
+        if (!Tcl_GetAssocData(interp, TBCX_PREFETCH_KEY, NULL))
+            Tcl_SetAssocData(interp, TBCX_PREFETCH_KEY, PrefetchInterpDeleted, interp);
+    }
+
+    /* Created under the mutex and listed before the thread can mark itself
+     * done, so it is joined however soon it finishes. */
+    PrefetchReap();
+    TbcxPrefetchRun *run = (TbcxPrefetchRun *)Tcl_Alloc(sizeof(TbcxPrefetchRun));
+    run->done            = 0;
+    pf->run              = run;
+    Tcl_MutexLock(&tbcxPrefetchMutex);
+    int ok = !prefetchClosed && Tcl_CreateThread(&run->id, PrefetchThread, pf, TCL_THREAD_STACK_DEFAULT, TCL_THREAD_JOINABLE) == TCL_OK;
+    if (ok) {
+        run->next    = prefetchRuns;
+        prefetchRuns = run;
+        if (!prefetchExitHandler) {
+            Tcl_CreateExitHandler(PrefetchFinalize, NULL);
+            prefetchExitHandler = 1;
+        }
+    }
+    Tcl_MutexUnlock(&tbcxPrefetchMutex);
+    if (!ok) {
+        Tcl_Free((char *)run);
+        if (cmd) {
+            PrefetchUnlink(tsd, pf);
+            Tcl_DecrRefCount(cmd);
+        }
+        PrefetchFree(pf);
+        Tcl_SetObjResult(interp, Tcl_NewStringObj("tbcx::prefetch: cannot start a thread", -1));
+        return TCL_ERROR;
+    }
+    return TCL_OK;
+}
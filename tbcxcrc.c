@@ -0,0 +1,184 @@
+/* ==========================================================================
+ * tbcxcrc.c — CRC32C (Castagnoli) section checksums for .tbcx (Tcl 9.1)
+ *
+ * Every section in the directory carries the CRC32C of its stored bytes.
+ * The polynomial is the one SSE4.2 (crc32 instruction) and ARMv8 (crc32c*)
+ * implement in hardware; Tbcx_CrcInit picks the hardware path when the CPU
+ * has it and falls back to slice-by-8 tables otherwise.  All paths return
+ * identical values, and Tbcx_Crc32c chains: crc(a || b) ==
+ * Tbcx_Crc32c(Tbcx_Crc32c(0, a), b).
+ * ========================================================================== */
+
+#include "tbcx.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define TBCX_CRC_X86 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <nmmintrin.h>
+#define TBCX_CRC_TARGET
+#else
+#include <nmmintrin.h>
+#define TBCX_CRC_TARGET __attribute__((target("sse4.2")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define TBCX_CRC_ARM 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <arm64_neon.h>
+#define TBCX_CRC_TARGET
+#else
+#include <arm_acle.h>
+#if defined(__clang__)
+#define TBCX_CRC_TARGET __attribute__((target("crc")))
+#else
+#define TBCX_CRC_TARGET __attribute__((target("+crc")))
+#endif
+#endif
+#if defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1u << 7)
+#endif
+#endif
+#endif
+
+#define CRC32C_POLY 0x82F63B78u /* reflected Castagnoli polynomial */
+
+typedef uint32_t (*TbcxCrcFn)(uint32_t crc, const unsigned char *p, size_t n);
+
+static uint32_t  crcTable[8][256];
+static TbcxCrcFn crcFn   = NULL; /* set once by Tbcx_CrcInit */
+static const char *crcImpl = "slice-by-8";
+
+/* ==========================================================================
+ * Software: slice-by-8
+ * ========================================================================== */
+
+static inline uint32_t CrcLoad32(const unsigned char *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t CrcSlice8(uint32_t crc, const unsigned char *p, size_t n) {
+    while (n && ((uintptr_t)p & 7u)) {
+        crc = (crc >> 8) ^ crcTable[0][(crc ^ *p++) & 0xFFu];
+        n--;
+    }
+    while (n >= 8u) {
+        uint32_t a = crc ^ CrcLoad32(p);
+        uint32_t b = CrcLoad32(p + 4);
+        crc        = crcTable[7][a & 0xFFu] ^ crcTable[6][(a >> 8) & 0xFFu] ^ crcTable[5][(a >> 16) & 0xFFu] ^ crcTable[4][a >> 24] ^ crcTable[3][b & 0xFFu] ^
+              crcTable[2][(b >> 8) & 0xFFu] ^ crcTable[1][(b >> 16) & 0xFFu] ^ crcTable[0][b >> 24];
+        p += 8;
+        n -= 8u;
+    }
+    while (n--)
+        crc = (crc >> 8) ^ crcTable[0][(crc ^ *p++) & 0xFFu];
+    return crc;
+}
+
+/* ==========================================================================
+ * Hardware
+ * ========================================================================== */
+
+#if defined(TBCX_CRC_X86)
+TBCX_CRC_TARGET static uint32_t CrcSse42(uint32_t crc, const unsigned char *p, size_t n) {
+    uint64_t c = crc;
+    while (n && ((uintptr_t)p & 7u)) {
+        c = _mm_crc32_u8((uint32_t)c, *p++);
+        n--;
+    }
+    while (n >= 8u) {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        c = _mm_crc32_u64(c, v);
+        p += 8;
+        n -= 8u;
+    }
+    while (n--)
+        c = _mm_crc32_u8((uint32_t)c, *p++);
+    return (uint32_t)c;
+}
+
+static int CrcHaveHw(void) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] >> 20) & 1;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2");
+#endif
+}
+#define CrcHw CrcSse42
+#define CRC_HW_NAME "sse4.2"
+
+#elif defined(TBCX_CRC_ARM)
+TBCX_CRC_TARGET static uint32_t CrcArmv8(uint32_t crc, const unsigned char *p, size_t n) {
+    while (n && ((uintptr_t)p & 7u)) {
+        crc = __crc32cb(crc, *p++);
+        n--;
+    }
+    while (n >= 8u) {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        crc = __crc32cd(crc, v);
+        p += 8;
+        n -= 8u;
+    }
+    while (n--)
+        crc = __crc32cb(crc, *p++);
+    return crc;
+}
+
+static int CrcHaveHw(void) {
+#if defined(__AARCH64EB__)
+    return 0; /* the 8-byte step below assumes little-endian words */
+#elif defined(__ARM_FEATURE_CRC32) || defined(__APPLE__) || defined(_WIN32)
+    return 1; /* baseline on these targets */
+#elif defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#else
+    return 0;
+#endif
+}
+#define CrcHw CrcArmv8
+#define CRC_HW_NAME "armv8-crc"
+#endif
+
+/* ==========================================================================
+ * Entry points
+ * ========================================================================== */
+
+/* Tbcx_CrcInit — build the tables and select the implementation.  Called
+ * once from TbcxInitTypes under tbcxTypeMutex, before any save or load. */
+void Tbcx_CrcInit(void) {
+    if (crcFn)
+        return;
+    for (uint32_t i = 0; i < 256u; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++)
+            c = (c & 1u) ? (c >> 1) ^ CRC32C_POLY : (c >> 1);
+        crcTable[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256u; i++) {
+        for (int t = 1; t < 8; t++)
+            crcTable[t][i] = (crcTable[t - 1][i] >> 8) ^ crcTable[0][crcTable[t - 1][i] & 0xFFu];
+    }
+#if defined(TBCX_CRC_X86) || defined(TBCX_CRC_ARM)
+    if (CrcHaveHw()) {
+        crcImpl = CRC_HW_NAME;
+        crcFn   = CrcHw;
+        return;
+    }
+#endif
+    crcFn = CrcSlice8;
+}
+
+/* Tbcx_CrcImpl — name of the selected implementation, for diagnostics. */
+const char *Tbcx_CrcImpl(void) {
+    return crcImpl;
+}
+
+uint32_t Tbcx_Crc32c(uint32_t crc, const void *p, size_t n) {
+    return ~crcFn(~crc, (const unsigned char *)p, n);
+}
@@ -17,15 +17,36 @@ static void DumpBCDetails(Tcl_Obj *bcObj, Tcl_Obj *dst);
 static void DumpExceptions(ExceptionRange *exArr, uint32_t numEx, Tcl_Obj *dst);
 static int  DumpLiteralValue(Tcl_Obj *lit, Tcl_Obj *dst);
 static void DumpLocals(ByteCode *bc, Tcl_Obj *dst);
+static const char *SectionKindName(uint32_t kind);
 static int  DumpProcsSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out);
 static int  DumpClassesSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out);
 static int  DumpMethodsSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out);
 int         Tbcx_DumpObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+int         Tbcx_VerifyObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+int         Tbcx_InfoObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
 
 /* ==========================================================================
  * Dump Helpers
  * ========================================================================== */
 
+/* SectionKindName — the directory name of a TBCX_SEC_* kind. */
+static const char *SectionKindName(uint32_t kind) {
+    switch (kind) {
+    case TBCX_SEC_STRINGS:
+        return "strings";
+    case TBCX_SEC_TOP:
+        return "top";
+    case TBCX_SEC_PROC:
+        return "proc";
+    case TBCX_SEC_CLASSES:
+        return "classes";
+    case TBCX_SEC_METHOD:
+        return "method";
+    default:
+        return "?";
+    }
+}
+
 static void AppendEscaped(Tcl_Obj *dst, const char *s, Tcl_Size n) {
     Tcl_DString ds;
     Tcl_DStringInit(&ds);
@@ -628,39 +649,19 @@ static void DisassembleBCObj(Tcl_Obj *bcObj, Tcl_Obj *dst, const char *title) {
 
 static int DumpProcsSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out) {
     uint32_t numProcs = 0;
-    if (!Tbcx_R_U32(r, &numProcs))
+    if (!Tbcx_R_Var(r, &numProcs))
         return TCL_ERROR;
     Tcl_AppendPrintfToObj(out, "\nProcs: %u\n", numProcs);
 
     for (uint32_t i = 0; i < numProcs; i++) {
-        char    *nameC = NULL;
-        uint32_t nameL = 0;
-        char    *nsC   = NULL;
-        uint32_t nsL   = 0;
-        char    *argsC = NULL;
-        uint32_t argsL = 0;
-
-        if (!Tbcx_R_LPString(r, &nameC, &nameL))
-            return TCL_ERROR;
-        if (!Tbcx_R_LPString(r, &nsC, &nsL)) {
-            Tcl_Free(nameC);
-            return TCL_ERROR;
-        }
-        if (!Tbcx_R_LPString(r, &argsC, &argsL)) {
-            Tcl_Free(nameC);
-            Tcl_Free(nsC);
+        Tcl_Obj *nameFqn = NULL;
+        Tcl_Obj *nsObj   = NULL;
+        Tcl_Obj *argsObj = NULL;
+        if (!Tbcx_R_StrRef(r, &nameFqn) || !Tbcx_R_StrRef(r, &nsObj) || !Tbcx_R_StrRef(r, &argsObj))
             return TCL_ERROR;
-        }
-
-        Tcl_Obj *nameFqn = Tcl_NewStringObj(nameC, (Tcl_Size)nameL);
         Tcl_IncrRefCount(nameFqn);
-        Tcl_Obj *nsObj = Tcl_NewStringObj(nsC, (Tcl_Size)nsL);
         Tcl_IncrRefCount(nsObj);
-        Tcl_Obj *argsObj = Tcl_NewStringObj(argsC, (Tcl_Size)argsL);
         Tcl_IncrRefCount(argsObj);
-        Tcl_Free(nameC);
-        Tcl_Free(nsC);
-        Tcl_Free(argsC);
 
         Tcl_AppendToObj(out, "  - proc ", -1);
         Tcl_AppendObjToObj(out, nameFqn);
@@ -719,24 +720,21 @@ static int DumpProcsSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out) {
 static int DumpClassesSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out) {
     (void)interp; /* currently unused — classes section is metadata only */
     uint32_t numClasses = 0;
-    if (!Tbcx_R_U32(r, &numClasses))
+    if (!Tbcx_R_Var(r, &numClasses))
         return TCL_ERROR;
     Tcl_AppendPrintfToObj(out, "\nClasses: %u\n", numClasses);
 
     for (uint32_t c = 0; c < numClasses; c++) {
-        char    *cls = NULL;
-        uint32_t cl  = 0;
-        if (!Tbcx_R_LPString(r, &cls, &cl))
+        Tcl_Obj *clsObj = NULL;
+        if (!Tbcx_R_StrRef(r, &clsObj))
             return TCL_ERROR;
-        Tcl_Obj *clsObj = Tcl_NewStringObj(cls, (Tcl_Size)cl);
         Tcl_IncrRefCount(clsObj);
-        Tcl_Free(cls);
         Tcl_AppendToObj(out, "  - class ", -1);
         Tcl_AppendObjToObj(out, clsObj);
         Tcl_AppendToObj(out, "\n", 1);
 
         uint32_t nSup = 0;
-        if (!Tbcx_R_U32(r, &nSup)) {
+        if (!Tbcx_R_Var(r, &nSup)) {
             Tcl_DecrRefCount(clsObj);
             return TCL_ERROR;
         }
@@ -760,18 +758,15 @@ static int DumpClassesSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out) {
 
 static int DumpMethodsSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out) {
     uint32_t numMethods = 0;
-    if (!Tbcx_R_U32(r, &numMethods))
+    if (!Tbcx_R_Var(r, &numMethods))
         return TCL_ERROR;
     Tcl_AppendPrintfToObj(out, "\nMethods: %u\n", numMethods);
 
     for (uint32_t m = 0; m < numMethods; m++) {
-        char    *clsf = NULL;
-        uint32_t clsL = 0;
-        if (!Tbcx_R_LPString(r, &clsf, &clsL))
+        Tcl_Obj *clsFqn = NULL;
+        if (!Tbcx_R_StrRef(r, &clsFqn))
             return TCL_ERROR;
-        Tcl_Obj *clsFqn = Tcl_NewStringObj(clsf, (Tcl_Size)clsL);
         Tcl_IncrRefCount(clsFqn);
-        Tcl_Free(clsf);
 
         uint8_t kind = 0;
         if (!Tbcx_R_U8(r, &kind)) {
@@ -792,26 +787,14 @@ static int DumpMethodsSection(TbcxIn *r, Tcl_Interp *interp, Tcl_Obj *out) {
             return TCL_ERROR;
         }
 
-        char    *mname = NULL;
-        uint32_t mnL   = 0;
-        if (!Tbcx_R_LPString(r, &mname, &mnL)) {
+        Tcl_Obj *nameObj = NULL;
+        Tcl_Obj *argsObj = NULL;
+        if (!Tbcx_R_StrRef(r, &nameObj) || !Tbcx_R_StrRef(r, &argsObj)) {
             Tcl_DecrRefCount(clsFqn);
             return TCL_ERROR;
         }
-        Tcl_Obj *nameObj = Tcl_NewStringObj(mname, (Tcl_Size)mnL);
         Tcl_IncrRefCount(nameObj);
-        Tcl_Free(mname);
-
-        char    *args = NULL;
-        uint32_t aL   = 0;
-        if (!Tbcx_R_LPString(r, &args, &aL)) {
-            Tcl_DecrRefCount(nameObj);
-            Tcl_DecrRefCount(clsFqn);
-            return TCL_ERROR;
-        }
-        Tcl_Obj *argsObj = Tcl_NewStringObj(args, (Tcl_Size)aL);
         Tcl_IncrRefCount(argsObj);
-        Tcl_Free(args);
 
         Tcl_AppendToObj(out, "  - ", -1);
         Tcl_AppendObjToObj(out, clsFqn);
@@ -899,23 +882,31 @@ int Tbcx_DumpObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
         return TCL_ERROR;
     }
 
-    Tcl_Channel in = Tcl_FSOpenFileChannel(interp, objv[1], "r", 0);
-    if (!in)
-        return TCL_ERROR;
-    if (Tbcx_CheckBinaryChan(interp, in) != TCL_OK) {
-        Tcl_Close(interp, in);
-        return TCL_ERROR;
+    /* Map regular files; fall back to a channel for everything else. */
+    TbcxIn      r;
+    TbcxMap     map;
+    Tcl_Channel in = NULL;
+    if (Tbcx_MapFile(objv[1], &map)) {
+        size_t off, len;
+        Tbcx_FindPayload(map.base, map.len, &off, &len);
+        Tbcx_R_InitMem(&r, interp, map.base + off, len);
+    } else {
+        in = Tcl_FSOpenFileChannel(interp, objv[1], "r", 0);
+        if (!in)
+            return TCL_ERROR;
+        if (Tbcx_CheckBinaryChan(interp, in) != TCL_OK) {
+            Tcl_Close(interp, in);
+            return TCL_ERROR;
+        }
+        Tbcx_R_Init(&r, interp, in);
     }
-
-    TbcxIn r;
-    Tbcx_R_Init(&r, interp, in);
     TbcxHeader H;
     memset(&H, 0, sizeof(H));
     if (!Tbcx_ReadHeader(&r, &H) || r.err) {
-        if (H.sourcePath) {
-            Tcl_DecrRefCount(H.sourcePath);
-        }
-        Tcl_Close(interp, in);
+        Tbcx_FreeHeader(&H);
+        if (in)
+            Tcl_Close(interp, in);
+        Tbcx_UnmapFile(&map);
         return TCL_ERROR;
     }
 
@@ -938,11 +929,51 @@ int Tbcx_DumpObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
     } else {
         Tcl_AppendToObj(out, "  source = <inline or channel>\n", -1);
     }
+    Tcl_AppendPrintfToObj(out, "  flags = 0x%08X%s%s%s%s\n", H.flags, (H.flags & TBCX_HDR_FL_SOURCE) ? " (include-source)" : "", (H.flags & TBCX_HDR_FL_LZ) ? " (compressed)" : "",
+                          (H.flags & TBCX_HDR_FL_NATIVE) ? " (native)" : "", (H.flags & TBCX_HDR_FL_DEDUP) ? " (dedup)" : "");
+    Tcl_AppendPrintfToObj(out, "  procs=%u, classes=%u, methods=%u\n", H.numProcs, H.numClasses, H.numMethods);
+    Tcl_AppendPrintfToObj(out, "\nSection directory (%u entries, data base %" PRIu64 "):\n", H.numSections, H.dataBase);
+    for (uint32_t i = 0; i < H.numSections; i++) {
+        const TbcxSection *sp = &H.sections[i];
+        const char        *kn = SectionKindName(sp->kind);
+        Tcl_AppendPrintfToObj(out, "  [%u] %-7s offset=%" PRIu64 " length=%" PRIu64 " crc=0x%08X\n", i, kn, sp->offset, sp->length, sp->crc);
+    }
+
+    /* Compressed artifact: the directory above shows the frames; inflate
+     * them and print the uncompressed section sizes alongside. */
+    unsigned char *inflated = NULL;
+    TbcxStrTab    *strs     = NULL;
+    Tcl_Obj       *topBC    = NULL;
+    TbcxBlockTab   blocks;
+    memset(&blocks, 0, sizeof(blocks));
+    r.blocks = &blocks;
+    if (r.dedup && !r.mem && !(H.flags & TBCX_HDR_FL_LZ)) {
+        /* Back-references seek: read the sections into memory. */
+        inflated = Tbcx_R_Slurp(&r, &H);
+        if (!inflated)
+            goto cleanup_no_topbc;
+    }
+    if (H.flags & TBCX_HDR_FL_LZ) {
+        uint64_t packed = 0;
+        for (uint32_t i = 0; i < H.numSections; i++)
+            packed += H.sections[i].length;
+        inflated = Tbcx_R_Inflate(&r, &H);
+        if (!inflated)
+            goto cleanup_no_topbc;
+        Tcl_AppendPrintfToObj(out, "  inflated: %" PRIu64 " -> %" PRIu64 " bytes\n", packed, (uint64_t)(r.memLen - H.dataBase));
+    }
+
+    /* String table */
+    strs = Tbcx_ReadStrTab(&r);
+    if (!strs)
+        goto cleanup_no_topbc;
+    r.strs = strs;
+    Tcl_AppendPrintfToObj(out, "\nString table: %u strings, %" PRIu64 " bytes\n", strs->count, H.sections[0].length);
 
     /* Top-level block */
     Namespace *curNs   = (Namespace *)Tcl_GetGlobalNamespace(interp);
     uint32_t   dummyNL = 0;
-    Tcl_Obj   *topBC   = Tbcx_ReadBlock(&r, interp, curNs, &dummyNL, 0, 1);
+    topBC              = Tbcx_ReadBlock(&r, interp, curNs, &dummyNL, 0, 1);
     if (!topBC)
         goto cleanup_no_topbc;
     Tcl_IncrRefCount(topBC);
@@ -963,15 +994,214 @@ int Tbcx_DumpObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
 cleanup:
     Tcl_DecrRefCount(topBC);
 cleanup_no_topbc:
-    if (H.sourcePath) {
-        Tcl_DecrRefCount(H.sourcePath);
-        H.sourcePath = NULL;
-    }
-    if (Tcl_Close(interp, in) != TCL_OK)
+    Tbcx_BlockTabFree(&blocks);
+    Tbcx_StrTabRelease(strs);
+    if (inflated)
+        Tcl_Free((char *)inflated);
+    Tbcx_FreeHeader(&H);
+    if (in && Tcl_Close(interp, in) != TCL_OK)
         rc = TCL_ERROR;
+    Tbcx_UnmapFile(&map);
     if (rc == TCL_OK) {
         Tcl_SetObjResult(interp, out);
     }
     Tcl_DecrRefCount(out);
     return rc;
 }
+
+/* ==========================================================================
+ * Tcl command
+ *
+ * Synopsis:   tbcx::verify filename
+ * Arguments:  filename — path to a .tbcx file
+ * Returns:    dict {sections N bytes B crc IMPL}: sections checked, stored
+ *             section bytes covered, and the CRC32C implementation used.
+ * Errors:     TCL_ERROR on open failure, a bad header or directory, a
+ *             checksum mismatch or an undecodable compressed frame.
+ * Thread:     must be called on the interp-owning thread.
+ *
+ * Integrity only: nothing is decoded into bytecode and nothing runs, so a
+ * sweep over many artifacts costs about one read of each.
+ * ========================================================================== */
+
+int Tbcx_VerifyObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_CHECK_INTERP_THREAD(interp);
+    if (objc != 2) {
+        Tcl_WrongNumArgs(interp, 1, objv, "filename");
+        return TCL_ERROR;
+    }
+
+    TbcxIn      r;
+    TbcxMap     map;
+    Tcl_Channel in = NULL;
+    if (Tbcx_MapFile(objv[1], &map)) {
+        size_t off, len;
+        Tbcx_FindPayload(map.base, map.len, &off, &len);
+        Tbcx_R_InitMem(&r, interp, map.base + off, len);
+    } else {
+        in = Tcl_FSOpenFileChannel(interp, objv[1], "r", 0);
+        if (!in)
+            return TCL_ERROR;
+        if (Tbcx_CheckBinaryChan(interp, in) != TCL_OK) {
+            Tcl_Close(interp, in);
+            return TCL_ERROR;
+        }
+        Tbcx_R_Init(&r, interp, in);
+    }
+    TbcxHeader H;
+    memset(&H, 0, sizeof(H));
+    unsigned char *inflated = NULL;
+    uint64_t       stored   = 0;
+    int            rc       = TCL_ERROR;
+    if (!Tbcx_ReadHeader(&r, &H) || !Tbcx_R_VerifySections(&r, &H))
+        goto done;
+    for (uint32_t i = 0; i < H.numSections; i++)
+        stored += H.sections[i].length;
+
+    if (H.flags & TBCX_HDR_FL_LZ) {
+        /* Checks each frame's checksum (channel readers) and that every
+         * frame inflates to its promised size. */
+        inflated = Tbcx_R_Inflate(&r, &H);
+        if (!inflated)
+            goto done;
+    } else if (!r.mem) {
+        /* Channel reader: stream through the sections so the running
+         * checksum sees every byte. */
+        unsigned char scratch[4096];
+        for (uint32_t i = 0; i < H.numSections && !r.err; i++) {
+            const TbcxSection *sp = &H.sections[i];
+            uint64_t           at = H.dataBase + sp->offset;
+            while (!r.err && Tbcx_R_Tell(&r) < at) {
+                uint64_t gap = at - Tbcx_R_Tell(&r); /* counts between records */
+                Tbcx_R_Bytes(&r, scratch, (Tcl_Size)((gap < sizeof(scratch)) ? gap : sizeof(scratch)));
+            }
+            Tbcx_R_CrcMark(&r);
+            for (uint64_t left = sp->length; left > 0 && !r.err;) {
+                size_t n = (left < sizeof(scratch)) ? (size_t)left : sizeof(scratch);
+                if (Tbcx_R_Bytes(&r, scratch, (Tcl_Size)n))
+                    left -= n;
+            }
+            if (!r.err)
+                Tbcx_R_CrcCheck(&r, &H, i);
+        }
+        if (r.err)
+            goto done;
+    }
+
+    Tcl_Obj *res = Tcl_NewDictObj();
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("sections", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.numSections));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("bytes", -1), Tcl_NewWideIntObj((Tcl_WideInt)stored));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("crc", -1), Tcl_NewStringObj(Tbcx_CrcImpl(), -1));
+    Tcl_SetObjResult(interp, res);
+    rc = TCL_OK;
+
+done:
+    if (inflated)
+        Tcl_Free((char *)inflated);
+    Tbcx_FreeHeader(&H);
+    if (in && Tcl_Close(interp, in) != TCL_OK)
+        rc = TCL_ERROR;
+    Tbcx_UnmapFile(&map);
+    return rc;
+}
+
+/* ==========================================================================
+ * Tcl command
+ *
+ * Synopsis:   tbcx::info filename
+ * Arguments:  filename — path to a .tbcx file (or a file with an appended
+ *             artifact)
+ * Returns:    dict {format F tcl V source S flags L top T procs P
+ *             classes C methods M bytes B sections D}: the header fields,
+ *             the save options the artifact was written with (flags: any
+ *             of include-source, compress, native, dedup), the top-level
+ *             block's counts (T: code except lits aux locals stack), and
+ *             the stored size of each section (D: kind, bytes, ... in
+ *             directory order) with their total B.
+ * Errors:     TCL_ERROR on open failure or a bad header or directory.
+ * Thread:     must be called on the interp-owning thread.
+ *
+ * Header only: no section is checksummed, inflated or decoded, so the
+ * cost is independent of the artifact's size.  tbcx::verify checks the
+ * bytes; tbcx::dump shows them.
+ * ========================================================================== */
+
+int Tbcx_InfoObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_CHECK_INTERP_THREAD(interp);
+    if (objc != 2) {
+        Tcl_WrongNumArgs(interp, 1, objv, "filename");
+        return TCL_ERROR;
+    }
+
+    TbcxIn      r;
+    TbcxMap     map;
+    Tcl_Channel in = NULL;
+    if (Tbcx_MapFile(objv[1], &map)) {
+        size_t off, len;
+        Tbcx_FindPayload(map.base, map.len, &off, &len);
+        Tbcx_R_InitMem(&r, interp, map.base + off, len);
+    } else {
+        in = Tcl_FSOpenFileChannel(interp, objv[1], "r", 0);
+        if (!in)
+            return TCL_ERROR;
+        if (Tbcx_CheckBinaryChan(interp, in) != TCL_OK) {
+            Tcl_Close(interp, in);
+            return TCL_ERROR;
+        }
+        Tbcx_R_Init(&r, interp, in);
+    }
+    TbcxHeader H;
+    memset(&H, 0, sizeof(H));
+    int rc = TCL_ERROR;
+    if (!Tbcx_ReadHeader(&r, &H) || r.err)
+        goto done;
+
+    Tcl_Obj *flags = Tcl_NewListObj(0, NULL);
+    if (H.flags & TBCX_HDR_FL_SOURCE)
+        Tcl_ListObjAppendElement(NULL, flags, Tcl_NewStringObj("include-source", -1));
+    if (H.flags & TBCX_HDR_FL_LZ)
+        Tcl_ListObjAppendElement(NULL, flags, Tcl_NewStringObj("compress", -1));
+    if (H.flags & TBCX_HDR_FL_NATIVE)
+        Tcl_ListObjAppendElement(NULL, flags, Tcl_NewStringObj("native", -1));
+    if (H.flags & TBCX_HDR_FL_DEDUP)
+        Tcl_ListObjAppendElement(NULL, flags, Tcl_NewStringObj("dedup", -1));
+
+    Tcl_Obj *top = Tcl_NewDictObj();
+    Tcl_DictObjPut(NULL, top, Tcl_NewStringObj("code", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.codeLenTop));
+    Tcl_DictObjPut(NULL, top, Tcl_NewStringObj("except", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.numExceptTop));
+    Tcl_DictObjPut(NULL, top, Tcl_NewStringObj("lits", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.numLitsTop));
+    Tcl_DictObjPut(NULL, top, Tcl_NewStringObj("aux", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.numAuxTop));
+    Tcl_DictObjPut(NULL, top, Tcl_NewStringObj("locals", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.numLocalsTop));
+    Tcl_DictObjPut(NULL, top, Tcl_NewStringObj("stack", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.maxStackTop));
+
+    uint64_t stored   = 0;
+    Tcl_Obj *sections = Tcl_NewListObj(0, NULL);
+    for (uint32_t i = 0; i < H.numSections; i++) {
+        const TbcxSection *sp = &H.sections[i];
+        stored += sp->length;
+        Tcl_ListObjAppendElement(NULL, sections, Tcl_NewStringObj(SectionKindName(sp->kind), -1));
+        Tcl_ListObjAppendElement(NULL, sections, Tcl_NewWideIntObj((Tcl_WideInt)sp->length));
+    }
+
+    Tcl_Obj *res = Tcl_NewDictObj();
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("format", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.format));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("tcl", -1),
+                   Tcl_ObjPrintf("%u.%u.%u", (unsigned)((H.tcl_version >> 24) & 0xFFu), (unsigned)((H.tcl_version >> 16) & 0xFFu), (unsigned)((H.tcl_version >> 8) & 0xFFu)));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("source", -1), H.sourcePath ? H.sourcePath : Tcl_NewObj());
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("flags", -1), flags);
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("top", -1), top);
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("procs", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.numProcs));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("classes", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.numClasses));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("methods", -1), Tcl_NewWideIntObj((Tcl_WideInt)H.numMethods));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("bytes", -1), Tcl_NewWideIntObj((Tcl_WideInt)stored));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("sections", -1), sections);
+    Tcl_SetObjResult(interp, res);
+    rc = TCL_OK;
+
+done:
+    Tbcx_FreeHeader(&H);
+    if (in && Tcl_Close(interp, in) != TCL_OK)
+        rc = TCL_ERROR;
+    Tbcx_UnmapFile(&map);
+    return rc;
+}
@@ -13,7 +13,7 @@
  *   Tcl_SetAssocData.  No mutex is needed for this state because
  *   each interpreter is used by exactly one thread.
  *
- *   Proc structs created by TBCX (in ReadProc, ReadMethod, ReadLit_LambdaBC,
+ *   Proc structs created by TBCX (in ReadProc, ReadMethod, MaterializeLambda,
  *   ProcShim_DirectInstall, CmdProcShim slow path, and top-level topProc)
  *   are per-interp and NEVER shared across interpreters or threads.  Their
  *   refCount fields are therefore safe to manipulate without a mutex.
@@ -30,19 +30,11 @@
 
 #include "tbcx.h"
 
-/* ==========================================================================
- * Portability
- * ========================================================================== */
-
-/* "Function may be deliberately uncalled" annotation.  GCC/Clang understand
- * __attribute__((unused)); MSVC's cl cannot parse it at all (it triggers a
- * cascade of syntax errors).  MSVC has no whole-function equivalent, but at
- * warning level /W3 it does not flag an unreferenced static function
- * (C4505 is a level-4 warning), so an empty expansion is safe there. */
-#if defined(__GNUC__) || defined(__clang__)
-#  define TBCX_MAYBE_UNUSED __attribute__((unused))
-#else
-#  define TBCX_MAYBE_UNUSED
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 /* ==========================================================================
@@ -110,6 +102,7 @@ typedef struct {
     Tcl_ObjCmdProc2 *savedObjdefNre;
     void            *savedObjdefCD;
     int              hasObjDefine; /* 1 if oo::objdefine was successfully shimmed */
+    int              lazyMethods;  /* 1 once a deferred (-lazy) method body is registered */
 } OOShim;
 
 /* ApplyShim — persistent interceptor on the [apply] command.
@@ -142,6 +135,34 @@ typedef struct {
                                         and forwards directly to savedApplyProc. */
 } ApplyShim;
 
+/* TbcxArena — scratch memory for decoding compiled blocks.  Allocation is
+ * a pointer bump; Tbcx_ReadBlock takes a mark on entry and releases back
+ * to it on exit, so a block's temporaries (staged code bytes, literal,
+ * AuxData, exception and local-name arrays) cost one release together.
+ * Nested blocks decoded from literals stack on top of their parent's.
+ * Chunks are kept for the next block and the next load; one that grew
+ * past TBCX_ARENA_CHUNK for an outsized block is freed once the outermost
+ * block releases. */
+#define TBCX_ARENA_CHUNK (64u * 1024u)
+#define TBCX_ARENA_ALIGN 8u
+
+typedef struct TbcxArenaChunk {
+    struct TbcxArenaChunk *next;
+    size_t                 cap;
+    size_t                 used;
+    unsigned char          data[];
+} TbcxArenaChunk;
+
+typedef struct TbcxArena {
+    TbcxArenaChunk *first;
+    TbcxArenaChunk *cur; /* NULL when nothing is allocated */
+} TbcxArena;
+
+typedef struct {
+    TbcxArenaChunk *chunk;
+    size_t          used;
+} TbcxArenaMark;
+
 /* TbcxInterpState — consolidated per-interpreter state.
  * Attached via Tcl_SetAssocData under TBCX_INTERP_STATE_KEY.
  * Created lazily on first tbcx::load; destroyed when the interpreter
@@ -152,8 +173,51 @@ typedef struct {
     int         applyActive;  /* 1 once the [apply] shim has been installed */
     Tcl_Size    loadDepth;    /* reentrancy depth for tbcx::load */
     uint64_t    nextHiddenId; /* per-interp OO shim rename counter */
+    /* Real proc dispatch handlers, captured by the ProcShim the first time a
+     * proc is created in this interp.  Lazy proc commands (tbcx::load -lazy)
+     * switch to these once their body has been decoded. */
+    Tcl_ObjCmdProc2 *procDispatchObj;
+    Tcl_ObjCmdProc2 *procDispatchNre;
+    TbcxArena        scratch; /* Tbcx_ReadBlock temporaries (R_Arena) */
+    /* tbcx::intern: string rep (plain strings: per namespace) -> the one
+     * shared literal Tcl_Obj (the table holds a reference to each), at most
+     * TBCX_INTERN_MAX of them.  Initialized while internOn. */
+    Tcl_HashTable    intern;
+    int              internOn;
 } TbcxInterpState;
 
+/* TbcxImage — refcounted artifact bytes kept alive past the load so that
+ * lazily installed bodies can be decoded on first use.  Backed by a file
+ * mapping, an owned heap copy or an artifact cache entry.  Bound to the interp thread (the
+ * count is not atomic). */
+typedef struct {
+    Tcl_Size             refCount;
+    const unsigned char *base;
+    size_t               len;
+    TbcxMap              map;   /* base lies inside map when file-backed */
+    unsigned char       *owned; /* heap copy otherwise */
+    TbcxStrTab          *strs;  /* string table, set by the lazy load */
+    int                  native;    /* header flags of the artifact, for */
+    uint32_t             nativeAbi; /* readers that start past the header */
+    int                  dedup;
+    int                  trusted; /* tbcx::trust matched: deferred bodies skip shape checks */
+    int                  checked; /* operands already validated in this process */
+    TbcxBlockTab         blocks; /* back-reference targets decoded so far */
+    TbcxCached          *cached; /* base/len borrowed from this cache entry */
+} TbcxImage;
+
+/* TbcxLazyBody — internal rep of a deferred proc body (tbcxLazyBodyType).
+ * Points at the body-source LPString of a proc record; the compiled block
+ * follows it and the record ends at endOff.  The string rep is produced
+ * from the image on demand, so `info body` works before the first call. */
+typedef struct {
+    Tcl_Size   refCount;
+    TbcxImage *img;
+    uint64_t   srcOff; /* image offset of the body-source LPString */
+    uint64_t   endOff; /* image offset one past the proc record */
+    Tcl_Obj   *nsObj;  /* namespace the block was compiled for */
+} TbcxLazyBody;
+
 typedef struct {
     Var        *oldLocals;
     Tcl_Size    oldNum;
@@ -179,6 +243,7 @@ static int         AddOOShim(Tcl_Interp *ip, OOShim *os);
 static int         AddProcShim(Tcl_Interp *ip, ProcShim *ps);
 static void        ApplyCmdDeleteTrace(void *cd, Tcl_Interp *interp, const char *oldName, const char *newName, int flags);
 static void        ApplyShimTeardown(ApplyShim *as, Tcl_Interp *ip);
+static void        InternRelease(TbcxInterpState *st);
 static void        ApplyShimPurgeStale(ApplyShim *as);
 static Tcl_Obj    *ByteCodeObj(Tcl_Interp *ip, Namespace *nsPtr, const unsigned char *code, uint32_t codeLen, Tcl_Obj **lits, uint32_t numLits, AuxData *auxArr, uint32_t numAux, ExceptionRange *exArr,
                                uint32_t numEx, int maxStackDepth, int setPrecompiled);
@@ -194,8 +259,18 @@ static int         PairScope(Tcl_Interp *ip, Tcl_Obj *pair);
 static void        DelOOShim(Tcl_Interp *ip, OOShim *os);
 static void        DelProcShim(Tcl_Interp *ip, ProcShim *ps);
 static ApplyShim  *EnsureApplyShim(Tcl_Interp *ip);
+static const char *ExceptRangeShapeError(const ExceptionRange *er, Tcl_Size numEx);
 static void        FixCompiledLocalNames(Proc *procPtr, LocalCache *lc);
+static void        FreeAuxPayloads(AuxData *arr, uint32_t n);
+static void        LazyMethodsArm(Tcl_Interp *ip, Tcl_Obj *fqn);
+static int         LazyProcCmd(void *cd, Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const objv[]);
+static int         LoadTbcxReader(Tcl_Interp *ip, TbcxIn *r, Tcl_Obj *scriptFilePath, TbcxImage *img, int threads);
 static int         LoadTbcxStream(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePath);
+static int         LoadFile(Tcl_Interp *interp, Tcl_Obj *inObj, int lazy, int threads);
+static int         LoadMapSpan(Tcl_Interp *ip, TbcxMap *m, const unsigned char *p, size_t n, Tcl_Obj *scriptFilePath, const TbcxFileId *id, int lazy, int threads);
+static Tcl_ObjCmdProc2 *ZipfsInfoProc(void);
+static int         MapZipfsMember(Tcl_Interp *interp, Tcl_Obj *pathObj, TbcxMap *m, const unsigned char **pOut, size_t *nOut);
+static Tcl_Obj    *NewLazyBody(TbcxImage *img, uint64_t srcOff, uint64_t endOff, Tcl_Obj *nsObj);
 static int         MethodKeyBuf(Tcl_DString *ds, Tcl_Obj *clsFqn, uint8_t kind, uint8_t origin, Tcl_Obj *name);
 static void        OOShimDefineCmdTrace(void *cd, Tcl_Interp *interp, const char *oldName, const char *newName, int flags);
 static void        OOShimObjdefCmdTrace(void *cd, Tcl_Interp *interp, const char *oldName, const char *newName, int flags);
@@ -208,54 +283,200 @@ static int         ObjBuilderCollectMethods(Tcl_Interp *ip, Tcl_Obj *builderBody
 static void        ClassBuilderCollectMethods(Tcl_Interp *ip, Tcl_Obj *clsFqn, Tcl_Obj *builderBody, Tcl_HashTable *keysOut);
 static int         DefOOObj(Tcl_Interp *ip, OOShim *os, Tcl_Obj *objFqn, Tcl_Obj *name, Tcl_Obj *args, Tcl_Obj *preBody);
 static void        ProcCmdDeleteTrace(void *cd, Tcl_Interp *interp, const char *oldName, const char *newName, int flags);
-static int         ProcShim_DirectInstall(ProcShim *ps, Tcl_Interp *ip, Tcl_Obj *fqn, Tcl_Obj *nameObj, Proc *preProc, Tcl_Obj *savedArgs);
+static int         ProcShim_DirectInstall(ProcShim *ps, Tcl_Interp *ip, Tcl_Obj *fqn, Tcl_Obj *nameObj, Tcl_Obj *bodyObj, Tcl_Size numLocals, Tcl_Obj *savedArgs, Command **cmdOut);
+static int         ProcShim_LazyInstall(ProcShim *ps, Tcl_Interp *ip, Tcl_Obj *fqn, Tcl_Size objc, Tcl_Obj *const objv[], Tcl_Obj *lazyBody, Tcl_Obj *savedArgs);
 static inline void R_Error(TbcxIn *r, const char *msg);
-static int         ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut);
-static int         ReadExceptions(TbcxIn *r, ExceptionRange **exOut, uint32_t *numOut);
-static Tcl_Obj    *ReadLit_Bignum(TbcxIn *r);
-static Tcl_Obj    *ReadLit_LambdaBC(TbcxIn *r, Tcl_Interp *ip, int depth, int dumpOnly);
-static Tcl_Obj    *ReadLiteral(TbcxIn *r, Tcl_Interp *ip, int depth, int dumpOnly);
-static int         ReadMethod(TbcxIn *r, Tcl_Interp *ip, OOShim *os);
-static int         ReadProc(TbcxIn *r, Tcl_Interp *ip, ProcShim *shim, uint32_t procIdx);
+static int         ReadAuxArray(TbcxIn *r, TbcxArena *a, AuxData **auxOut, uint32_t *numAuxOut);
+static int         ReadAuxEntries(TbcxIn *r, TbcxArena *a, AuxData *arr, uint32_t n);
+static int         ReadExceptions(TbcxIn *r, TbcxArena *a, ExceptionRange **exOut, uint32_t *numOut);
+static Tcl_Obj    *InternLiteral(Tcl_HashTable *t, Namespace *nsPtr, Tcl_Obj *lit);
+static int         ReadMethod(TbcxIn *r, Tcl_Interp *ip, OOShim *os, uint32_t methIdx, const TbcxHeader *H, TbcxImage *img);
+static int         ReadProc(TbcxIn *r, Tcl_Interp *ip, ProcShim *shim, uint32_t procIdx, const TbcxHeader *H, TbcxImage *img);
 static inline void RefreshBC(ByteCode *bcPtr, Tcl_Interp *ip, Namespace *nsPtr);
 static void        FixLiteralPoolProcPtr(ByteCode *bcPtr);
 static void        NullLiteralPoolProcPtr(ByteCode *bcPtr, Proc *target);
 static void        RegisterPrecompiledLambda(Tcl_Interp *ip, Tcl_Obj *lambda, Proc *procPtr, Tcl_Obj *nsObj);
 Tcl_Namespace     *Tbcx_EnsureNamespace(Tcl_Interp *ip, const char *fqn);
+int                Tbcx_LoadBytesObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+int                Tbcx_LoadSpan(Tcl_Interp *ip, TbcxMap *m, const unsigned char *p, size_t n, Tcl_Obj *scriptFilePath, int lazy);
 int                Tbcx_LoadObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+int                Tbcx_PreloadObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
 inline int         Tbcx_R_Bytes(TbcxIn *r, void *p, Tcl_Size n);
+int                Tbcx_MapFile(Tcl_Obj *pathObj, TbcxMap *m);
 void               Tbcx_R_Init(TbcxIn *r, Tcl_Interp *ip, Tcl_Channel ch);
+void               Tbcx_R_InitMem(TbcxIn *r, Tcl_Interp *ip, const unsigned char *p, size_t n);
+int                Tbcx_R_View(TbcxIn *r, size_t n, const unsigned char **pp);
+void               Tbcx_UnmapFile(TbcxMap *m);
+void               Tbcx_FindPayload(const unsigned char *p, size_t n, size_t *offOut, size_t *lenOut);
 inline int         Tbcx_R_LPString(TbcxIn *r, char **sp, uint32_t *lenp);
+Tcl_Obj           *Tbcx_R_StringObj(TbcxIn *r);
 inline int         Tbcx_R_U32(TbcxIn *r, uint32_t *vp);
+inline int         Tbcx_R_Var(TbcxIn *r, uint32_t *vp);
 inline int         Tbcx_R_U64(TbcxIn *r, uint64_t *vp);
+int                Tbcx_R_VarArray(TbcxIn *r, uint32_t *dst, uint32_t n);
 inline int         Tbcx_R_U8(TbcxIn *r, uint8_t *v);
 Tcl_Obj           *Tbcx_ReadBlock(TbcxIn *r, Tcl_Interp *ip, Namespace *nsForDefault, uint32_t *numLocalsOut, int setPrecompiled, int dumpOnly);
 int                Tbcx_ReadHeader(TbcxIn *r, TbcxHeader *H);
 void               TbcxApplyShimPurgeAll(Tcl_Interp *ip);
+void               TbcxInternPurge(Tcl_Interp *ip);
+int                Tbcx_InternObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
 static ByteCode   *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const TBCX_CompileEnvMin *env, int setPrecompiled);
+static ByteCode   *TbcxByteCodeAlloc(Tcl_Interp *ip, Namespace *nsPtr, Proc *procPtr, size_t codeBytes, Tcl_Size numLits, Tcl_Size numEx, Tcl_Size numAux, Tcl_Size maxStack);
+static void        TbcxByteCodeAttach(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, ByteCode *codePtr, int setPrecompiled);
+static void        TbcxByteCodeDiscard(ByteCode *codePtr);
+static int         TbcxCheckExceptRanges(Tcl_Interp *ip, const ExceptionRange *ex, Tcl_Size numEx, size_t codeBytes, Tcl_Size *depthOut);
 static void        TbcxFixLocalCacheExtras(ByteCode *bcPtr, Proc *procPtr);
 static TbcxInterpState *TbcxGetInterpState(Tcl_Interp *ip);
 static void             TbcxInterpStateCleanup(void *cd, Tcl_Interp *ip);
 static void             TopLocals_Begin(Tcl_Interp *ip, ByteCode *bcPtr, TbcxTopFrameSave *sv);
 static void             TopLocals_End(Tcl_Interp *ip, TbcxTopFrameSave *sv);
 
+/* ==========================================================================
+ * Decode scratch arena
+ * ========================================================================== */
+
+/* ArenaAlloc — n bytes aligned to TBCX_ARENA_ALIGN, or NULL when out of
+ * memory.  Moves on to the next retained chunk when the current one is
+ * full, and allocates a new chunk only when that one is too small too. */
+static void *ArenaAlloc(TbcxArena *a, size_t n) {
+    if (n > SIZE_MAX - TBCX_ARENA_ALIGN)
+        return NULL;
+    n                 = (n + TBCX_ARENA_ALIGN - 1u) & ~(size_t)(TBCX_ARENA_ALIGN - 1u);
+    TbcxArenaChunk *c = a->cur;
+    if (c && c->cap - c->used >= n) {
+        void *p = c->data + c->used;
+        c->used += n;
+        return p;
+    }
+    TbcxArenaChunk *nx = c ? c->next : a->first;
+    if (!nx || nx->cap < n) {
+        size_t cap = n > TBCX_ARENA_CHUNK ? n : TBCX_ARENA_CHUNK;
+        if (cap > SIZE_MAX - offsetof(TbcxArenaChunk, data))
+            return NULL;
+        TbcxArenaChunk *nc = (TbcxArenaChunk *)Tcl_AttemptAlloc(offsetof(TbcxArenaChunk, data) + cap);
+        if (!nc)
+            return NULL;
+        nc->cap  = cap;
+        nc->next = nx;
+        if (c)
+            c->next = nc;
+        else
+            a->first = nc;
+        nx = nc;
+    }
+    nx->used = n;
+    a->cur   = nx;
+    return nx->data;
+}
+
+static inline TbcxArenaMark ArenaMark(const TbcxArena *a) {
+    TbcxArenaMark m;
+    m.chunk = a->cur;
+    m.used  = a->cur ? a->cur->used : 0;
+    return m;
+}
+
+/* ArenaRelease — drop everything allocated since m.  Releasing to the
+ * empty mark also frees every chunk but the first, and the first too when
+ * it is oversized, so one huge block does not pin memory for the life of
+ * the interpreter. */
+static void ArenaRelease(TbcxArena *a, TbcxArenaMark m) {
+    if (m.chunk) {
+        m.chunk->used = m.used;
+        a->cur        = m.chunk;
+        return;
+    }
+    a->cur = NULL;
+    if (!a->first)
+        return;
+    TbcxArenaChunk *c = a->first->next;
+    a->first->next    = NULL;
+    while (c) {
+        TbcxArenaChunk *next = c->next;
+        Tcl_Free((char *)c);
+        c = next;
+    }
+    if (a->first->cap > TBCX_ARENA_CHUNK) {
+        Tcl_Free((char *)a->first);
+        a->first = NULL;
+    }
+}
+
+static void ArenaFree(TbcxArena *a) {
+    ArenaRelease(a, (TbcxArenaMark){NULL, 0});
+    if (a->first)
+        Tcl_Free((char *)a->first);
+    a->first = NULL;
+}
+
+/* R_Arena — the decode arena for r: its interpreter's, looked up once per
+ * reader. */
+static inline TbcxArena *R_Arena(TbcxIn *r) {
+    if (!r->arena)
+        r->arena = &TbcxGetInterpState(r->interp)->scratch;
+    return r->arena;
+}
+
 /* ==========================================================================
  * Buffered Read I/O & Utilities
  * ========================================================================== */
 
+/* R_Error — record the first error on r: in its interp's result, or in
+ * r->errMsg for a reader without one (an off-thread DecodeBlock).  msg
+ * must outlive r. */
 static inline void      R_Error(TbcxIn *r, const char *msg) {
     if (r->err == TCL_OK) {
-        Tcl_SetObjResult(r->interp, Tcl_NewStringObj(msg, -1));
+        if (r->interp)
+            Tcl_SetObjResult(r->interp, Tcl_NewStringObj(msg, -1));
+        else
+            r->errMsg = msg;
         r->err = TCL_ERROR;
     }
 }
 
+/* R_ErrorLimit — R_Error for a count above its cap. */
+static void R_ErrorLimit(TbcxIn *r, const char *what, uint32_t v, uint32_t limit) {
+    if (r->err == TCL_OK) {
+        snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: %s %u exceeds limit %u", what, v, limit);
+        R_Error(r, r->errBuf);
+    }
+}
+
 void Tbcx_R_Init(TbcxIn *r, Tcl_Interp *ip, Tcl_Channel ch) {
-    r->interp  = ip;
-    r->chan    = ch;
-    r->err     = TCL_OK;
-    r->bufPos  = 0;
-    r->bufFill = 0;
+    r->interp    = ip;
+    r->chan      = ch;
+    r->err       = TCL_OK;
+    r->mem       = NULL;
+    r->memLen    = 0;
+    r->memPos    = 0;
+    r->bufPos    = 0;
+    r->bufFill   = 0;
+    r->chanPos   = 0;
+    r->strs      = NULL;
+    r->crcOn     = 0;
+    r->crc       = 0;
+    r->crcPos    = 0;
+    r->arena     = NULL;
+    r->native    = 0;
+    r->nativeAbi = 0;
+    r->dedup     = 0;
+    r->blocks    = NULL;
+    r->verified  = 0;
+    r->trusted   = 0;
+    r->checked   = 0;
+    r->trustHash = NULL;
+    r->intern    = NULL;
+    r->errMsg    = NULL;
+    r->par       = NULL;
+}
+
+/* Tbcx_R_InitMem — reader over a caller-owned byte span (an mmap'd file or
+ * an in-memory artifact).  The span must outlive every read; nothing is
+ * copied up front and the 64 KiB channel buffer is never touched. */
+void Tbcx_R_InitMem(TbcxIn *r, Tcl_Interp *ip, const unsigned char *p, size_t n) {
+    Tbcx_R_Init(r, ip, NULL);
+    r->mem    = p;
+    r->memLen = n;
 }
 
 inline int Tbcx_R_Bytes(TbcxIn *r, void *p, Tcl_Size n) {
@@ -263,6 +484,15 @@ inline int Tbcx_R_Bytes(TbcxIn *r, void *p, Tcl_Size n) {
         return 0;
     if (n == 0)
         return 1;
+    if (r->mem) {
+        if ((size_t)n > r->memLen - r->memPos) {
+            R_Error(r, "tbcx: unexpected EOF (short read)");
+            return 0;
+        }
+        memcpy(p, r->mem + r->memPos, (size_t)n);
+        r->memPos += (size_t)n;
+        return 1;
+    }
     unsigned char *dst = (unsigned char *)p;
     Tcl_Size       rem = n;
     while (rem > 0) {
@@ -276,7 +506,11 @@ inline int Tbcx_R_Bytes(TbcxIn *r, void *p, Tcl_Size n) {
             rem -= chunk;
             continue;
         }
-        /* Buffer empty — refill */
+        /* Buffer empty — fold it into the running checksum, then refill */
+        if (r->crcOn) {
+            r->crc    = Tbcx_Crc32c(r->crc, r->buf + r->crcPos, (size_t)(r->bufFill - r->crcPos));
+            r->crcPos = 0;
+        }
         Tcl_Size got = Tcl_ReadRaw(r->chan, (char *)r->buf, (Tcl_Size)TBCX_BUFSIZE);
         if (got < 0) {
             R_Error(r, "tbcx: I/O error during read");
@@ -288,40 +522,583 @@ inline int Tbcx_R_Bytes(TbcxIn *r, void *p, Tcl_Size n) {
         }
         r->bufPos  = 0;
         r->bufFill = got;
+        r->chanPos += (uint64_t)got;
+    }
+    return 1;
+}
+
+/* Tbcx_R_Tell — bytes consumed since the reader was initialised.  Works
+ * for both reader kinds; section directory offsets are checked against it. */
+uint64_t Tbcx_R_Tell(const TbcxIn *r) {
+    if (r->mem)
+        return (uint64_t)r->memPos;
+    return r->chanPos - (uint64_t)(r->bufFill - r->bufPos);
+}
+
+/* Tbcx_R_Seek — reposition a memory reader at a data-base-relative offset
+ * taken from the section directory.  Channel readers are strictly
+ * sequential and get an error. */
+int Tbcx_R_Seek(TbcxIn *r, const TbcxHeader *H, uint64_t dataOff) {
+    if (r->err)
+        return 0;
+    if (!r->mem) {
+        R_Error(r, "tbcx: seek on a channel reader");
+        return 0;
+    }
+    if (H->dataBase > (uint64_t)r->memLen || dataOff > (uint64_t)r->memLen - H->dataBase) {
+        R_Error(r, "tbcx: section offset out of range");
+        return 0;
+    }
+    r->memPos = (size_t)(H->dataBase + dataOff);
+    return 1;
+}
+
+/* Tbcx_R_VerifySections — check every directory entry's CRC32C.  A memory
+ * reader has the whole artifact, so all sections are checked here, before
+ * anything is decoded.  A channel reader cannot look ahead: it switches on
+ * the running checksum instead, and each section is checked when the
+ * caller reaches its end (Tbcx_R_CrcMark / Tbcx_R_CrcCheck). */
+int Tbcx_R_VerifySections(TbcxIn *r, const TbcxHeader *H) {
+    if (r->err)
+        return 0;
+    if (r->verified)
+        return 1;
+    if (!r->mem) {
+        r->crcOn  = 1;
+        r->crc    = 0;
+        r->crcPos = r->bufPos;
+        return 1;
+    }
+    for (uint32_t i = 0; i < H->numSections; i++) {
+        const TbcxSection *sp = &H->sections[i];
+        if (Tbcx_Crc32c(0, r->mem + H->dataBase + sp->offset, (size_t)sp->length) != sp->crc) {
+            snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: checksum mismatch in section %u", i);
+            R_Error(r, r->errBuf);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Tbcx_R_CrcMark — start a section: drop what the running checksum holds. */
+void Tbcx_R_CrcMark(TbcxIn *r) {
+    r->crc    = 0;
+    r->crcPos = r->bufPos;
+}
+
+/* Tbcx_R_CrcCheck — end of section idx: compare the running checksum. */
+int Tbcx_R_CrcCheck(TbcxIn *r, const TbcxHeader *H, uint32_t idx) {
+    if (r->err)
+        return 0;
+    r->crc    = Tbcx_Crc32c(r->crc, r->buf + r->crcPos, (size_t)(r->bufPos - r->crcPos));
+    r->crcPos = r->bufPos;
+    if (r->crc != H->sections[idx].crc) {
+        snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: checksum mismatch in section %u", idx);
+        R_Error(r, r->errBuf);
+        return 0;
+    }
+    return 1;
+}
+
+/* Tbcx_R_Inflate — expand the section frames of a TBCX_HDR_FL_LZ artifact.
+ * Call right after Tbcx_ReadHeader.  The frames are read in stream order
+ * (so channel readers work too) and inflated into one owned buffer laid
+ * out exactly like the uncompressed artifact; H's directory is rewritten to
+ * match and r is re-pointed at the buffer.  A zeroed prefix the size of the
+ * header keeps Tbcx_R_Tell positions absolute.  Returns the buffer (free it
+ * once nothing reads from it) or NULL with the error recorded on r. */
+unsigned char *Tbcx_R_Inflate(TbcxIn *r, TbcxHeader *H) {
+    size_t         base   = (size_t)H->dataBase;
+    size_t         cap    = base + TBCX_BUFSIZE;
+    size_t         len    = base;
+    unsigned char *buf    = (unsigned char *)Tcl_AttemptAlloc(cap);
+    unsigned char *tmp    = NULL; /* channel readers: staged frame payload */
+    size_t         tmpCap = 0;
+    if (!buf) {
+        R_Error(r, "tbcx: allocation failed (inflate)");
+        return NULL;
+    }
+    memset(buf, 0, base);
+    for (uint32_t i = 0; i < H->numSections; i++) {
+        TbcxSection *sp     = &H->sections[i];
+        uint8_t      codec  = 0;
+        uint32_t     rawLen = 0;
+        if (Tbcx_R_Tell(r) != H->dataBase + sp->offset) {
+            R_Error(r, "tbcx: section directory does not match stream layout");
+            goto fail;
+        }
+        if (sp->length < TBCX_FRAME_HDR) {
+            R_Error(r, "tbcx: bad compressed frame");
+            goto fail;
+        }
+        if (r->crcOn)
+            Tbcx_R_CrcMark(r);
+        if (!Tbcx_R_U8(r, &codec) || !Tbcx_R_U32(r, &rawLen))
+            goto fail;
+        uint64_t packed = sp->length - TBCX_FRAME_HDR;
+        if (codec > TBCX_FRAME_LZ || (codec == TBCX_FRAME_STORED && packed != rawLen) || packed > TBCX_MAX_IMAGE || rawLen > TBCX_MAX_IMAGE - len) {
+            R_Error(r, "tbcx: bad compressed frame");
+            goto fail;
+        }
+        if (len + rawLen > cap) {
+            size_t want = cap;
+            while (want < len + rawLen)
+                want = (want > TBCX_MAX_IMAGE / 2u) ? TBCX_MAX_IMAGE : want * 2u;
+            unsigned char *grown = (unsigned char *)Tcl_AttemptRealloc((char *)buf, want);
+            if (!grown) {
+                R_Error(r, "tbcx: allocation failed (inflate)");
+                goto fail;
+            }
+            buf = grown;
+            cap = want;
+        }
+        const unsigned char *src = NULL;
+        if (r->mem) {
+            if (!Tbcx_R_View(r, (size_t)packed, &src))
+                goto fail;
+        } else {
+            if (packed > tmpCap) {
+                unsigned char *grown = (unsigned char *)Tcl_AttemptRealloc((char *)tmp, (size_t)packed);
+                if (!grown) {
+                    R_Error(r, "tbcx: allocation failed (inflate)");
+                    goto fail;
+                }
+                tmp    = grown;
+                tmpCap = (size_t)packed;
+            }
+            if (!Tbcx_R_Bytes(r, tmp, (Tcl_Size)packed) || (r->crcOn && !Tbcx_R_CrcCheck(r, H, i)))
+                goto fail;
+            src = tmp;
+        }
+        if (codec == TBCX_FRAME_STORED) {
+            if (rawLen)
+                memcpy(buf + len, src, rawLen);
+        } else if (!Tbcx_LzDecompress(src, (size_t)packed, buf + len, rawLen)) {
+            R_Error(r, "tbcx: bad compressed frame");
+            goto fail;
+        }
+        sp->offset = (uint64_t)(len - base);
+        sp->length = rawLen;
+        len += rawLen;
+    }
+    if (tmp)
+        Tcl_Free((char *)tmp);
+    r->mem    = buf;
+    r->memLen = len;
+    r->memPos = base;
+    r->crcOn  = 0; /* frames are verified; their contents are not checksummed */
+    return buf;
+fail:
+    if (tmp)
+        Tcl_Free((char *)tmp);
+    Tcl_Free((char *)buf);
+    return NULL;
+}
+
+/* Tbcx_R_Slurp — read the sections of an uncompressed artifact from a
+ * channel reader into one owned buffer and re-point r at it, for artifacts
+ * whose back-references (TBCX_HDR_FL_DEDUP) need to seek.  Call right
+ * after Tbcx_ReadHeader, before Tbcx_R_VerifySections.  Like
+ * Tbcx_R_Inflate, a zeroed prefix the size of the header keeps positions
+ * absolute.  Returns the buffer (free it once nothing reads from it) or
+ * NULL with the error recorded on r. */
+unsigned char *Tbcx_R_Slurp(TbcxIn *r, const TbcxHeader *H) {
+    uint64_t end = 0;
+    for (uint32_t i = 0; i < H->numSections; i++) {
+        const TbcxSection *sp = &H->sections[i];
+        if (sp->offset + sp->length > end)
+            end = sp->offset + sp->length;
+    }
+    if (end > TBCX_MAX_IMAGE || H->dataBase > TBCX_MAX_IMAGE - end) {
+        R_Error(r, "tbcx: artifact too large");
+        return NULL;
+    }
+    size_t         base = (size_t)H->dataBase;
+    size_t         len  = base + (size_t)end;
+    unsigned char *buf  = (unsigned char *)Tcl_AttemptAlloc(len ? len : 1u);
+    if (!buf) {
+        R_Error(r, "tbcx: allocation failed (artifact image)");
+        return NULL;
+    }
+    memset(buf, 0, base);
+    if (!Tbcx_R_Bytes(r, buf + base, (Tcl_Size)end)) {
+        Tcl_Free((char *)buf);
+        return NULL;
+    }
+    r->mem    = buf;
+    r->memLen = len;
+    r->memPos = base;
+    return buf;
+}
+
+/* Tbcx_R_View — zero-copy read for memory-backed readers.  On success *pp
+ * points at the next n bytes of the span and the cursor moves past them;
+ * the pointer stays valid for as long as the span does.  Only legal when
+ * r->mem is set — channel readers must copy with Tbcx_R_Bytes. */
+int Tbcx_R_View(TbcxIn *r, size_t n, const unsigned char **pp) {
+    if (r->err)
+        return 0;
+    if (!r->mem) {
+        R_Error(r, "tbcx: zero-copy read on a channel reader");
+        return 0;
+    }
+    if (n > r->memLen - r->memPos) {
+        R_Error(r, "tbcx: unexpected EOF (short read)");
+        return 0;
+    }
+    *pp = r->mem + r->memPos;
+    r->memPos += n;
+    return 1;
+}
+
+/* Tbcx_MapFile — map a regular file read-only for Tbcx_R_InitMem.
+ *
+ * Returns 1 with *m filled in on success.  Returns 0 (interp untouched)
+ * whenever mapping is not possible or not sensible — a path outside the
+ * native filesystem (zipfs, VFS), a FIFO/device, an empty file, or any
+ * OS failure — so the caller simply falls back to the channel path.
+ *
+ * The descriptor is closed right after mapping; the view keeps the file
+ * alive.  Artifacts are write-once build outputs: like any mmap reader,
+ * truncating the file underneath a live load is undefined. */
+int Tbcx_MapFile(Tcl_Obj *pathObj, TbcxMap *m) {
+    m->base = NULL;
+    m->len  = 0;
+    if (!pathObj)
+        return 0;
+#ifdef _WIN32
+    const WCHAR *native = (const WCHAR *)Tcl_FSGetNativePath(pathObj);
+    if (!native)
+        return 0;
+    HANDLE hFile = CreateFileW(native, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return 0;
+    LARGE_INTEGER sz;
+    if (GetFileType(hFile) != FILE_TYPE_DISK || !GetFileSizeEx(hFile, &sz) || sz.QuadPart <= 0 || (uint64_t)sz.QuadPart > (uint64_t)SIZE_MAX) {
+        CloseHandle(hFile);
+        return 0;
+    }
+    HANDLE hMap = CreateFileMappingW(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(hFile);
+    if (!hMap)
+        return 0;
+    void *base = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(hMap); /* the view holds its own reference */
+    if (!base)
+        return 0;
+    m->base = (const unsigned char *)base;
+    m->len  = (size_t)sz.QuadPart;
+    return 1;
+#else
+    const char *native = (const char *)Tcl_FSGetNativePath(pathObj);
+    if (!native)
+        return 0;
+    int oflags = O_RDONLY;
+#ifdef O_CLOEXEC
+    oflags |= O_CLOEXEC;
+#endif
+    int fd = open(native, oflags);
+    if (fd < 0)
+        return 0;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 || (uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+        close(fd);
+        return 0;
+    }
+    size_t len  = (size_t)st.st_size;
+    void  *base = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        return 0;
+#ifdef MADV_SEQUENTIAL
+    (void)madvise(base, len, MADV_SEQUENTIAL);
+#endif
+    m->base = (const unsigned char *)base;
+    m->len  = len;
+    return 1;
+#endif
+}
+
+void Tbcx_UnmapFile(TbcxMap *m) {
+    if (!m || !m->base)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile((LPCVOID)m->base);
+#else
+    munmap((void *)m->base, m->len);
+#endif
+    m->base = NULL;
+    m->len  = 0;
+}
+
+/* Tbcx_FindPayload — where the artifact lies in the file image [p, p + n):
+ * all of it when it starts with the artifact magic, else the span a valid
+ * appended-payload trailer names (TBCX_TRAILER_SIZE).  Anything else also
+ * yields the whole image, so the header read reports it as it always has. */
+void Tbcx_FindPayload(const unsigned char *p, size_t n, size_t *offOut, size_t *lenOut) {
+    *offOut = 0;
+    *lenOut = n;
+    if ((n >= 4 && Tbcx_GetLe32(p) == TBCX_MAGIC) || n < TBCX_TRAILER_SIZE)
+        return;
+    const unsigned char *t = p + n - TBCX_TRAILER_SIZE;
+    if (memcmp(t + 16, TBCX_TRAILER_MAGIC, 8) != 0)
+        return;
+    uint64_t off = Tbcx_GetLe64(t), len = Tbcx_GetLe64(t + 8);
+    size_t   room = n - TBCX_TRAILER_SIZE;
+    if (len < 4 || off > (uint64_t)room || len > (uint64_t)room - off || Tbcx_GetLe32(p + off) != TBCX_MAGIC)
+        return;
+    *offOut = (size_t)off;
+    *lenOut = (size_t)len;
+}
+
+#ifndef _WIN32
+/* ImageFromMap — wrap a mapping in a TbcxImage (refCount 1).  Ownership of
+ * the mapping moves to the image; *m is cleared.  Windows images never hold
+ * a view (LoadMapSpan). */
+static TbcxImage *ImageFromMap(TbcxMap *m) {
+    TbcxImage *img = (TbcxImage *)Tcl_Alloc(sizeof(TbcxImage));
+    memset(img, 0, sizeof(*img));
+    img->refCount = 1;
+    img->map      = *m;
+    img->base     = m->base;
+    img->len      = m->len;
+    m->base       = NULL;
+    m->len        = 0;
+    return img;
+}
+#endif
+
+/* ImageFromCache — TbcxImage over a cached artifact image; takes over the
+ * caller's reference to ce. */
+static TbcxImage *ImageFromCache(TbcxCached *ce) {
+    TbcxImage *img = (TbcxImage *)Tcl_Alloc(sizeof(TbcxImage));
+    memset(img, 0, sizeof(*img));
+    img->refCount = 1;
+    img->cached   = ce;
+    img->base     = ce->base;
+    img->len      = ce->len;
+    return img;
+}
+
+/* ImageCopy — TbcxImage holding a private copy of [p, p + n).  Returns NULL
+ * with the interp result set on allocation failure. */
+static TbcxImage *ImageCopy(Tcl_Interp *ip, const unsigned char *p, size_t n) {
+    unsigned char *buf = (unsigned char *)Tcl_AttemptAlloc(n ? n : 1u);
+    if (!buf) {
+        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (artifact image)", -1));
+        return NULL;
+    }
+    memcpy(buf, p, n);
+    TbcxImage *img = (TbcxImage *)Tcl_Alloc(sizeof(TbcxImage));
+    memset(img, 0, sizeof(*img));
+    img->refCount = 1;
+    img->owned    = buf;
+    img->base     = buf;
+    img->len      = n;
+    return img;
+}
+
+/* ImageFromChannel — read the rest of a binary channel into a TbcxImage.
+ * Returns NULL with the interp result set on I/O error or when the stream
+ * exceeds TBCX_MAX_IMAGE. */
+static TbcxImage *ImageFromChannel(Tcl_Interp *ip, Tcl_Channel ch) {
+    size_t         cap = TBCX_BUFSIZE, len = 0;
+    unsigned char *buf = (unsigned char *)Tcl_AttemptAlloc(cap);
+    if (!buf)
+        goto oom;
+    for (;;) {
+        if (len == cap) {
+            if (cap >= TBCX_MAX_IMAGE) {
+                Tcl_Free((char *)buf);
+                Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: artifact too large", -1));
+                return NULL;
+            }
+            unsigned char *grown = (unsigned char *)Tcl_AttemptRealloc((char *)buf, cap * 2u);
+            if (!grown) {
+                Tcl_Free((char *)buf);
+                goto oom;
+            }
+            buf = grown;
+            cap *= 2u;
+        }
+        Tcl_Size got = Tcl_ReadRaw(ch, (char *)buf + len, (Tcl_Size)(cap - len));
+        if (got < 0) {
+            Tcl_Free((char *)buf);
+            Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: I/O error during read", -1));
+            return NULL;
+        }
+        if (got == 0)
+            break;
+        len += (size_t)got;
+    }
+    TbcxImage *img = (TbcxImage *)Tcl_Alloc(sizeof(TbcxImage));
+    memset(img, 0, sizeof(*img));
+    img->refCount = 1;
+    img->owned    = buf;
+    img->base     = buf;
+    img->len      = len;
+    return img;
+oom:
+    Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (artifact image)", -1));
+    return NULL;
+}
+
+/* ImageAdopt — replace img's storage with an owned buffer (the inflated
+ * form of a compressed artifact). */
+static void ImageAdopt(TbcxImage *img, unsigned char *buf, size_t len) {
+    if (img->owned)
+        Tcl_Free((char *)img->owned);
+    Tbcx_UnmapFile(&img->map);
+    img->owned = buf;
+    img->base  = buf;
+    img->len   = len;
+}
+
+/* ImageLive — whether img reads straight from a file mapping, whose bytes
+ * a rewrite of the file in place still changes. */
+static int ImageLive(const TbcxImage *img) {
+    return img->map.base != NULL || (img->cached && !img->cached->owned);
+}
+
+/* ImageDetach — give img a private copy of its bytes (ImageAdopt) and let
+ * go of the mapping or cache entry they came from.  Returns 0 with the
+ * interp result set on allocation failure. */
+static int ImageDetach(Tcl_Interp *ip, TbcxImage *img) {
+    unsigned char *copy = (unsigned char *)Tcl_AttemptAlloc(img->len ? img->len : 1u);
+    if (!copy) {
+        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (artifact image)", -1));
+        return 0;
     }
+    memcpy(copy, img->base, img->len);
+    TbcxCached *ce = img->cached;
+    img->cached    = NULL;
+    ImageAdopt(img, copy, img->len);
+    Tbcx_CacheRelease(ce);
     return 1;
 }
 
+static void ImageRelease(TbcxImage *img) {
+    if (!img || --img->refCount > 0)
+        return;
+    if (img->owned)
+        Tcl_Free((char *)img->owned);
+    Tbcx_UnmapFile(&img->map);
+    Tbcx_CacheRelease(img->cached);
+    Tbcx_StrTabRelease(img->strs);
+    Tbcx_BlockTabFree(&img->blocks);
+    Tcl_Free((char *)img);
+}
+
 inline int Tbcx_R_U8(TbcxIn *r, uint8_t *v) {
     return Tbcx_R_Bytes(r, v, 1);
 }
 
+/* R_Avail — the bytes readable in place: the rest of the span, or what is
+ * left in the channel buffer. */
+static inline const unsigned char *R_Avail(const TbcxIn *r, size_t *availOut) {
+    if (r->mem) {
+        *availOut = r->memLen - r->memPos;
+        return r->mem + r->memPos;
+    }
+    *availOut = (size_t)(r->bufFill - r->bufPos);
+    return r->buf + r->bufPos;
+}
+
+static inline void R_Consume(TbcxIn *r, size_t n) {
+    if (r->mem)
+        r->memPos += n;
+    else
+        r->bufPos += (Tcl_Size)n;
+}
+
 inline int Tbcx_R_U32(TbcxIn *r, uint32_t *vp) {
-    uint32_t v = 0;
-    if (!Tbcx_R_Bytes(r, &v, 4))
+    unsigned char b[4];
+    size_t        avail;
+    if (r->err)
+        return 0;
+    const unsigned char *p = R_Avail(r, &avail);
+    if (avail < 4u) {
+        if (!Tbcx_R_Bytes(r, b, 4))
+            return 0;
+        p = b;
+    } else {
+        R_Consume(r, 4u);
+    }
+    *vp = Tbcx_GetLe32(p);
+    return 1;
+}
+
+/* Tbcx_R_Var — read a varint.  When the whole encoding is already in the
+ * span or the channel buffer it is decoded in place; only a varint that
+ * straddles a buffer refill takes the byte-at-a-time path. */
+inline int Tbcx_R_Var(TbcxIn *r, uint32_t *vp) {
+    if (r->err)
         return 0;
-    if (!atomic_load_explicit(&tbcxHostIsLE, memory_order_relaxed)) {
-        v = ((v & 0xFF) << 24) | ((v & 0xFF00) << 8) | ((v >> 8) & 0xFF00) | (v >> 24);
+    size_t               avail;
+    const unsigned char *p    = R_Avail(r, &avail);
+    size_t               used = Tbcx_DecodeVar(p, avail, vp);
+    if (used) {
+        R_Consume(r, used);
+        return 1;
+    }
+    if (avail < TBCX_VAR_MAX) {
+        unsigned char tmp[TBCX_VAR_MAX];
+        size_t        n = 0;
+        do {
+            if (!Tbcx_R_Bytes(r, &tmp[n], 1))
+                return 0;
+        } while ((tmp[n++] & 0x80u) && n < TBCX_VAR_MAX);
+        if (Tbcx_DecodeVar(tmp, n, vp))
+            return 1;
+    }
+    R_Error(r, "tbcx: malformed varint");
+    return 0;
+}
+
+/* Tbcx_R_VarArray — read n varints into dst.  Runs of values that are
+ * wholly inside the span or the channel buffer decode in one pass
+ * (Tbcx_DecodeVars); only a value straddling a refill goes through
+ * Tbcx_R_Var on its own. */
+int Tbcx_R_VarArray(TbcxIn *r, uint32_t *dst, uint32_t n) {
+    while (n) {
+        if (r->err)
+            return 0;
+        size_t               avail, used;
+        const unsigned char *p    = R_Avail(r, &avail);
+        uint32_t             done = Tbcx_DecodeVars(p, avail, dst, n, &used);
+        R_Consume(r, used);
+        dst += done;
+        n -= done;
+        if (n) {
+            if (!Tbcx_R_Var(r, dst))
+                return 0;
+            dst++;
+            n--;
+        }
     }
-    *vp = v;
     return 1;
 }
 
 inline int Tbcx_R_U64(TbcxIn *r, uint64_t *vp) {
-    uint64_t v = 0;
-    if (!Tbcx_R_Bytes(r, &v, 8))
+    unsigned char b[8];
+    size_t        avail;
+    if (r->err)
         return 0;
-    if (!atomic_load_explicit(&tbcxHostIsLE, memory_order_relaxed)) {
-        v = ((v & 0x00000000000000FFull) << 56) | ((v & 0x000000000000FF00ull) << 40) | ((v & 0x0000000000FF0000ull) << 24) | ((v & 0x00000000FF000000ull) << 8) | ((v & 0x000000FF00000000ull) >> 8) |
-            ((v & 0x0000FF0000000000ull) >> 24) | ((v & 0x00FF000000000000ull) >> 40) | ((v & 0xFF00000000000000ull) >> 56);
+    const unsigned char *p = R_Avail(r, &avail);
+    if (avail < 8u) {
+        if (!Tbcx_R_Bytes(r, b, 8))
+            return 0;
+        p = b;
+    } else {
+        R_Consume(r, 8u);
     }
-    *vp = v;
+    *vp = Tbcx_GetLe64(p);
     return 1;
 }
 
 inline int Tbcx_R_LPString(TbcxIn *r, char **sp, uint32_t *lenp) {
     uint32_t n = 0;
-    if (!Tbcx_R_U32(r, &n))
+    if (!Tbcx_R_Var(r, &n))
         return 0;
     if (n > TBCX_MAX_STR) {
         R_Error(r, "tbcx: LPString too large");
@@ -342,6 +1119,114 @@ inline int Tbcx_R_LPString(TbcxIn *r, char **sp, uint32_t *lenp) {
     return 1;
 }
 
+/* Tbcx_R_StringObj — read an LPString straight into the string rep of a
+ * new, unshared Tcl_Obj: one allocation and one copy, with no staging
+ * buffer (Tbcx_R_LPString + Tcl_NewStringObj costs two of each).  Memory
+ * readers copy from the span; channel readers read into the rep.  Returns
+ * NULL with the error recorded on r. */
+Tcl_Obj *Tbcx_R_StringObj(TbcxIn *r) {
+    uint32_t n = 0;
+    if (!Tbcx_R_Var(r, &n))
+        return NULL;
+    if (n > TBCX_MAX_STR) {
+        R_Error(r, "tbcx: LPString too large");
+        return NULL;
+    }
+    if (r->mem) {
+        const unsigned char *p = NULL;
+        if (!Tbcx_R_View(r, n, &p))
+            return NULL;
+        return Tcl_NewStringObj((const char *)p, (Tcl_Size)n);
+    }
+    Tcl_Obj *o = Tcl_NewObj();
+    if (n == 0)
+        return o;
+    char *dst = Tcl_InitStringRep(o, NULL, n);
+    if (!dst || !Tbcx_R_Bytes(r, dst, n)) {
+        if (!dst)
+            R_Error(r, "tbcx: allocation failed (LPString)");
+        Tcl_IncrRefCount(o);
+        Tcl_DecrRefCount(o);
+        return NULL;
+    }
+    return o;
+}
+
+/* AdoptStringRep — move src's string rep to dst (whose own rep is
+ * discarded) without copying, and release the caller's one reference to
+ * src.  src must be a non-empty pure string with refCount 1, as
+ * Tbcx_R_StringObj returns it once the caller has taken its reference;
+ * dst's internal rep is untouched.  For records that store body source
+ * text ahead of the compiled block it annotates. */
+static void AdoptStringRep(Tcl_Obj *dst, Tcl_Obj *src) {
+    Tcl_InvalidateStringRep(dst);
+    dst->bytes  = src->bytes;
+    dst->length = src->length;
+    src->bytes  = NULL; /* src is left with no rep at all and freed now */
+    src->length = 0;
+    Tcl_DecrRefCount(src);
+}
+
+/* Tbcx_ReadStrTab — read a TBCX_SEC_STRINGS body (varint count, LPStrings)
+ * into a new table with refCount 1.  Each entry is read straight into its
+ * Tcl_Obj (Tbcx_R_StringObj).  Returns NULL with the error recorded on r. */
+TbcxStrTab *Tbcx_ReadStrTab(TbcxIn *r) {
+    uint32_t n = 0;
+    if (!Tbcx_R_Var(r, &n))
+        return NULL;
+    if (n > TBCX_MAX_STRINGS) {
+        R_Error(r, "tbcx: string table too large");
+        return NULL;
+    }
+    TbcxStrTab *st = (TbcxStrTab *)Tcl_Alloc(sizeof(TbcxStrTab));
+    st->refCount   = 1;
+    st->count      = 0;
+    st->objs       = NULL;
+    if (n) {
+        st->objs = (Tcl_Obj **)Tcl_AttemptAlloc(sizeof(Tcl_Obj *) * (size_t)n);
+        if (!st->objs) {
+            Tcl_Free((char *)st);
+            R_Error(r, "tbcx: allocation failed (string table)");
+            return NULL;
+        }
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        Tcl_Obj *o = Tbcx_R_StringObj(r);
+        if (!o) {
+            Tbcx_StrTabRelease(st);
+            return NULL;
+        }
+        Tcl_IncrRefCount(o);
+        st->objs[st->count++] = o;
+    }
+    return st;
+}
+
+void Tbcx_StrTabRelease(TbcxStrTab *st) {
+    if (!st || --st->refCount > 0)
+        return;
+    for (uint32_t i = 0; i < st->count; i++)
+        Tcl_DecrRefCount(st->objs[i]);
+    if (st->objs)
+        Tcl_Free((char *)st->objs);
+    Tcl_Free((char *)st);
+}
+
+/* Tbcx_R_StrRef — read a string ref and return the shared table entry.
+ * The object is borrowed from r->strs: take a reference to keep it, and
+ * never modify it in place. */
+int Tbcx_R_StrRef(TbcxIn *r, Tcl_Obj **objOut) {
+    uint32_t idx = 0;
+    if (!Tbcx_R_Var(r, &idx))
+        return 0;
+    if (!r->strs || idx >= r->strs->count) {
+        R_Error(r, "tbcx: string ref out of range");
+        return 0;
+    }
+    *objOut = r->strs->objs[idx];
+    return 1;
+}
+
 static inline void RefreshBC(ByteCode *bcPtr, Tcl_Interp *ip, Namespace *nsPtr) {
     if (!bcPtr)
         return;
@@ -1926,6 +2811,9 @@ static int CmdOOShim(void *cd, Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const obj
     }
 
 cleanup:
+    /* -lazy: arm whatever deferred methods this definition installed. */
+    if (rc == TCL_OK && os->lazyMethods)
+        LazyMethodsArm(ip, clsFqn);
     if (hasKey)
         Tcl_DStringFree(&keyDs);
     if (clsFqn != cls)
@@ -2077,6 +2965,8 @@ static int CmdOOShimObjDef(void *cd, Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *con
                             if (rc == TCL_OK && (kind == TBCX_METH_INST || kind == TBCX_METH_CLASS) && (objScope == TBCX_MSCOPE_PUBLIC || objScope == TBCX_MSCOPE_UNEXPORTED) && nameO)
                                 rc = TbcxApplyObjExportVisibility(ip, os, objFqn, nameO, objScope == TBCX_MSCOPE_PUBLIC);
                         }
+                        if (rc == TCL_OK && os->lazyMethods)
+                            LazyMethodsArm(ip, objFqn);
                         Tcl_DStringFree(&keyDs);
                         if (objFqn != obj)
                             Tcl_DecrRefCount(objFqn);
@@ -2106,6 +2996,8 @@ static int CmdOOShimObjDef(void *cd, Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *con
             rc = patchRc; /* preserve PrecompObject() error/result */
         }
     }
+    if (rc == TCL_OK && os->lazyMethods)
+        LazyMethodsArm(ip, objFqn);
 
     if (objFqn != obj)
         Tcl_DecrRefCount(objFqn);
@@ -2298,56 +3190,88 @@ Tcl_Namespace *Tbcx_EnsureNamespace(Tcl_Interp *ip, const char *fqn) {
     return nsPtr;
 }
 
-/* Mirrors TclInitByteCode()’s packed layout + TclInitByteCodeObj()’s attach,
- * but never calls internal TclPreserveByteCode(). Instead we set refCount = 1.
- */
-
-static ByteCode *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const TBCX_CompileEnvMin *env, int setPrecompiled) {
-    Interp      *iPtr              = (Interp *)env->interp;
-    Namespace   *nsPtr             = env->nsPtr ? env->nsPtr : (iPtr->varFramePtr ? iPtr->varFramePtr->nsPtr : iPtr->globalNsPtr);
-
-    /* Sizes for packed allocation (match TclInitByteCode) */
-    const size_t codeBytes         = (size_t)(env->codeNext - env->codeStart);
-    const size_t objArrayBytes     = (size_t)env->numLitObjects * sizeof(Tcl_Obj *);
-    const size_t exceptArrayBytes  = (size_t)env->numExceptRanges * sizeof(ExceptionRange);
-    const size_t auxDataArrayBytes = (size_t)env->numAuxDataItems * sizeof(AuxData);
-    const size_t cmdLocBytes       = 0; /* no cmd-location map stored */
+/* ExceptRangeShapeError — why a decoded range cannot be handed to the
+ * engine, or NULL when it is well formed: the type must be LOOP or CATCH,
+ * the nesting level must fit the table, LOOP ranges carry no catch
+ * offset, CATCH ranges no break/continue offsets, and -1 is the only
+ * negative offset.  Code bounds are TbcxCheckExceptRanges's job. */
+static const char *ExceptRangeShapeError(const ExceptionRange *er, Tcl_Size numEx) {
+    if (er->type != LOOP_EXCEPTION_RANGE && er->type != CATCH_EXCEPTION_RANGE)
+        return "tbcx: invalid exception range type";
+    if (er->nestingLevel < 0 || er->nestingLevel >= numEx)
+        return "tbcx: exception range nesting level out of range";
+    if (er->continueOffset < -1 || er->breakOffset < -1 || er->catchOffset < -1)
+        return "tbcx: negative exception range offset";
+    if (er->type == LOOP_EXCEPTION_RANGE) {
+        if (er->catchOffset != (Tcl_Size)-1)
+            return "tbcx: LOOP exception range with non-sentinel catchOffset";
+    } else if (er->breakOffset != (Tcl_Size)-1 || er->continueOffset != (Tcl_Size)-1) {
+        return "tbcx: CATCH exception range with non-sentinel break/continueOffset";
+    }
+    return NULL;
+}
 
-    /* Overflow guard: ensure the combined structure size doesn't wrap around.
-       Use SIZE_MAX/2 as a generous upper bound to detect pathological inputs
-       from malformed .tbcx files. */
-    {
-        size_t safeCap = SIZE_MAX / 2;
-        if (codeBytes > safeCap || objArrayBytes > safeCap || exceptArrayBytes > safeCap || auxDataArrayBytes > safeCap) {
-            Tcl_SetObjResult(env->interp, Tcl_NewStringObj("tbcx: ByteCode section sizes overflow", -1));
-            return NULL;
+/* TbcxCheckExceptRanges — validate exception-range offsets against the code
+ * block bounds and compute the ByteCode's maxExceptDepth.  Returns 0 with
+ * the interp result set on the first range that does not fit. */
+static int TbcxCheckExceptRanges(Tcl_Interp *ip, const ExceptionRange *ex, Tcl_Size numEx, size_t codeBytes, Tcl_Size *depthOut) {
+    Tcl_Size maxDepth = 0;
+    for (Tcl_Size vi = 0; vi < numEx; vi++) {
+        const ExceptionRange *er = &ex[vi];
+        /* Overflow-safe bounds check: validate offset first, then
+           remaining space, to avoid uint32_t wrap-around. */
+        if ((size_t)er->codeOffset > codeBytes || (size_t)er->numCodeBytes > codeBytes - (size_t)er->codeOffset) {
+            Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: exception range %td offset+len (%u+%u) exceeds code size (%lu)", vi, (unsigned)er->codeOffset, (unsigned)er->numCodeBytes,
+                                               (unsigned long)codeBytes));
+            return 0;
+        }
+        if (er->catchOffset >= 0 && (uint32_t)er->catchOffset >= codeBytes) {
+            Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: exception range %td catchOffset (%u) exceeds code size (%lu)", vi, (unsigned)er->catchOffset, (unsigned long)codeBytes));
+            return 0;
+        }
+        /* Validate continue/break handler offsets (same pattern as catchOffset). */
+        if (er->continueOffset >= 0 && (size_t)er->continueOffset >= codeBytes) {
+            Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: exception range %td continueOffset (%u) exceeds code size (%lu)", vi, (unsigned)er->continueOffset, (unsigned long)codeBytes));
+            return 0;
         }
+        if (er->breakOffset >= 0 && (size_t)er->breakOffset >= codeBytes) {
+            Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: exception range %td breakOffset (%u) exceeds code size (%lu)", vi, (unsigned)er->breakOffset, (unsigned long)codeBytes));
+            return 0;
+        }
+        Tcl_Size d = (Tcl_Size)er->nestingLevel + 1; /* levels start at 0 */
+        if (d > maxDepth)
+            maxDepth = d;
     }
+    *depthOut = maxDepth;
+    return 1;
+}
 
-    /* Validate exception-range offsets against the code block bounds. */
-    if (env->numExceptRanges > 0 && env->exceptArrayPtr) {
-        for (Tcl_Size vi = 0; vi < env->numExceptRanges; vi++) {
-            ExceptionRange *er = &env->exceptArrayPtr[vi];
-            /* Overflow-safe bounds check: validate offset first, then
-               remaining space, to avoid uint32_t wrap-around. */
-            if ((size_t)er->codeOffset > codeBytes || (size_t)er->numCodeBytes > codeBytes - (size_t)er->codeOffset) {
-                Tcl_SetObjResult(env->interp, Tcl_ObjPrintf("tbcx: exception range %td offset+len (%u+%u) exceeds code size (%lu)", vi, (unsigned)er->codeOffset, (unsigned)er->numCodeBytes,
-                                                            (unsigned long)codeBytes));
-                return NULL;
-            }
-            if (er->catchOffset >= 0 && (uint32_t)er->catchOffset >= codeBytes) {
-                Tcl_SetObjResult(env->interp, Tcl_ObjPrintf("tbcx: exception range %td catchOffset (%u) exceeds code size (%lu)", vi, (unsigned)er->catchOffset, (unsigned long)codeBytes));
-                return NULL;
-            }
-            /* Validate continue/break handler offsets (same pattern as catchOffset). */
-            if (er->continueOffset >= 0 && (size_t)er->continueOffset >= codeBytes) {
-                Tcl_SetObjResult(env->interp, Tcl_ObjPrintf("tbcx: exception range %td continueOffset (%u) exceeds code size (%lu)", vi, (unsigned)er->continueOffset, (unsigned long)codeBytes));
-                return NULL;
-            }
-            if (er->breakOffset >= 0 && (size_t)er->breakOffset >= codeBytes) {
-                Tcl_SetObjResult(env->interp, Tcl_ObjPrintf("tbcx: exception range %td breakOffset (%u) exceeds code size (%lu)", vi, (unsigned)er->breakOffset, (unsigned long)codeBytes));
-                return NULL;
-            }
+/* TbcxByteCodeAlloc — allocate a ByteCode in TclInitByteCode()'s packed
+ * layout (header, code, literals, exception ranges, AuxData, an empty
+ * command-location map) and fill in the header as the core would.  The
+ * literal and AuxData slots come back zeroed; code bytes, ranges and
+ * maxExceptDepth are the caller's to fill.  Never calls internal
+ * TclPreserveByteCode(): refCount starts at 1.  Returns NULL with the
+ * interp result set on overflow or allocation failure. */
+static ByteCode *TbcxByteCodeAlloc(Tcl_Interp *ip, Namespace *nsPtr, Proc *procPtr, size_t codeBytes, Tcl_Size numLits, Tcl_Size numEx, Tcl_Size numAux, Tcl_Size maxStack) {
+    Interp *iPtr = (Interp *)ip;
+    if (!nsPtr)
+        nsPtr = iPtr->varFramePtr ? iPtr->varFramePtr->nsPtr : iPtr->globalNsPtr;
+
+    /* Sizes for packed allocation (match TclInitByteCode) */
+    const size_t objArrayBytes     = (size_t)numLits * sizeof(Tcl_Obj *);
+    const size_t exceptArrayBytes  = (size_t)numEx * sizeof(ExceptionRange);
+    const size_t auxDataArrayBytes = (size_t)numAux * sizeof(AuxData);
+    const size_t cmdLocBytes       = 0; /* no cmd-location map stored */
+
+    /* Overflow guard: ensure the combined structure size doesn't wrap around.
+       Use SIZE_MAX/2 as a generous upper bound to detect pathological inputs
+       from malformed .tbcx files. */
+    {
+        size_t safeCap = SIZE_MAX / 2;
+        if (codeBytes > safeCap || objArrayBytes > safeCap || exceptArrayBytes > safeCap || auxDataArrayBytes > safeCap) {
+            Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: ByteCode section sizes overflow", -1));
+            return NULL;
         }
     }
 
@@ -2360,7 +3284,7 @@ static ByteCode *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const
     do {                                                                                                                                                                                               \
         size_t _aligned = TCL_ALIGN(val);                                                                                                                                                              \
         if ((sz) + _aligned < (sz)) {                                                                                                                                                                  \
-            Tcl_SetObjResult(env->interp, Tcl_ObjPrintf("tbcx: ByteCode total size overflow"));                                                                                                        \
+            Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: ByteCode total size overflow"));                                                                                                                 \
             return NULL;                                                                                                                                                                               \
         }                                                                                                                                                                                              \
         (sz) += _aligned;                                                                                                                                                                              \
@@ -2379,7 +3303,7 @@ static ByteCode *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const
 
     unsigned char *base = (unsigned char *)Tcl_AttemptAlloc(structureSize);
     if (!base) {
-        Tcl_SetObjResult(env->interp, Tcl_NewStringObj("tbcx: allocation failed (ByteCode structure)", -1));
+        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (ByteCode structure)", -1));
         return NULL;
     }
     ByteCode *codePtr = (ByteCode *)base;
@@ -2394,17 +3318,17 @@ static ByteCode *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const
     /* *** Inline TclPreserveByteCode(codePtr) *** */
     codePtr->refCount        = 1; /* brand-new ByteCode held by this one Tcl_Obj */
     codePtr->flags           = ((nsPtr->compiledVarResProc || iPtr->resolverPtr) ? TCL_BYTECODE_RESOLVE_VARS : 0);
-    codePtr->source          = NULL;         /* no retained source for precompiled */
-    codePtr->procPtr         = env->procPtr; /* may be NULL for top-level blocks   */
+    codePtr->source          = NULL;    /* no retained source for precompiled */
+    codePtr->procPtr         = procPtr; /* may be NULL for top-level blocks   */
 
     codePtr->maxExceptDepth  = TCL_INDEX_NONE;
-    codePtr->maxStackDepth   = (Tcl_Size)env->maxStackDepth;
-    codePtr->numAuxDataItems = (Tcl_Size)env->numAuxDataItems;
+    codePtr->maxStackDepth   = maxStack;
+    codePtr->numAuxDataItems = numAux;
     codePtr->numCmdLocBytes  = 0;
     codePtr->numCodeBytes    = (Tcl_Size)codeBytes;
     codePtr->numCommands     = 0;
-    codePtr->numExceptRanges = (Tcl_Size)env->numExceptRanges;
-    codePtr->numLitObjects   = (Tcl_Size)env->numLitObjects;
+    codePtr->numExceptRanges = numEx;
+    codePtr->numLitObjects   = numLits;
     codePtr->numSrcBytes     = 0;
     codePtr->structureSize   = (Tcl_Size)structureSize;
 
@@ -2413,51 +3337,25 @@ static ByteCode *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const
 
     /* 1) Code bytes */
     codePtr->codeStart       = p;
-    if (codeBytes)
-        memcpy(p, env->codeStart, codeBytes);
     p += TCL_ALIGN(codeBytes);
 
     /* 2) Literal object array */
     p                    = (unsigned char *)TCL_ALIGN((uintptr_t)p);
     codePtr->objArrayPtr = (Tcl_Obj **)p;
-    if (env->numLitObjects) {
-        for (Tcl_Size i = 0; i < env->numLitObjects; i++) {
-            Tcl_Obj *lit            = env->objArrayPtr[i];
-            codePtr->objArrayPtr[i] = lit;
-            if (lit)
-                Tcl_IncrRefCount(lit);
-        }
-    }
+    if (objArrayBytes)
+        memset(p, 0, objArrayBytes);
     p += TCL_ALIGN(objArrayBytes);
 
     /* 3) Exception ranges */
     p                       = (unsigned char *)TCL_ALIGN((uintptr_t)p);
     codePtr->exceptArrayPtr = (ExceptionRange *)p;
-    if (env->numExceptRanges) {
-        memcpy(p, env->exceptArrayPtr, exceptArrayBytes);
-    }
     p += TCL_ALIGN(exceptArrayBytes);
 
     /* 4) AuxData array */
-
-    if (env->numExceptRanges > 0 && env->exceptArrayPtr) {
-        Tcl_Size maxDepth = 0;
-        for (Tcl_Size i = 0; i < env->numExceptRanges; i++) {
-            ExceptionRange *er = &env->exceptArrayPtr[i];
-            Tcl_Size        d  = (Tcl_Size)er->nestingLevel + 1; /* levels start at 0 */
-            if (d > maxDepth) {
-                maxDepth = d;
-            }
-        }
-        codePtr->maxExceptDepth = maxDepth;
-    } else {
-        codePtr->maxExceptDepth = 0;
-    }
     p                        = (unsigned char *)TCL_ALIGN((uintptr_t)p);
     codePtr->auxDataArrayPtr = (AuxData *)p;
-    if (env->numAuxDataItems) {
-        memcpy(p, env->auxDataArrayPtr, auxDataArrayBytes);
-    }
+    if (auxDataArrayBytes)
+        memset(p, 0, auxDataArrayBytes);
     p += TCL_ALIGN(auxDataArrayBytes);
 
     /* 5) (Empty) command-location map segment + required alignment step */
@@ -2471,8 +3369,12 @@ static ByteCode *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const
 
     /* Locals cache is created lazily by the engine if needed */
     codePtr->localCachePtr   = NULL;
+    return codePtr;
+}
 
-    /* ----- Attach as the internal rep of objPtr ----- */
+/* TbcxByteCodeAttach — mirrors TclInitByteCodeObj()'s attach: codePtr
+ * becomes the internal rep of objPtr. */
+static void TbcxByteCodeAttach(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, ByteCode *codePtr, int setPrecompiled) {
     Tcl_ObjInternalRep ir;
     ir.twoPtrValue.ptr1 = codePtr;
     ir.twoPtrValue.ptr2 = NULL;
@@ -2480,102 +3382,89 @@ static ByteCode *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const
     if (setPrecompiled) {
         codePtr->flags |= TCL_BYTECODE_PRECOMPILED;
     }
+}
+
+/* TbcxByteCodeDiscard — free a ByteCode from TbcxByteCodeAlloc that was
+ * never attached, releasing whatever literals, AuxData payloads and local
+ * cache had been filled in. */
+static void TbcxByteCodeDiscard(ByteCode *codePtr) {
+    for (Tcl_Size i = 0; i < codePtr->numLitObjects; i++) {
+        if (codePtr->objArrayPtr[i])
+            Tcl_DecrRefCount(codePtr->objArrayPtr[i]);
+    }
+    FreeAuxPayloads(codePtr->auxDataArrayPtr, (uint32_t)codePtr->numAuxDataItems);
+    LocalCache *lc = codePtr->localCachePtr;
+    if (lc) {
+        Tcl_Obj **names = (Tcl_Obj **)&lc->varName0;
+        for (Tcl_Size i = 0; i < lc->numVars; i++) {
+            if (names[i])
+                Tcl_DecrRefCount(names[i]);
+        }
+        Tcl_Free((char *)lc);
+    }
+    TclHandleRelease(codePtr->interpHandle);
+    Tcl_Free((char *)codePtr);
+}
+
+/* TbcxByteCode — allocate the packed ByteCode for env and copy its parts
+ * in, then attach it to objPtr. */
+static ByteCode *TbcxByteCode(Tcl_Obj *objPtr, const Tcl_ObjType *typePtr, const TBCX_CompileEnvMin *env, int setPrecompiled) {
+    const size_t codeBytes = (size_t)(env->codeNext - env->codeStart);
+    Tcl_Size     maxDepth  = 0;
+
+    if (env->numExceptRanges > 0 && env->exceptArrayPtr && !TbcxCheckExceptRanges(env->interp, env->exceptArrayPtr, env->numExceptRanges, codeBytes, &maxDepth))
+        return NULL;
+    ByteCode *codePtr = TbcxByteCodeAlloc(env->interp, env->nsPtr, env->procPtr, codeBytes, env->numLitObjects, env->numExceptRanges, env->numAuxDataItems, env->maxStackDepth);
+    if (!codePtr)
+        return NULL;
+
+    if (codeBytes)
+        memcpy(codePtr->codeStart, env->codeStart, codeBytes);
+    for (Tcl_Size i = 0; i < env->numLitObjects; i++) {
+        Tcl_Obj *lit            = env->objArrayPtr[i];
+        codePtr->objArrayPtr[i] = lit;
+        if (lit)
+            Tcl_IncrRefCount(lit);
+    }
+    if (env->numExceptRanges)
+        memcpy(codePtr->exceptArrayPtr, env->exceptArrayPtr, (size_t)env->numExceptRanges * sizeof(ExceptionRange));
+    codePtr->maxExceptDepth = maxDepth;
+    if (env->numAuxDataItems)
+        memcpy(codePtr->auxDataArrayPtr, env->auxDataArrayPtr, (size_t)env->numAuxDataItems * sizeof(AuxData));
+
+    TbcxByteCodeAttach(objPtr, typePtr, codePtr, setPrecompiled);
     return codePtr;
 }
 
+/* ByteCodeObj — new bytecode Tcl_Obj (refCount 0) built from decoded
+ * parts.  The arrays are only read: literals gain their own references,
+ * and the AuxData payloads move into the ByteCode on success. */
 static Tcl_Obj *ByteCodeObj(Tcl_Interp *ip, Namespace *nsPtr, const unsigned char *code, uint32_t codeLen, Tcl_Obj **lits, uint32_t numLits, AuxData *auxArr, uint32_t numAux, ExceptionRange *exArr,
                             uint32_t numEx, int maxStackDepth, int setPrecompiled) {
-    Tcl_Obj           *bcObj = NULL;
     TBCX_CompileEnvMin env;
     memset(&env, 0, sizeof(env));
-    env.interp        = ip;
-    env.nsPtr         = (Namespace *)nsPtr;
-    env.maxStackDepth = maxStackDepth;
-    env.procPtr       = NULL;
-
-    env.codeStart     = (unsigned char *)Tcl_AttemptAlloc(codeLen ? codeLen : 1u);
-    if (!env.codeStart) {
-        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (code buffer)", -1));
-        goto read_fail;
-    }
-    if (codeLen)
-        memcpy(env.codeStart, code, codeLen);
-    env.codeNext      = env.codeStart + codeLen;
-    env.objArrayPtr   = NULL;
-    env.numLitObjects = (Tcl_Size)numLits;
-    if (numLits) {
-        env.objArrayPtr = (Tcl_Obj **)Tcl_AttemptAlloc(sizeof(Tcl_Obj *) * numLits);
-        if (!env.objArrayPtr) {
-            Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (literal array)", -1));
-            goto read_fail;
-        }
-        for (uint32_t i = 0; i < numLits; i++) {
-            env.objArrayPtr[i] = lits[i];
-            if (env.objArrayPtr[i])
-                Tcl_IncrRefCount(env.objArrayPtr[i]);
-        }
-    }
-
-    env.auxDataArrayPtr = NULL;
+    env.interp          = ip;
+    env.nsPtr           = (Namespace *)nsPtr;
+    env.maxStackDepth   = maxStackDepth;
+    env.procPtr         = NULL;
+    env.codeStart       = (unsigned char *)code;
+    env.codeNext        = env.codeStart + codeLen;
+    env.objArrayPtr     = lits;
+    env.numLitObjects   = (Tcl_Size)numLits;
+    env.auxDataArrayPtr = auxArr;
     env.numAuxDataItems = (Tcl_Size)numAux;
-    if (numAux) {
-        env.auxDataArrayPtr = (AuxData *)Tcl_AttemptAlloc(sizeof(AuxData) * numAux);
-        if (!env.auxDataArrayPtr) {
-            Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (aux data array)", -1));
-            goto read_fail;
-        }
-        for (uint32_t i = 0; i < numAux; i++)
-            env.auxDataArrayPtr[i] = auxArr[i];
-    }
-
-    env.exceptArrayPtr  = NULL;
+    env.exceptArrayPtr  = exArr;
     env.numExceptRanges = (Tcl_Size)numEx;
-    if (numEx) {
-        env.exceptArrayPtr = (ExceptionRange *)Tcl_AttemptAlloc(sizeof(ExceptionRange) * numEx);
-        if (!env.exceptArrayPtr) {
-            Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (exception range array)", -1));
-            goto read_fail;
-        }
-        for (uint32_t i = 0; i < numEx; i++)
-            env.exceptArrayPtr[i] = exArr[i];
-    }
 
-    bcObj = Tcl_NewObj();
+    Tcl_Obj *bcObj      = Tcl_NewObj();
     if (!TbcxByteCode(bcObj, tbcxTyBytecode, &env, setPrecompiled)) {
         /* TbcxByteCode failed (overflow, exception-range validation, etc.).
-         * Clean up the bare object and all temporary state, then return NULL
+         * Nothing was transferred: bounce the bare object and return NULL
          * so the caller can propagate the error. */
         Tcl_IncrRefCount(bcObj);
         Tcl_DecrRefCount(bcObj);
-        bcObj = NULL;
-    }
-
-read_fail:
-    /* Drop the temporary holds on literals and free the temporary array.       */
-    /* TbcxByteCode() has already incref'd the same objects into the ByteCode. */
-    if (env.objArrayPtr) {
-        if (env.numLitObjects > 0) {
-            for (Tcl_Size i = 0; i < env.numLitObjects; i++) {
-                if (env.objArrayPtr[i]) {
-                    Tcl_DecrRefCount(env.objArrayPtr[i]);
-                }
-            }
-        }
-        Tcl_Free(env.objArrayPtr);
+        return NULL;
     }
-
-    /* env.auxDataArrayPtr: this is a temporary shallow copy of the
-     * caller's auxArr.  The clientData payloads are owned by the caller
-     * (or, on TbcxByteCode success, by the packed ByteCode via the
-     * memcpy in TbcxByteCode) — never by env.auxDataArrayPtr itself.
-     * A shallow free here is correct. */
-    if (env.auxDataArrayPtr)
-        Tcl_Free(env.auxDataArrayPtr);
-    if (env.exceptArrayPtr)
-        Tcl_Free(env.exceptArrayPtr);
-    if (env.codeStart)
-        Tcl_Free(env.codeStart);
-
     return bcObj;
 }
 
@@ -2768,15 +3657,12 @@ int TbcxVerifyLoadedBC(ByteCode *bc, Tcl_Interp *ip, const char *label) {
     return TCL_OK;
 }
 
-static int ReadMethod(TbcxIn *r, Tcl_Interp *ip, OOShim *os) {
+static int ReadMethod(TbcxIn *r, Tcl_Interp *ip, OOShim *os, uint32_t methIdx, const TbcxHeader *H, TbcxImage *img) {
     /* classFqn */
-    char    *clsf = NULL;
-    uint32_t clsL = 0;
-    if (!Tbcx_R_LPString(r, &clsf, &clsL))
+    Tcl_Obj *clsFqn = NULL;
+    if (!Tbcx_R_StrRef(r, &clsFqn))
         return TCL_ERROR;
-    Tcl_Obj *clsFqn = Tcl_NewStringObj(clsf, (Tcl_Size)clsL);
     Tcl_IncrRefCount(clsFqn);
-    Tcl_Free(clsf);
     /* kind */
     uint8_t kind = 0;
     if (!Tbcx_R_U8(r, &kind)) {
@@ -2806,32 +3692,28 @@ static int ReadMethod(TbcxIn *r, Tcl_Interp *ip, OOShim *os) {
         return TCL_ERROR;
     }
     /* name (empty for ctor/dtor) */
-    char    *mname = NULL;
-    uint32_t mnL   = 0;
-    if (!Tbcx_R_LPString(r, &mname, &mnL)) {
+    Tcl_Obj *nameObj = NULL;
+    if (!Tbcx_R_StrRef(r, &nameObj)) {
         Tcl_DecrRefCount(clsFqn);
         return TCL_ERROR;
     }
-    Tcl_Obj *nameObj = Tcl_NewStringObj(mname, (Tcl_Size)mnL);
     Tcl_IncrRefCount(nameObj);
-    Tcl_Free(mname);
+    Tcl_Size mnL = 0;
+    (void)Tcl_GetStringFromObj(nameObj, &mnL);
     /* args text */
-    char    *args = NULL;
-    uint32_t aL   = 0;
-    if (!Tbcx_R_LPString(r, &args, &aL)) {
+    Tcl_Obj *argsObj = NULL;
+    if (!Tbcx_R_StrRef(r, &argsObj)) {
         Tcl_DecrRefCount(nameObj);
         Tcl_DecrRefCount(clsFqn);
         return TCL_ERROR;
     }
-    Tcl_Obj *argsObj = Tcl_NewStringObj(args, (Tcl_Size)aL);
     Tcl_IncrRefCount(argsObj);
-    Tcl_Free(args);
 
     /* Validate class FQN: reject embedded NUL and require absolute form */
     {
         Tcl_Size    clsFqnLen = 0;
         const char *clsFqnStr = Tbcx_GetStringFromObjStrict(ip, clsFqn, &clsFqnLen);
-        if (!clsFqnStr || Tbcx_ValidateKeyString(ip, clsFqnStr, clsFqnLen, "method class FQN", 1) != TCL_OK) {
+        if (!clsFqnStr || (!r->trusted && Tbcx_ValidateKeyString(ip, clsFqnStr, clsFqnLen, "method class FQN", 1) != TCL_OK)) {
             Tcl_DecrRefCount(argsObj);
             Tcl_DecrRefCount(nameObj);
             Tcl_DecrRefCount(clsFqn);
@@ -2842,7 +3724,7 @@ static int ReadMethod(TbcxIn *r, Tcl_Interp *ip, OOShim *os) {
     if (mnL > 0) {
         Tcl_Size    nameLen = 0;
         const char *nameStr = Tbcx_GetStringFromObjStrict(ip, nameObj, &nameLen);
-        if (!nameStr || Tbcx_ValidateKeyString(ip, nameStr, nameLen, "method name", 0) != TCL_OK) {
+        if (!nameStr || (!r->trusted && Tbcx_ValidateKeyString(ip, nameStr, nameLen, "method name", 0) != TCL_OK)) {
             Tcl_DecrRefCount(argsObj);
             Tcl_DecrRefCount(nameObj);
             Tcl_DecrRefCount(clsFqn);
@@ -2850,54 +3732,70 @@ static int ReadMethod(TbcxIn *r, Tcl_Interp *ip, OOShim *os) {
         }
     }
 
-    /* Body source text.  Read before the compiled block so we can
-     * attach it to the fresh body Tcl_Obj with Tcl_InitStringRep — that
-     * restores `info class method -body` / `info object method -body`
-     * round-trip fidelity.  Length==0 means the artifact was written
-     * without -include-source (the default for tbcx, matching the
-     * tclcompiler/tbcload tradition for Tcl AOT output); substitute
-     * the diagnostic sentinel so introspection is loud rather than
-     * silently empty. */
-    char    *bodySrc = NULL;
-    uint32_t bodySrcLen = 0;
-    if (!Tbcx_R_LPString(r, &bodySrc, &bodySrcLen)) {
-        Tcl_DecrRefCount(argsObj);
-        Tcl_DecrRefCount(nameObj);
-        Tcl_DecrRefCount(clsFqn);
-        return TCL_ERROR;
-    }
-
-    /* compiled block (namespace default: class namespace) + receive numLocals */
-    Namespace *clsNs  = (Namespace *)Tbcx_EnsureNamespace(ip, Tcl_GetString(clsFqn));
+    Namespace *clsNs  = NULL;
     uint32_t   nLoc   = 0;
-    Tcl_Obj   *bodyBC = Tbcx_ReadBlock(r, ip, clsNs, &nLoc, 1, 0);
-    if (!bodyBC) {
-        Tcl_Free(bodySrc);
-        Tcl_DecrRefCount(argsObj);
-        Tcl_DecrRefCount(nameObj);
-        Tcl_DecrRefCount(clsFqn);
-        return TCL_ERROR;
-    }
-    Tcl_IncrRefCount(bodyBC);
-
-    /* Attach source text as string rep.  bodyBC->bytes is
-     * &tclEmptyString (TclNewObj default), not NULL — so we must
-     * Tcl_InvalidateStringRep() first to force Tcl_InitStringRep down
-     * its allocate-and-copy branch (bytes==NULL).  The other two
-     * branches (empty-string singleton and allocated-nonempty) are
-     * "allocate only" and do not memcpy from src.  Neither call
-     * touches the internal rep.  See ReadProc Stage 4.5 for the
-     * detailed branch analysis. */
-    Tcl_InvalidateStringRep(bodyBC);
-    if (bodySrcLen > 0) {
-        Tcl_InitStringRep(bodyBC, bodySrc, (size_t)bodySrcLen);
+    Tcl_Obj   *bodyBC = NULL;
+    if (img) {
+        /* Lazy: remember where the body lives and skip it.  The Proc gets
+         * the placeholder as its body; the OOShim arms the installed Method
+         * and LazyMethodInvoke decodes the block on first dispatch. */
+        const TbcxSection *sec    = &H->sections[3u + H->numProcs + methIdx];
+        uint64_t           srcOff = Tbcx_R_Tell(r);
+        if (!Tbcx_R_Seek(r, H, sec->offset + sec->length)) {
+            Tcl_DecrRefCount(argsObj);
+            Tcl_DecrRefCount(nameObj);
+            Tcl_DecrRefCount(clsFqn);
+            return TCL_ERROR;
+        }
+        bodyBC = NewLazyBody(img, srcOff, Tbcx_R_Tell(r), clsFqn);
+        Tcl_IncrRefCount(bodyBC);
+        os->lazyMethods = 1;
     } else {
-        Tcl_InitStringRep(bodyBC,
-            TBCX_STRIPPED_SOURCE_SENTINEL,
-            sizeof(TBCX_STRIPPED_SOURCE_SENTINEL) - 1u);
+        /* Body source text.  Read before the compiled block so we can
+         * attach it to the fresh body Tcl_Obj with Tcl_InitStringRep — that
+         * restores `info class method -body` / `info object method -body`
+         * round-trip fidelity.  Length==0 means the artifact was written
+         * without -include-source (the default for tbcx, matching the
+         * tclcompiler/tbcload tradition for Tcl AOT output); substitute
+         * the diagnostic sentinel so introspection is loud rather than
+         * silently empty. */
+        Tcl_Obj *bodySrc = Tbcx_R_StringObj(r);
+        if (!bodySrc) {
+            Tcl_DecrRefCount(argsObj);
+            Tcl_DecrRefCount(nameObj);
+            Tcl_DecrRefCount(clsFqn);
+            return TCL_ERROR;
+        }
+        Tcl_IncrRefCount(bodySrc);
+
+        /* compiled block (namespace default: class namespace) + receive numLocals */
+        clsNs  = (Namespace *)Tbcx_EnsureNamespace(ip, Tcl_GetString(clsFqn));
+        bodyBC = Tbcx_ReadBlock(r, ip, clsNs, &nLoc, 1, 0);
+        if (!bodyBC) {
+            Tcl_DecrRefCount(bodySrc);
+            Tcl_DecrRefCount(argsObj);
+            Tcl_DecrRefCount(nameObj);
+            Tcl_DecrRefCount(clsFqn);
+            return TCL_ERROR;
+        }
+        Tcl_IncrRefCount(bodyBC);
+
+        /* Attach source text as string rep: the decoded text moves over
+         * without a copy (AdoptStringRep).  The sentinel path needs
+         * Tcl_InvalidateStringRep() first — bodyBC->bytes is
+         * &tclEmptyString, and only the bytes==NULL branch of
+         * Tcl_InitStringRep copies from src.  See ReadProc Stage 4.5. */
+        if (bodySrc->length > 0) {
+            AdoptStringRep(bodyBC, bodySrc);
+        } else {
+            Tcl_DecrRefCount(bodySrc);
+            Tcl_InvalidateStringRep(bodyBC);
+            Tcl_InitStringRep(bodyBC,
+                TBCX_STRIPPED_SOURCE_SENTINEL,
+                sizeof(TBCX_STRIPPED_SOURCE_SENTINEL) - 1u);
+        }
+        bodySrc = NULL;
     }
-    Tcl_Free(bodySrc);
-    bodySrc = NULL;
     /* Build Proc + compiled locals from argsObj */
     Proc *procPtr = (Proc *)Tcl_Alloc(sizeof(Proc));
     memset(procPtr, 0, sizeof(Proc));
@@ -3008,553 +3906,134 @@ static int ReadMethod(TbcxIn *r, Tcl_Interp *ip, OOShim *os) {
     return TCL_OK;
 }
 
-/* ---- Extracted literal readers ----
- * Each handles one tag from the .tbcx literal stream.  Returns a refcount-0
- * Tcl_Obj* on success or NULL on error. */
-
-static Tcl_Obj *ReadLit_Bignum(TbcxIn *r) {
-    uint8_t  sign   = 0;
-    uint32_t magLen = 0;
-    if (!Tbcx_R_U8(r, &sign))
-        return NULL;
-    if (!Tbcx_R_U32(r, &magLen))
-        return NULL;
-    if (magLen > (64u * 1024u * 1024u)) {
-        R_Error(r, "tbcx: bignum too large");
-        return NULL;
-    }
-    Tcl_Obj *o = NULL;
-    if (magLen == 0 || sign == 0) {
-        o = Tcl_NewWideIntObj(0);
-    } else {
-        unsigned char *le = (unsigned char *)Tcl_AttemptAlloc(magLen);
-        if (!le) {
-            R_Error(r, "tbcx: allocation failed (bignum)");
-            return NULL;
-        }
-        if (!Tbcx_R_Bytes(r, le, magLen)) {
-            Tcl_Free((char *)le);
-            return NULL;
-        }
-        mp_int z;
-        mp_err mrc = TclBN_mp_init(&z);
-        if (mrc != MP_OKAY) {
-            Tcl_Free((char *)le);
-            R_Error(r, "tbcx: bignum init");
-            return NULL;
-        }
-        /* Import LE magnitude bytes into mp_int via repeated shift+add.
-         * Tcl 9.1's stubs table does not expose mp_from_ubin, so we use
-         * the portable TclBN_mp_mul_2d + TclBN_mp_add_d path. */
-        for (int i = (int)magLen - 1; i >= 0; i--) {
-            if ((mrc = TclBN_mp_mul_2d(&z, 8, &z)) != MP_OKAY)
-                break;
-            if ((mrc = TclBN_mp_add_d(&z, le[i], &z)) != MP_OKAY)
-                break;
-        }
-        if (mrc != MP_OKAY) {
-            Tcl_Free((char *)le);
-            TclBN_mp_clear(&z);
-            R_Error(r, "tbcx: bignum import");
-            return NULL;
-        }
-        if (sign == 2) {
-            mrc = TclBN_mp_neg(&z, &z);
-            if (mrc != MP_OKAY) {
-                Tcl_Free((char *)le);
-                TclBN_mp_clear(&z);
-                R_Error(r, "tbcx: bignum neg");
-                return NULL;
-            }
+/* Literal kinds tbcx::intern may share: values whose meaning is fixed by
+ * their string rep.  Lambdas and bytecode carry per-load compiled state,
+ * and byte arrays would be shimmered to strings just to be keyed. */
+#define TBCX_LIT_BIT(t) (1u << (t))
+#define TBCX_INTERN_TAGS                                                                                                                                             \
+    (TBCX_LIT_BIT(TBCX_LIT_BIGNUM) | TBCX_LIT_BIT(TBCX_LIT_BOOLEAN) | TBCX_LIT_BIT(TBCX_LIT_DICT) | TBCX_LIT_BIT(TBCX_LIT_DOUBLE) | TBCX_LIT_BIT(TBCX_LIT_LIST) |    \
+     TBCX_LIT_BIT(TBCX_LIT_STRING) | TBCX_LIT_BIT(TBCX_LIT_WIDEINT) | TBCX_LIT_BIT(TBCX_LIT_WIDEUINT) | TBCX_LIT_BIT(TBCX_LIT_STRREF))
+
+/* Plain strings may be used as command names, whose cmdName rep caches a
+ * resolution made in one namespace.  Those are keyed per namespace, as Tcl
+ * keys command-name literals, so blocks from two namespaces do not shimmer
+ * one object back and forth. */
+#define TBCX_INTERN_NAME_TAGS (TBCX_LIT_BIT(TBCX_LIT_STRING) | TBCX_LIT_BIT(TBCX_LIT_STRREF))
+
+/* InternPrune — drop the entries only the table still holds. */
+static void InternPrune(Tcl_HashTable *t) {
+    Tcl_HashSearch s;
+    /* Tcl_NextHashEntry has already stepped past e, so deleting it is safe */
+    for (Tcl_HashEntry *e = Tcl_FirstHashEntry(t, &s); e; e = Tcl_NextHashEntry(&s)) {
+        Tcl_Obj *o = (Tcl_Obj *)Tcl_GetHashValue(e);
+        if (o->refCount <= 1) {
+            Tcl_DeleteHashEntry(e);
+            Tcl_DecrRefCount(o);
         }
-        o = Tcl_NewBignumObj(&z);
-        Tcl_Free((char *)le);
     }
-    return o;
 }
 
-static Tcl_Obj *ReadLit_LambdaBC(TbcxIn *r, Tcl_Interp *ip, int depth, int dumpOnly) {
-    char    *nsStr = NULL;
-    uint32_t nsLen = 0;
-    if (!Tbcx_R_LPString(r, &nsStr, &nsLen))
-        return NULL;
-    Tcl_Obj *nsObj = Tcl_NewStringObj(nsStr, (Tcl_Size)nsLen);
-    Tcl_Free(nsStr);
-    Tcl_IncrRefCount(nsObj);
-
-    /* Validate namespace string: reject embedded NUL and require absolute form */
-    {
-        Tcl_Size    nsObjLen = 0;
-        const char *nsObjStr = Tbcx_GetStringFromObjStrict(ip, nsObj, &nsObjLen);
-        if (!nsObjStr || Tbcx_ValidateKeyString(ip, nsObjStr, nsObjLen, "lambda namespace", 1) != TCL_OK) {
-            Tcl_DecrRefCount(nsObj);
-            return NULL;
-        }
-    }
-
-    Namespace *nsPtr;
-    if (dumpOnly) {
-        nsPtr = (Namespace *)Tcl_FindNamespace(ip, Tcl_GetString(nsObj), NULL, 0);
-        if (!nsPtr)
-            nsPtr = (Namespace *)Tcl_GetGlobalNamespace(ip);
+/* InternLiteral — return the interp's shared object for lit's string rep,
+ * adopting lit when it is the first.  Keyed by string like Tcl's own
+ * literal table, so "1" and 1 share one object; nsPtr, when not NULL,
+ * scopes the key to that namespace.  Long strings stay private: they
+ * rarely repeat and would only bloat the keys.  A full table is pruned
+ * first, and lit stays private if that frees nothing. */
+static Tcl_Obj *InternLiteral(Tcl_HashTable *t, Namespace *nsPtr, Tcl_Obj *lit) {
+    Tcl_Size    len;
+    const char *str = Tcl_GetStringFromObj(lit, &len);
+    if ((size_t)len > TBCX_STRTAB_INTERN_MAX)
+        return lit;
+    /* ":str" or "<ns>:str"; %p never starts with or contains a colon */
+    char        pfx[2 * sizeof(void *) + 8] = ":";
+    Tcl_DString key;
+    Tcl_DStringInit(&key);
+    if (nsPtr)
+        snprintf(pfx, sizeof(pfx), "%p:", (void *)nsPtr);
+    Tcl_DStringAppend(&key, pfx, -1);
+    Tcl_DStringAppend(&key, str, len);
+    Tcl_Obj       *shared = lit;
+    Tcl_HashEntry *e      = Tcl_FindHashEntry(t, Tcl_DStringValue(&key));
+    if (e) {
+        shared = (Tcl_Obj *)Tcl_GetHashValue(e);
     } else {
-        nsPtr = (Namespace *)Tbcx_EnsureNamespace(ip, Tcl_GetString(nsObj));
-        if (!nsPtr) {
-            Tcl_DecrRefCount(nsObj);
-            return NULL;
+        if (t->numEntries >= TBCX_INTERN_MAX)
+            InternPrune(t);
+        if (t->numEntries < TBCX_INTERN_MAX) {
+            int isNew;
+            e = Tcl_CreateHashEntry(t, Tcl_DStringValue(&key), &isNew);
+            Tcl_IncrRefCount(lit);
+            Tcl_SetHashValue(e, lit);
         }
     }
-
-    /* Read argument specifications */
-    uint32_t numArgs = 0;
-    if (!Tbcx_R_U32(r, &numArgs)) {
-        Tcl_DecrRefCount(nsObj);
-        return NULL;
-    }
-    if (numArgs > TBCX_MAX_LOCALS) {
-        R_Error(r, "tbcx: too many lambda arguments");
-        Tcl_DecrRefCount(nsObj);
-        return NULL;
-    }
-    Tcl_Obj *argList = Tcl_NewListObj(0, NULL);
-    Tcl_IncrRefCount(argList);
-    for (uint32_t i = 0; i < numArgs; i++) {
-        char    *argName    = NULL;
-        uint32_t argNameLen = 0;
-        if (!Tbcx_R_LPString(r, &argName, &argNameLen)) {
-            Tcl_DecrRefCount(nsObj);
-            Tcl_DecrRefCount(argList);
-            return NULL;
-        }
-        Tcl_Obj *argNameObj = Tcl_NewStringObj(argName, (Tcl_Size)argNameLen);
-        Tcl_IncrRefCount(argNameObj);
-        Tcl_Free(argName);
-        uint8_t hasDef = 0;
-        if (!Tbcx_R_U8(r, &hasDef)) {
-            Tcl_DecrRefCount(nsObj);
-            Tcl_DecrRefCount(argNameObj);
-            Tcl_DecrRefCount(argList);
-            return NULL;
-        }
-        if (hasDef) {
-            Tcl_Obj *defVal = ReadLiteral(r, ip, depth + 1, dumpOnly);
-            if (!defVal) {
-                Tcl_DecrRefCount(nsObj);
-                Tcl_DecrRefCount(argNameObj);
-                Tcl_DecrRefCount(argList);
-                return NULL;
-            }
-            /* Own a reference so all error paths can release safely.
-             * ReadLiteral returns refcount-0; incref → 1 (owned by this scope). */
-            Tcl_IncrRefCount(defVal);
-            Tcl_Obj *argPair = Tcl_NewListObj(0, NULL);
-            Tcl_IncrRefCount(argPair);
-            if (Tcl_ListObjAppendElement(ip, argPair, argNameObj) != TCL_OK || Tcl_ListObjAppendElement(ip, argPair, defVal) != TCL_OK || Tcl_ListObjAppendElement(ip, argList, argPair) != TCL_OK) {
-                Tcl_DecrRefCount(argPair);
-                Tcl_DecrRefCount(defVal);
-                Tcl_DecrRefCount(argNameObj);
-                Tcl_DecrRefCount(nsObj);
-                Tcl_DecrRefCount(argList);
-                return NULL;
-            }
-            Tcl_DecrRefCount(argPair);
-            Tcl_DecrRefCount(defVal); /* list now owns its reference */
-            Tcl_DecrRefCount(argNameObj);
-        } else {
-            if (Tcl_ListObjAppendElement(ip, argList, argNameObj) != TCL_OK) {
-                Tcl_DecrRefCount(argNameObj);
-                Tcl_DecrRefCount(nsObj);
-                Tcl_DecrRefCount(argList);
-                return NULL;
-            }
-            Tcl_DecrRefCount(argNameObj);
-        }
+    Tcl_DStringFree(&key);
+    if (shared != lit) {
+        Tcl_IncrRefCount(lit); /* frees lit unless a string table holds it */
+        Tcl_DecrRefCount(lit);
     }
+    return shared;
+}
 
-    /* Build Proc with precompiled bytecode */
-    Proc *procPtr = (Proc *)Tcl_Alloc(sizeof(Proc));
-    memset(procPtr, 0, sizeof(Proc));
-    procPtr->iPtr     = (Interp *)ip;
-    procPtr->refCount = 1;
-    {
-        CompiledLocal *first = NULL, *last = NULL;
-        Tcl_Size       numA = 0;
-        if (Tbcx_BuildLocals(ip, argList, &first, &last, &numA) != TCL_OK) {
-            Tcl_DecrRefCount(nsObj);
-            Tcl_DecrRefCount(argList);
-            Tcl_Free((char *)procPtr);
-            return NULL;
+/* FreeAuxPayloads — invoke each AuxData entry's type->freeProc on its
+ * clientData.  The array itself lives in the decode arena.
+ *
+ * Releasing only the array on a post-ReadAuxArray failure path leaks every
+ * clientData payload (hash tables for JumptableInfo/JumptableNumInfo,
+ * local-index arrays for DictUpdateInfo, ForeachInfo struct).  Use this
+ * helper on every failure path BEFORE ownership transfers into the
+ * packed ByteCode via ByteCodeObj(). */
+static void FreeAuxPayloads(AuxData *arr, uint32_t n) {
+    if (!arr)
+        return;
+    for (uint32_t i = 0; i < n; i++) {
+        if (arr[i].type && arr[i].type->freeProc && arr[i].clientData) {
+            arr[i].type->freeProc(arr[i].clientData);
+            arr[i].clientData = NULL;
         }
-        procPtr->numArgs           = numA;
-        procPtr->numCompiledLocals = numA;
-        procPtr->firstLocalPtr     = first;
-        procPtr->lastLocalPtr      = last;
     }
+}
 
-    uint32_t nLocalsBody = 0;
-    Tcl_Obj *bodyBC      = Tbcx_ReadBlock(r, ip, nsPtr, &nLocalsBody, 1, dumpOnly);
-    if (!bodyBC) {
-        Tcl_DecrRefCount(nsObj);
-        Tcl_DecrRefCount(argList);
-        Tbcx_FreeLocals(procPtr->firstLocalPtr);
-        Tcl_Free((char *)procPtr);
-        return NULL;
+static int ReadAuxArray(TbcxIn *r, TbcxArena *a, AuxData **auxOut, uint32_t *numAuxOut) {
+    uint32_t n = 0;
+    if (!Tbcx_R_Var(r, &n))
+        return 0;
+    if (n > TBCX_MAX_AUX) {
+        R_Error(r, "tbcx: aux too many");
+        return 0;
     }
-    Tcl_IncrRefCount(bodyBC); /* own immediately — don't leave at refcount 0 */
-    procPtr->bodyPtr = bodyBC;
-    Tcl_IncrRefCount(bodyBC); /* Proc's own reference */
-    {
-        ByteCode *bc = TbcxGetByteCode(bodyBC);
-        if (bc)
-            TbcxFixupByteCode(bc, procPtr, ip, nsPtr, TBCX_FIXUP_CACHE_KEEP);
+    AuxData *arr = NULL;
+    if (n) {
+        size_t auxBytes = 0;
+        if (!tbcx_checked_mul(sizeof(AuxData), n, &auxBytes)) {
+            R_Error(r, "tbcx: aux array size overflow");
+            return 0;
+        }
+        arr = (AuxData *)ArenaAlloc(a, auxBytes);
+        if (!arr) {
+            R_Error(r, "tbcx: allocation failed (aux array)");
+            return 0;
+        }
     }
-    CompiledLocals(procPtr, (Tcl_Size)nLocalsBody);
+    if (!ReadAuxEntries(r, a, arr, n))
+        return 0;
+    *auxOut    = arr;
+    *numAuxOut = n;
+    return 1;
+}
 
-    /* Read original body source text */
-    char    *bodySrc    = NULL;
-    uint32_t bodySrcLen = 0;
-    if (!Tbcx_R_LPString(r, &bodySrc, &bodySrcLen)) {
-        ByteCode *bc2 = NULL;
-        bc2           = TbcxGetByteCode(bodyBC);
-        if (bc2)
-            bc2->procPtr = NULL;
-        Tcl_DecrRefCount(bodyBC); /* Proc's reference */
-        Tcl_DecrRefCount(bodyBC); /* local reference  */
-        Tbcx_FreeLocals(procPtr->firstLocalPtr);
-        Tcl_Free((char *)procPtr);
-        Tcl_DecrRefCount(nsObj);
-        Tcl_DecrRefCount(argList);
-        return NULL;
-    }
-
-    /* Build lambda Tcl_Obj with original body source in string rep */
-    Tcl_Obj *lambda;
-    {
-        const char *nsName   = Tbcx_GetStringSafe(nsObj);
-        int         isGlobal = (nsName[0] == ':' && nsName[1] == ':' && nsName[2] == '\0');
-        Tcl_Obj    *bodyText = Tcl_NewStringObj(bodySrc, (Tcl_Size)bodySrcLen);
-        Tcl_Free(bodySrc);
-        if (isGlobal) {
-            Tcl_Obj *elems[2] = {argList, bodyText};
-            lambda            = Tcl_NewListObj(2, elems);
-        } else {
-            Tcl_Obj *elems[3] = {argList, bodyText, nsObj};
-            lambda            = Tcl_NewListObj(3, elems);
-        }
-        (void)Tbcx_GetStringSafe(lambda);
-    }
-
-    /* Register in ApplyShim for shimmer recovery (skip in dump mode) */
-    if (!dumpOnly) {
-        RegisterPrecompiledLambda(ip, lambda, procPtr, nsObj);
-        Tcl_DecrRefCount(bodyBC); /* local reference */
-    } else {
-        ByteCode *bc2 = NULL;
-        bc2           = TbcxGetByteCode(bodyBC);
-        if (bc2)
-            bc2->procPtr = NULL;
-        Tcl_DecrRefCount(bodyBC); /* Proc's reference */
-        Tcl_DecrRefCount(bodyBC); /* local reference  */
-        Tbcx_FreeLocals(procPtr->firstLocalPtr);
-        Tcl_Free((char *)procPtr);
-    }
-
-    Tcl_DecrRefCount(argList);
-    Tcl_DecrRefCount(nsObj);
-    return lambda;
-}
-
-static Tcl_Obj *ReadLiteral(TbcxIn *r, Tcl_Interp *ip, int depth, int dumpOnly) {
-    if (depth > TBCX_MAX_LITERAL_DEPTH) {
-        R_Error(r, "tbcx: literal nesting too deep");
-        return NULL;
-    }
-
-    uint32_t tag = 0;
-    if (!Tbcx_R_U32(r, &tag))
-        return NULL;
-
-    switch (tag) {
-    case TBCX_LIT_BIGNUM:
-        return ReadLit_Bignum(r);
-    case TBCX_LIT_BOOLEAN: {
-        uint8_t b = 0;
-        if (!Tbcx_R_U8(r, &b))
-            return NULL;
-        return Tcl_NewBooleanObj(b ? 1 : 0);
-    }
-    case TBCX_LIT_BYTEARR: {
-        uint32_t n = 0;
-        if (!Tbcx_R_U32(r, &n))
-            return NULL;
-        if (n > TBCX_MAX_STR) {
-            R_Error(r, "tbcx: bytearray too large");
-            return NULL;
-        }
-        unsigned char *buf = (unsigned char *)Tcl_AttemptAlloc(n ? n : 1u);
-        if (!buf) {
-            R_Error(r, "tbcx: allocation failed (bytearray literal)");
-            return NULL;
-        }
-        if (n && !Tbcx_R_Bytes(r, buf, n)) {
-            Tcl_Free((char *)buf);
-            return NULL;
-        }
-        Tcl_Obj *o = Tcl_NewByteArrayObj(buf, n);
-        Tcl_Free((char *)buf);
-        return o;
-    }
-    case TBCX_LIT_DICT: {
-        uint32_t cnt = 0;
-        if (!Tbcx_R_U32(r, &cnt))
-            return NULL;
-        if (cnt > TBCX_MAX_CONTAINER_ELEMS) {
-            R_Error(r, "tbcx: dict too many pairs");
-            return NULL;
-        }
-        Tcl_Obj *d = Tcl_NewDictObj();
-        for (uint32_t i = 0; i < cnt; i++) {
-            Tcl_Obj *k = ReadLiteral(r, ip, depth + 1, dumpOnly);
-            if (!k) {
-                Tcl_IncrRefCount(d);
-                Tcl_DecrRefCount(d);
-                return NULL;
-            }
-            Tcl_Obj *v = ReadLiteral(r, ip, depth + 1, dumpOnly);
-            if (!v) {
-                Tcl_IncrRefCount(k);
-                Tcl_DecrRefCount(k);
-                Tcl_IncrRefCount(d);
-                Tcl_DecrRefCount(d);
-                return NULL;
-            }
-            if (Tcl_DictObjPut(ip, d, k, v) != TCL_OK) {
-                Tcl_IncrRefCount(k);
-                Tcl_DecrRefCount(k);
-                Tcl_IncrRefCount(v);
-                Tcl_DecrRefCount(v);
-                Tcl_IncrRefCount(d);
-                Tcl_DecrRefCount(d);
-                return NULL;
-            }
-        }
-        return d;
-    }
-    case TBCX_LIT_DOUBLE: {
-        uint64_t bits = 0;
-        if (!Tbcx_R_U64(r, &bits))
-            return NULL;
-        union {
-            uint64_t u;
-            double   d;
-        } u;
-        u.u = bits;
-        return Tcl_NewDoubleObj(u.d);
-    }
-    case TBCX_LIT_LIST: {
-        uint32_t n = 0;
-        if (!Tbcx_R_U32(r, &n))
-            return NULL;
-        if (n > TBCX_MAX_CONTAINER_ELEMS) {
-            R_Error(r, "tbcx: list too many elements");
-            return NULL;
-        }
-        Tcl_Obj *lst = Tcl_NewListObj(0, NULL);
-        for (uint32_t i = 0; i < n; i++) {
-            Tcl_Obj *e = ReadLiteral(r, ip, depth + 1, dumpOnly);
-            if (!e) {
-                Tcl_IncrRefCount(lst);
-                Tcl_DecrRefCount(lst);
-                return NULL;
-            }
-            if (Tcl_ListObjAppendElement(ip, lst, e) != TCL_OK) {
-                /* e has refCount 0 — free it before freeing lst. */
-                Tcl_IncrRefCount(e);
-                Tcl_DecrRefCount(e);
-                Tcl_IncrRefCount(lst);
-                Tcl_DecrRefCount(lst);
-                return NULL;
-            }
-        }
-        return lst;
-    }
-    case TBCX_LIT_WIDEINT: {
-        uint64_t u = 0;
-        if (!Tbcx_R_U64(r, &u))
-            return NULL;
-        /* stored as 2's complement */
-        Tcl_WideInt wi = (Tcl_WideInt)u;
-        return Tcl_NewWideIntObj(wi);
-    }
-    case TBCX_LIT_WIDEUINT: {
-        uint64_t u = 0;
-        if (!Tbcx_R_U64(r, &u))
-            return NULL;
-        if (u <= (uint64_t)TCL_INDEX_NONE) {
-            return Tcl_NewWideIntObj((Tcl_WideInt)u);
-        } else {
-            /* promote to bignum */
-            mp_int z;
-            mp_err mrc = TclBN_mp_init(&z);
-            if (mrc != MP_OKAY) {
-                R_Error(r, "tbcx: wideuint init");
-                return NULL;
-            }
-            /* Portable path: build from 8 bytes with shift/add so we can
-               keep checking mp_err on each TomMath call. */
-            for (int i = 7; i >= 0; i--) {
-                mrc = TclBN_mp_mul_2d(&z, 8, &z);
-                if (mrc != MP_OKAY)
-                    break;
-                mrc = TclBN_mp_add_d(&z, (unsigned int)((u >> (8 * i)) & 0xFFu), &z);
-                if (mrc != MP_OKAY)
-                    break;
-            }
-            if (mrc != MP_OKAY) {
-                TclBN_mp_clear(&z);
-                R_Error(r, "tbcx: wideuint import");
-                return NULL;
-            }
-            Tcl_Obj *o = Tcl_NewBignumObj(&z);
-            return o;
-        }
-    }
-    case TBCX_LIT_BYTESRC: {
-        /* source text + nsFQN + compiled block.
-           The source text becomes the Tcl_Obj's string rep so Tcl can
-           recompile from source when evaluated in a different interpreter
-           (e.g. interp eval) or after a compile-epoch bump (ProcShim).
-           PRECOMPILED is NOT set — this allows Tcl to gracefully
-           recompile instead of erroring with "jumped interps". */
-        char    *srcStr = NULL;
-        uint32_t srcLen = 0;
-        if (!Tbcx_R_LPString(r, &srcStr, &srcLen))
-            return NULL;
-        char    *nsStr = NULL;
-        uint32_t nsLen = 0;
-        if (!Tbcx_R_LPString(r, &nsStr, &nsLen)) {
-            Tcl_Free(srcStr);
-            return NULL;
-        }
-        Tcl_Obj *nsObj = Tcl_NewStringObj(nsStr, (Tcl_Size)nsLen);
-        Tcl_IncrRefCount(nsObj);
-        Tcl_Free(nsStr);
-        {
-            Tcl_Size    nsObjLen = 0;
-            const char *nsObjStr = Tbcx_GetStringFromObjStrict(ip, nsObj, &nsObjLen);
-            if (!nsObjStr || Tbcx_ValidateKeyString(ip, nsObjStr, nsObjLen, "bytesrc literal namespace", 1) != TCL_OK) {
-                Tcl_DecrRefCount(nsObj);
-                Tcl_Free(srcStr);
-                return NULL;
-            }
-        }
-        Namespace *nsPtr;
-        if (dumpOnly)
-            nsPtr = (Namespace *)Tcl_FindNamespace(ip, Tcl_GetString(nsObj), NULL, 0);
-        else
-            nsPtr = (Namespace *)Tbcx_EnsureNamespace(ip, Tcl_GetString(nsObj));
-        if (!nsPtr) {
-            if (dumpOnly)
-                nsPtr = (Namespace *)Tcl_GetGlobalNamespace(ip);
-            else {
-                R_Error(r, "tbcx: namespace creation failed for bytesrc literal");
-                Tcl_DecrRefCount(nsObj);
-                Tcl_Free(srcStr);
-                return NULL;
-            }
-        }
-        uint32_t dummyNL = 0;
-        /* setPrecompiled=0: BYTESRC literals have source text, so Tcl
-           CAN recompile from the string rep.  Without PRECOMPILED, Tcl
-           will recompile on compile-epoch mismatch (after ProcShim bumps
-           the epoch) or interpHandle mismatch (child interp / interp eval).
-           This is correct — the bytecode is a cache, the source is the
-           ground truth.  With PRECOMPILED=1, Tcl would error with
-           "compiled script jumped interps" on interpHandle mismatch
-           instead of gracefully recompiling. */
-        Tcl_Obj *bc      = Tbcx_ReadBlock(r, ip, nsPtr, &dummyNL, 0, dumpOnly);
-        Tcl_DecrRefCount(nsObj);
-        if (bc && srcLen > 0) {
-            /* Replace the empty string rep with the preserved source text.
-               The bytecode internal rep is untouched.  When evaluated in a
-               different interpreter (interp eval), Tcl detects the interp
-               mismatch and recompiles from this source text, avoiding the
-               "compiled script jumped interps" error. */
-            Tcl_InvalidateStringRep(bc);
-            Tcl_InitStringRep(bc, srcStr, (Tcl_Size)srcLen);
-        }
-        Tcl_Free(srcStr);
-        return bc;
-    }
-    case TBCX_LIT_LAMBDA_BC:
-        return ReadLit_LambdaBC(r, ip, depth, dumpOnly);
-    case TBCX_LIT_STRING: {
-        char    *s = NULL;
-        uint32_t n = 0;
-        if (!Tbcx_R_LPString(r, &s, &n))
-            return NULL;
-        Tcl_Obj *o = Tcl_NewStringObj(s, (Tcl_Size)n);
-        Tcl_Free(s);
-        return o;
-    }
-    default:
-        R_Error(r, "tbcx: unknown literal tag");
-        return NULL;
-    }
-}
-
-/* FreeAuxArrayOwned — deep-free an AuxData array, invoking each entry's
- * type->freeProc on its clientData before releasing the array itself.
- *
- * Shallow `Tcl_Free(arr)` on a post-ReadAuxArray failure path leaks every
- * clientData payload (hash tables for JumptableInfo/JumptableNumInfo,
- * local-index arrays for DictUpdateInfo, ForeachInfo struct).  Use this
- * helper on every failure path BEFORE ownership transfers into the
- * packed ByteCode via ByteCodeObj(). */
-static void FreeAuxArrayOwned(AuxData *arr, uint32_t n) {
-    if (!arr)
-        return;
-    for (uint32_t i = 0; i < n; i++) {
-        if (arr[i].type && arr[i].type->freeProc && arr[i].clientData) {
-            arr[i].type->freeProc(arr[i].clientData);
-            arr[i].clientData = NULL;
-        }
-    }
-    Tcl_Free(arr);
-}
-
-static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
-    uint32_t n = 0;
-    if (!Tbcx_R_U32(r, &n))
-        return 0;
-    if (n > TBCX_MAX_AUX) {
-        R_Error(r, "tbcx: aux too many");
-        return 0;
-    }
-    AuxData *arr = NULL;
-    if (n) {
-        size_t auxBytes = 0;
-        if (!tbcx_checked_mul(sizeof(AuxData), n, &auxBytes)) {
-            R_Error(r, "tbcx: aux array size overflow");
-            return 0;
-        }
-        arr = (AuxData *)Tcl_AttemptAlloc(auxBytes);
-        if (!arr) {
-            R_Error(r, "tbcx: allocation failed (aux array)");
-            return 0;
-        }
-    }
-
-    uint32_t i = 0; /* declared here so fail_aux can reference it */
-    for (i = 0; i < n; i++) {
-        uint32_t tag = 0;
-        if (!Tbcx_R_U32(r, &tag))
-            goto fail_aux;
+/* ReadAuxEntries — decode n tagged AuxData entries into arr.  On failure
+ * the payloads of the entries already decoded are freed again. */
+static int ReadAuxEntries(TbcxIn *r, TbcxArena *a, AuxData *arr, uint32_t n) {
+    uint32_t i = 0; /* declared here so fail_aux can reference it */
+    for (i = 0; i < n; i++) {
+        uint32_t tag = 0;
+        if (!Tbcx_R_Var(r, &tag))
+            goto fail_aux;
 
         if (tag == TBCX_AUX_JT_STR) {
-            /* u32 cnt, then cnt × (LPString key, u32 pcOffset) */
+            /* varint cnt, then cnt × (LPString key, varint pcOffset) */
             uint32_t cnt = 0;
-            if (!Tbcx_R_U32(r, &cnt))
+            if (!Tbcx_R_Var(r, &cnt))
                 goto fail_aux;
             if (cnt > TBCX_MAX_LITERALS) {
                 R_Error(r, "tbcx: jump table too large");
@@ -3575,7 +4054,7 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
                     goto fail_aux;
                 }
                 uint32_t off = 0;
-                if (!Tbcx_R_U32(r, &off)) {
+                if (!Tbcx_R_Var(r, &off)) {
                     Tcl_Free(s);
                     Tcl_DeleteHashTable(&info->hashTable);
                     Tcl_Free(info);
@@ -3591,7 +4070,7 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
             arr[i].clientData = info;
         } else if (tag == TBCX_AUX_JT_NUM) {
             uint32_t cnt = 0;
-            if (!Tbcx_R_U32(r, &cnt))
+            if (!Tbcx_R_Var(r, &cnt))
                 goto fail_aux;
             if (cnt > TBCX_MAX_LITERALS) {
                 R_Error(r, "tbcx: numeric jump table too large");
@@ -3611,7 +4090,7 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
                 uint64_t key = 0;
                 uint32_t off = 0;
 
-                if (!Tbcx_R_U64(r, &key) || !Tbcx_R_U32(r, &off)) {
+                if (!Tbcx_R_U64(r, &key) || !Tbcx_R_Var(r, &off)) {
                     /* cleanup on short read */
                     Tcl_DeleteHashTable(&info->hashTable);
                     Tcl_Free(info);
@@ -3635,7 +4114,7 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
             arr[i].clientData = info;
         } else if (tag == TBCX_AUX_DICTUPD) {
             uint32_t L = 0;
-            if (!Tbcx_R_U32(r, &L))
+            if (!Tbcx_R_Var(r, &L))
                 goto fail_aux;
             if (L > TBCX_MAX_LITERALS) {
                 R_Error(r, "tbcx: dict-update aux too large");
@@ -3655,14 +4134,18 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
             }
             memset(info, 0, bytes);
             info->length = (Tcl_Size)L;
-            for (uint32_t k = 0; k < L; k++) {
-                uint32_t x = 0;
-                if (!Tbcx_R_U32(r, &x)) {
-                    Tcl_Free(info);
-                    goto fail_aux;
-                }
-                info->varIndices[k] = (Tcl_Size)x;
+            uint32_t *idx = L ? (uint32_t *)ArenaAlloc(a, sizeof(uint32_t) * (size_t)L) : NULL;
+            if (L && !idx) {
+                R_Error(r, "tbcx: allocation failed (dictupdate)");
+                Tcl_Free(info);
+                goto fail_aux;
+            }
+            if (!Tbcx_R_VarArray(r, idx, L)) {
+                Tcl_Free(info);
+                goto fail_aux;
             }
+            for (uint32_t k = 0; k < L; k++)
+                info->varIndices[k] = (Tcl_Size)idx[k];
             arr[i].type       = tbcxAuxDictUpdate;
             arr[i].clientData = info;
         } else if (tag == TBCX_AUX_NEWFORE) {
@@ -3672,7 +4155,7 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
             }
 
             uint32_t numLists = 0, loopCtU = 0, firstValU = 0, dupNumLists = 0;
-            if (!Tbcx_R_U32(r, &numLists) || !Tbcx_R_U32(r, &loopCtU) || !Tbcx_R_U32(r, &firstValU) || !Tbcx_R_U32(r, &dupNumLists))
+            if (!Tbcx_R_Var(r, &numLists) || !Tbcx_R_Var(r, &loopCtU) || !Tbcx_R_Var(r, &firstValU) || !Tbcx_R_Var(r, &dupNumLists))
                 goto fail_aux;
             if (dupNumLists != numLists) {
                 R_Error(r, "tbcx: foreach aux mismatch");
@@ -3699,7 +4182,7 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
             info->loopCtTemp     = (Tcl_LVTIndex)(int32_t)loopCtU;
             for (uint32_t iL = 0; iL < numLists; iL++) {
                 uint32_t nv = 0;
-                if (!Tbcx_R_U32(r, &nv)) {
+                if (!Tbcx_R_Var(r, &nv)) {
                     arr[i].type       = tbcxAuxNewForeach;
                     arr[i].clientData = info;
                     i++; /* count this entry so fail_aux frees it */
@@ -3730,18 +4213,19 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
                     goto fail_aux;
                 }
                 memset(vl, 0, vlBytes);
-                vl->numVars = (Tcl_Size)nv;
-                for (uint32_t j = 0; j < nv; j++) {
-                    uint32_t idx = 0;
-                    if (!Tbcx_R_U32(r, &idx)) {
-                        Tcl_Free(vl);
-                        arr[i].type       = tbcxAuxNewForeach;
-                        arr[i].clientData = info;
-                        i++;
-                        goto fail_aux;
-                    }
-                    vl->varIndexes[j] = (Tcl_LVTIndex)idx;
+                vl->numVars   = (Tcl_Size)nv;
+                uint32_t *idx = nv ? (uint32_t *)ArenaAlloc(a, sizeof(uint32_t) * (size_t)nv) : NULL;
+                if ((nv && !idx) || !Tbcx_R_VarArray(r, idx, nv)) {
+                    if (nv && !idx)
+                        R_Error(r, "tbcx: allocation failed (foreach varlist)");
+                    Tcl_Free(vl);
+                    arr[i].type       = tbcxAuxNewForeach;
+                    arr[i].clientData = info;
+                    i++;
+                    goto fail_aux;
                 }
+                for (uint32_t j = 0; j < nv; j++)
+                    vl->varIndexes[j] = (Tcl_LVTIndex)idx[j];
                 info->varLists[iL] = vl;
             }
             arr[i].type       = tbcxAuxNewForeach;
@@ -3751,24 +4235,17 @@ static int ReadAuxArray(TbcxIn *r, AuxData **auxOut, uint32_t *numAuxOut) {
             goto fail_aux;
         }
     }
-    *auxOut    = arr;
-    *numAuxOut = n;
     return 1;
 
 fail_aux:
     /* Free already-completed AuxData entries [0..i) via their type's freeProc */
-    for (uint32_t j = 0; j < i; j++) {
-        if (arr[j].type && arr[j].type->freeProc && arr[j].clientData)
-            arr[j].type->freeProc(arr[j].clientData);
-    }
-    if (arr)
-        Tcl_Free(arr);
+    FreeAuxPayloads(arr, i);
     return 0;
 }
 
-static int ReadExceptions(TbcxIn *r, ExceptionRange **exOut, uint32_t *numOut) {
+static int ReadExceptions(TbcxIn *r, TbcxArena *a, ExceptionRange **exOut, uint32_t *numOut) {
     uint32_t n = 0;
-    if (!Tbcx_R_U32(r, &n))
+    if (!Tbcx_R_Var(r, &n))
         return 0;
     if (n > TBCX_MAX_EXCEPT) {
         R_Error(r, "tbcx: too many exceptions");
@@ -3781,31 +4258,37 @@ static int ReadExceptions(TbcxIn *r, ExceptionRange **exOut, uint32_t *numOut) {
             R_Error(r, "tbcx: exception array size overflow");
             return 0;
         }
-        arr = (ExceptionRange *)Tcl_AttemptAlloc(exBytes);
+        arr = (ExceptionRange *)ArenaAlloc(a, exBytes);
         if (!arr) {
             R_Error(r, "tbcx: allocation failed (exception array)");
             return 0;
         }
     }
-    for (uint32_t i = 0; i < n; i++) {
-        uint8_t  type8   = 0;
-        uint32_t len     = 0;
-        uint32_t nesting = 0, from = 0, cont = 0, brk = 0, cat = 0;
-        if (!Tbcx_R_U8(r, &type8) || !Tbcx_R_U32(r, &nesting) || !Tbcx_R_U32(r, &from) || !Tbcx_R_U32(r, &len) || !Tbcx_R_U32(r, &cont) || !Tbcx_R_U32(r, &brk) || !Tbcx_R_U32(r, &cat)) {
-            if (arr)
-                Tcl_Free(arr);
+    /* Each range is seven fields: a type byte and six varints.  The type
+     * is 0 or 1, which reads the same as a one-byte varint, so the whole
+     * table decodes in one bulk pass (anything else is rejected below). */
+    uint32_t *f = NULL;
+    if (n) {
+        f = (uint32_t *)ArenaAlloc(a, sizeof(uint32_t) * 7u * (size_t)n);
+        if (!f) {
+            R_Error(r, "tbcx: allocation failed (exception array)");
             return 0;
         }
+        if (!Tbcx_R_VarArray(r, f, 7u * n))
+            return 0;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        const uint32_t *e       = f + 7u * (size_t)i;
+        uint32_t        type8   = e[0];
+        uint32_t        nesting = e[1], from = e[2], len = e[3], cont = e[4], brk = e[5], cat = e[6];
         /* Reject out-of-enum exception-range types from the wire.
          * Tcl's evaluator treats everything that is not CATCH as
          * loop-like control metadata, so a crafted `.tbcx` with e.g.
          * type8 = 99 could alter break/continue unwinding behaviour
          * even when offsets are in range. */
-        if (type8 != (uint8_t)LOOP_EXCEPTION_RANGE &&
-            type8 != (uint8_t)CATCH_EXCEPTION_RANGE) {
+        if (type8 != (uint32_t)LOOP_EXCEPTION_RANGE &&
+            type8 != (uint32_t)CATCH_EXCEPTION_RANGE) {
             R_Error(r, "tbcx: invalid exception range type");
-            if (arr)
-                Tcl_Free(arr);
             return 0;
         }
         arr[i].type           = (ExceptionRangeType)type8;
@@ -3817,23 +4300,10 @@ static int ReadExceptions(TbcxIn *r, ExceptionRange **exOut, uint32_t *numOut) {
         arr[i].continueOffset = (cont == 0xFFFFFFFFu) ? (Tcl_Size)-1 : (Tcl_Size)cont;
         arr[i].breakOffset    = (brk == 0xFFFFFFFFu) ? (Tcl_Size)-1 : (Tcl_Size)brk;
         arr[i].catchOffset    = (cat == 0xFFFFFFFFu) ? (Tcl_Size)-1 : (Tcl_Size)cat;
-        /* Tighten the metadata shape: LOOP ranges must not carry a catch
-         * offset, CATCH ranges must not carry break/continue offsets. */
-        if (arr[i].type == LOOP_EXCEPTION_RANGE) {
-            if (arr[i].catchOffset != (Tcl_Size)-1) {
-                R_Error(r, "tbcx: LOOP exception range with non-sentinel catchOffset");
-                if (arr)
-                    Tcl_Free(arr);
-                return 0;
-            }
-        } else {
-            if (arr[i].breakOffset != (Tcl_Size)-1 ||
-                arr[i].continueOffset != (Tcl_Size)-1) {
-                R_Error(r, "tbcx: CATCH exception range with non-sentinel break/continueOffset");
-                if (arr)
-                    Tcl_Free(arr);
-                return 0;
-            }
+        const char *bad       = r->trusted ? NULL : ExceptRangeShapeError(&arr[i], (Tcl_Size)n);
+        if (bad) {
+            R_Error(r, bad);
+            return 0;
         }
     }
     *exOut  = arr;
@@ -3841,99 +4311,64 @@ static int ReadExceptions(TbcxIn *r, ExceptionRange **exOut, uint32_t *numOut) {
     return 1;
 }
 
-/* ValidateBlockOperands — semantic validation pass over the raw instruction
- * stream from the wire.  Runs after the literal/aux/exception sections have
- * been parsed and sized, BEFORE TbcxByteCode() hands the block to Tcl's
- * evaluator.
- *
- * Validates:
- *   1) opcode byte <= LAST_INST_OPCODE;
- *   2) each instruction is fully contained within [0, codeLen);
- *   3) every LIT1/LIT4 operand is < numLits;
- *   4) every LVT1/LVT4 operand is < numLocals;
- *   5) every AUX4 operand is < numAux;
- *   6) every OFFSET1/OFFSET4 operand produces a target in [0, codeLen)
- *      AND lands on a recorded instruction boundary;
- *   7) every JumptableInfo/JumptableNumInfo hash entry's stored offset
- *      satisfies the same in-range + on-boundary constraint.
- *
- * Without this pass, a crafted .tbcx with e.g. INST_PUSH <huge> can cause
- * an out-of-bounds read of codePtr->objArrayPtr at runtime inside Tcl's
- * evaluator.  The evaluator itself does not revalidate operands (by
- * design — the compiler is trusted), so revalidation MUST happen at
- * load time for untrusted artifacts.
+/* ==========================================================================
+ * Operand validation
  *
- * Returns TCL_OK on success; on failure, sets an interpreter result
- * describing the offending instruction and returns TCL_ERROR. */
-/* Currently uncalled — operand validation is omitted for load speed.  Kept
- * in-source, marked unused, so it can be restored without re-deriving the
- * validation logic. */
-static int TBCX_MAYBE_UNUSED ValidateBlockOperands(
-    Tcl_Interp *ip,
-    const unsigned char *code, uint32_t codeLen,
-    uint32_t numLits, uint32_t numAux, uint32_t numLocals,
-    AuxData *auxArr)
-{
-    const InstructionDesc *instTable = (const InstructionDesc *)TclGetInstructionTable();
-    unsigned char *boundary = NULL;
-
-    /* Empty blocks are trivially valid. */
-    if (codeLen == 0) {
-        return TCL_OK;
-    }
+ * Tcl's evaluator does not re-check bytecode operands (the compiler is
+ * trusted), so a crafted block with e.g. INST_PUSH <huge> would read past
+ * the literal array at run time.  ValidateBlockOperands rejects such blocks
+ * as they are decoded.  It walks the code once, driven by tbcxOpShapes: per
+ * opcode, its length and the kind and width of each operand, folded from
+ * the core's instruction table at init.  Index operands are checked on the
+ * spot; jump targets, which may lie ahead, are collected in a bitmap and
+ * compared with the bitmap of instruction starts at the end.
+ * ========================================================================== */
 
-    boundary = (unsigned char *)Tcl_AttemptAlloc((size_t)codeLen);
-    if (!boundary) {
-        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (boundary map)", -1));
-        return TCL_ERROR;
-    }
-    memset(boundary, 0, (size_t)codeLen);
-
-    /* Pass 1: walk instruction stream, validate opcode and length,
-     * populate boundary map. */
-    uint32_t pc = 0;
-    while (pc < codeLen) {
-        unsigned int op = code[pc];
-        if (op > LAST_INST_OPCODE) {
-            Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                "tbcx: invalid opcode 0x%02x at pc %u", op, pc));
-            Tcl_Free(boundary);
-            return TCL_ERROR;
-        }
-        const InstructionDesc *desc = &instTable[op];
-        if (desc->numBytes <= 0 ||
-            (uint32_t)desc->numBytes > codeLen ||
-            pc + (uint32_t)desc->numBytes > codeLen) {
-            Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                "tbcx: truncated instruction %s (opcode 0x%02x) at pc %u",
-                desc->name ? desc->name : "?", op, pc));
-            Tcl_Free(boundary);
-            return TCL_ERROR;
-        }
-        boundary[pc] = 1;
-        pc += (uint32_t)desc->numBytes;
-    }
-    if (pc != codeLen) {
-        /* Final instruction ran past end; already reported above, but
-         * guard defensively. */
-        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: code stream does not end on instruction boundary", -1));
-        Tcl_Free(boundary);
-        return TCL_ERROR;
-    }
+/* Operand kinds the validator distinguishes. */
+enum {
+    TBCX_OPND_SKIP,      /* immediate: any bit pattern is valid */
+    TBCX_OPND_LIT,       /* literal index */
+    TBCX_OPND_LVT,       /* local variable index */
+    TBCX_OPND_AUX,       /* AuxData index */
+    TBCX_OPND_JUMPTABLE, /* AuxData index of a jump table */
+    TBCX_OPND_OFFSET,    /* relative jump */
+    TBCX_OPND_UNKNOWN    /* an operand type this build does not know */
+};
 
-    /* Pass 2: walk operands per instruction and validate each by
-     * InstOperandType.  Use the core's InstructionDesc.opTypes array
-     * rather than opcode-name matching so new opcodes are handled
-     * automatically. */
-    pc = 0;
-    while (pc < codeLen) {
-        unsigned int op = code[pc];
-        const InstructionDesc *desc = &instTable[op];
-        uint32_t off = 1; /* skip the opcode byte */
+typedef struct {
+    uint8_t     len;     /* instruction bytes; 0 for no such opcode */
+    uint8_t     numOps;
+    uint8_t     kind[MAX_INSTRUCTION_OPERANDS];
+    uint8_t     width[MAX_INSTRUCTION_OPERANDS];
+    const char *name;
+} TbcxOpShape;
+
+/* Built once during TbcxInitTypes() under the tbcxTypeMutex, before
+ * tbcxTypesLoaded is published; immutable afterwards. */
+static TbcxOpShape tbcxOpShapes[256];
+static int         tbcxOpShapesReady = 0;
+
+/* TbcxLoadInitOpsLocked — one-time tbcxOpShapes initialization.  Called
+ * from TbcxInitTypes() inside the type-init mutex.  Not declared in tbcx.h
+ * — only accessible via file-local extern in tbcx.c. */
+void               TbcxLoadInitOpsLocked(void) {
+    if (tbcxOpShapesReady)
+        return;
+    const InstructionDesc *instTable = (const InstructionDesc *)TclGetInstructionTable();
+    memset(tbcxOpShapes, 0, sizeof(tbcxOpShapes));
+    for (unsigned i = 0; i <= LAST_INST_OPCODE && i < 256u; i++) {
+        const InstructionDesc *desc = &instTable[i];
+        TbcxOpShape           *s    = &tbcxOpShapes[i];
+        if (desc->numBytes <= 0 || desc->numBytes > 255 || desc->numOperands > MAX_INSTRUCTION_OPERANDS)
+            continue;
+        int jumpTable = desc->name && (strcmp(desc->name, "jumpTable") == 0 || strcmp(desc->name, "jumpTableNum") == 0);
+        s->len        = (uint8_t)desc->numBytes;
+        s->numOps     = (uint8_t)desc->numOperands;
+        s->name       = desc->name ? desc->name : "?";
         for (int oi = 0; oi < desc->numOperands; oi++) {
-            InstOperandType ot = desc->opTypes[oi];
-            switch (ot) {
+            switch (desc->opTypes[oi]) {
             case OPERAND_NONE:
+                s->kind[oi] = TBCX_OPND_SKIP;
                 break;
             case OPERAND_INT1:
             case OPERAND_UINT1:
@@ -3941,480 +4376,1669 @@ static int TBCX_MAYBE_UNUSED ValidateBlockOperands(
             case OPERAND_UNSF1:
             case OPERAND_CLK1:
             case OPERAND_LRPL1:
-                /* 1-byte immediate / flag / small-table-index operands.
-                 * No range check needed — the payload is just a bit
-                 * pattern interpreted by the opcode itself. */
-                off += 1;
+                /* 1-byte immediate / flag / small-table-index operands,
+                 * interpreted by the opcode itself. */
+                s->kind[oi]  = TBCX_OPND_SKIP;
+                s->width[oi] = 1;
                 break;
-            case OPERAND_LVT1: {
-                unsigned int idx = TclGetUInt1AtPtr(code + pc + off);
-                if (idx >= numLocals) {
-                    Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                        "tbcx: %s: local index %u >= %u at pc %u",
-                        desc->name, idx, numLocals, pc));
-                    Tcl_Free(boundary);
-                    return TCL_ERROR;
-                }
-                off += 1;
+            case OPERAND_INT4:
+            case OPERAND_UINT4:
+            case OPERAND_IDX4:
+                s->kind[oi]  = TBCX_OPND_SKIP;
+                s->width[oi] = 4;
                 break;
-            }
-            case OPERAND_LIT1: {
-                unsigned int idx = TclGetUInt1AtPtr(code + pc + off);
-                if (idx >= numLits) {
-                    Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                        "tbcx: %s: literal index %u >= %u at pc %u",
-                        desc->name, idx, numLits, pc));
-                    Tcl_Free(boundary);
-                    return TCL_ERROR;
-                }
-                off += 1;
+            case OPERAND_LIT1:
+            case OPERAND_LIT4:
+                s->kind[oi]  = TBCX_OPND_LIT;
+                s->width[oi] = desc->opTypes[oi] == OPERAND_LIT1 ? 1 : 4;
                 break;
-            }
-            case OPERAND_OFFSET1: {
-                int rel = TclGetInt1AtPtr(code + pc + off);
-                int64_t tgt = (int64_t)pc + rel;
-                if (tgt < 0 || tgt >= (int64_t)codeLen || !boundary[tgt]) {
-                    Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                        "tbcx: %s: jump offset %d from pc %u lands off-boundary (target %" PRId64 ")",
-                        desc->name, rel, pc, tgt));
-                    Tcl_Free(boundary);
-                    return TCL_ERROR;
-                }
-                off += 1;
+            case OPERAND_LVT1:
+            case OPERAND_LVT4:
+                s->kind[oi]  = TBCX_OPND_LVT;
+                s->width[oi] = desc->opTypes[oi] == OPERAND_LVT1 ? 1 : 4;
+                break;
+            case OPERAND_AUX4:
+                s->kind[oi]  = jumpTable ? TBCX_OPND_JUMPTABLE : TBCX_OPND_AUX;
+                s->width[oi] = 4;
+                break;
+            case OPERAND_OFFSET1:
+            case OPERAND_OFFSET4:
+                s->kind[oi]  = TBCX_OPND_OFFSET;
+                s->width[oi] = desc->opTypes[oi] == OPERAND_OFFSET1 ? 1 : 4;
+                break;
+            default:
+                /* Tcl may add operand kinds; an opcode using one is
+                 * refused until the validator learns it. */
+                s->kind[oi] = TBCX_OPND_UNKNOWN;
                 break;
             }
-            case OPERAND_INT4:
-            case OPERAND_UINT4:
-            case OPERAND_IDX4:
-                off += 4;
+        }
+    }
+    tbcxOpShapesReady = 1;
+}
+
+#define TBCX_BIT_SET(m, i) ((m)[(i) >> 6] |= (uint64_t)1 << ((i) & 63u))
+
+/* ValidateBlockOperands — check the decoded block d before it can reach
+ * Tcl's evaluator:
+ *   1) every opcode exists and its instruction lies within the code;
+ *   2) literal, local and AuxData operands index into their tables, and a
+ *      jumpTable / jumpTableNum operand names a jump-table AuxData;
+ *   3) every jump, jump-table entry and exception handler targets the
+ *      start of an instruction.
+ * Skipped for blocks of an artifact registered with tbcx::trust or already
+ * validated in this process (r->trusted, r->checked).  Interp-free; on
+ * failure the error is recorded on r and 0 returned. */
+static int ValidateBlockOperands(TbcxIn *r, TbcxArena *a, const unsigned char *code, uint32_t codeLen, uint32_t numLits, uint32_t numAux, uint32_t numLocals, const AuxData *aux,
+                                 const ExceptionRange *ex, uint32_t numEx) {
+    if (r->trusted || r->checked || codeLen == 0)
+        return 1;
+
+    /* starts: instruction starts; targets: jump destinations. */
+    size_t        words = ((size_t)codeLen + 63u) / 64u;
+    TbcxArenaMark mark  = ArenaMark(a);
+    uint64_t     *starts = (uint64_t *)ArenaAlloc(a, sizeof(uint64_t) * 2u * words);
+    if (!starts) {
+        R_Error(r, "tbcx: allocation failed (operand check)");
+        return 0;
+    }
+    uint64_t *targets = starts + words;
+    memset(starts, 0, sizeof(uint64_t) * 2u * words);
+
+    int ok = 0;
+    for (uint32_t pc = 0; pc < codeLen;) {
+        const TbcxOpShape *s = &tbcxOpShapes[code[pc]];
+        if (s->len == 0) {
+            snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: invalid opcode 0x%02x at pc %u", code[pc], pc);
+            goto done;
+        }
+        if (s->len > codeLen - pc) {
+            snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: truncated instruction %s at pc %u", s->name, pc);
+            goto done;
+        }
+        TBCX_BIT_SET(starts, pc);
+        const unsigned char *o = code + pc + 1;
+        for (unsigned oi = 0; oi < s->numOps; o += s->width[oi], oi++) {
+            uint32_t v = s->width[oi] == 1 ? (uint32_t)o[0] : (uint32_t)TclGetUInt4AtPtr(o);
+            switch (s->kind[oi]) {
+            case TBCX_OPND_SKIP:
                 break;
-            case OPERAND_LVT4: {
-                unsigned int idx = TclGetUInt4AtPtr(code + pc + off);
-                if (idx >= numLocals) {
-                    Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                        "tbcx: %s: local index %u >= %u at pc %u",
-                        desc->name, idx, numLocals, pc));
-                    Tcl_Free(boundary);
-                    return TCL_ERROR;
+            case TBCX_OPND_LIT:
+                if (v >= numLits) {
+                    snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: %s: literal index %u >= %u at pc %u", s->name, v, numLits, pc);
+                    goto done;
                 }
-                off += 4;
                 break;
-            }
-            case OPERAND_LIT4: {
-                unsigned int idx = TclGetUInt4AtPtr(code + pc + off);
-                if (idx >= numLits) {
-                    Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                        "tbcx: %s: literal index %u >= %u at pc %u",
-                        desc->name, idx, numLits, pc));
-                    Tcl_Free(boundary);
-                    return TCL_ERROR;
+            case TBCX_OPND_LVT:
+                if (v >= numLocals) {
+                    snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: %s: local index %u >= %u at pc %u", s->name, v, numLocals, pc);
+                    goto done;
                 }
-                off += 4;
                 break;
-            }
-            case OPERAND_AUX4: {
-                unsigned int idx = TclGetUInt4AtPtr(code + pc + off);
-                if (idx >= numAux) {
-                    Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                        "tbcx: %s: aux index %u >= %u at pc %u",
-                        desc->name, idx, numAux, pc));
-                    Tcl_Free(boundary);
-                    return TCL_ERROR;
+            case TBCX_OPND_AUX:
+                if (v >= numAux) {
+                    snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: %s: aux index %u >= %u at pc %u", s->name, v, numAux, pc);
+                    goto done;
+                }
+                break;
+            case TBCX_OPND_JUMPTABLE: {
+                if (v >= numAux || (aux[v].type != tbcxAuxJTStr && aux[v].type != tbcxAuxJTNum)) {
+                    snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: %s: aux %u is not a jump table at pc %u", s->name, v, pc);
+                    goto done;
+                }
+                /* Stored targets are relative to the jumpTable opcode
+                 * (tclExecute.c: "new pc = PC_REL + jumpOffset"). */
+                Tcl_HashSearch hs;
+                for (Tcl_HashEntry *he = Tcl_FirstHashEntry((Tcl_HashTable *)aux[v].clientData, &hs); he; he = Tcl_NextHashEntry(&hs)) {
+                    int64_t tgt = (int64_t)pc + (intptr_t)PTR2INT(Tcl_GetHashValue(he));
+                    if (tgt < 0 || tgt >= (int64_t)codeLen) {
+                        snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: %s: target %" PRId64 " out of range at pc %u", s->name, tgt, pc);
+                        goto done;
+                    }
+                    TBCX_BIT_SET(targets, (uint32_t)tgt);
                 }
-                off += 4;
                 break;
             }
-            case OPERAND_OFFSET4: {
-                int rel = TclGetInt4AtPtr(code + pc + off);
-                int64_t tgt = (int64_t)pc + rel;
-                if (tgt < 0 || tgt >= (int64_t)codeLen || !boundary[tgt]) {
-                    Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                        "tbcx: %s: jump offset %d from pc %u lands off-boundary (target %" PRId64 ")",
-                        desc->name, rel, pc, tgt));
-                    Tcl_Free(boundary);
-                    return TCL_ERROR;
+            case TBCX_OPND_OFFSET: {
+                int64_t tgt = (int64_t)pc + (s->width[oi] == 1 ? (int64_t)TclGetInt1AtPtr(o) : (int64_t)TclGetInt4AtPtr(o));
+                if (tgt < 0 || tgt >= (int64_t)codeLen) {
+                    snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: %s: jump target %" PRId64 " out of range at pc %u", s->name, tgt, pc);
+                    goto done;
                 }
-                off += 4;
+                TBCX_BIT_SET(targets, (uint32_t)tgt);
                 break;
             }
             default:
-                /* Unknown operand type — bail out safely rather than
-                 * silently accept.  Tcl may add new operand kinds in
-                 * future; this coerces us to revisit the validator. */
-                Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                    "tbcx: %s: unknown operand type %d at pc %u (update validator)",
-                    desc->name, (int)ot, pc));
-                Tcl_Free(boundary);
-                return TCL_ERROR;
+                snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: %s: unknown operand type at pc %u", s->name, pc);
+                goto done;
+            }
+        }
+        pc += s->len;
+    }
+
+    /* Exception handlers are jump targets too; their ranges' bounds are
+     * checked against the code size by TbcxCheckExceptRanges. */
+    for (uint32_t i = 0; i < numEx; i++) {
+        const Tcl_Size h[3] = {ex[i].continueOffset, ex[i].breakOffset, ex[i].catchOffset};
+        for (int k = 0; k < 3; k++) {
+            if (h[k] < 0)
+                continue;
+            if (h[k] >= (Tcl_Size)codeLen) {
+                snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: exception range %u: handler %" TCL_SIZE_MODIFIER "d out of range", i, h[k]);
+                goto done;
+            }
+            TBCX_BIT_SET(targets, (uint32_t)h[k]);
+        }
+    }
+    for (size_t w = 0; w < words; w++) {
+        uint64_t stray = targets[w] & ~starts[w];
+        if (stray) {
+            uint32_t at = (uint32_t)(w * 64u);
+            for (; !(stray & 1u); stray >>= 1)
+                at++;
+            snprintf(r->errBuf, sizeof(r->errBuf), "tbcx: jump target %u is not an instruction boundary", at);
+            goto done;
+        }
+    }
+    ok = 1;
+
+done:
+    ArenaRelease(a, mark);
+    if (!ok)
+        R_Error(r, r->errBuf);
+    return ok;
+}
+
+#undef TBCX_BIT_SET
+
+/* ==========================================================================
+ * Block decoding: decode, then materialize
+ *
+ * A block is read in two phases.  DecodeBlock parses it into plain C
+ * descriptors in a scratch arena: the code bytes, a descriptor per
+ * literal, the AuxData payloads, the exception ranges and the local names
+ * as string-table indices.  It creates no Tcl_Obj and never touches an
+ * interp, so any thread that owns its reader may run it (with a NULL
+ * interp the error lands in r->errMsg).  MaterializeBlock then builds the
+ * literals and the ByteCode on the interp thread.  Memory readers keep
+ * code and string payloads as views of the image; channel readers copy
+ * them into the arena.
+ * ========================================================================== */
+
+typedef struct TbcxBlockDesc TbcxBlockDesc;
+typedef struct TbcxLitDesc   TbcxLitDesc;
+
+/* One lambda argument. */
+typedef struct {
+    uint32_t     nameIdx; /* string-table index */
+    TbcxLitDesc *def;     /* default value, NULL when there is none */
+} TbcxArgDesc;
+
+/* One decoded literal.  The fields in use depend on tag:
+ *   BOOLEAN, WIDEINT, WIDEUINT, DOUBLE  u (DOUBLE as its bit pattern)
+ *   BIGNUM                              u = sign, p/len = LE magnitude
+ *   STRING, BYTEARR                     p/len
+ *   LIST, DICT                          n elems (DICT: keys and values alternate)
+ *   STRREF                              idx
+ *   LAMBDA_BC                           idx = namespace, n args, block, p/len = body text
+ *   BYTESRC                             idx = namespace, block, p/len = source text */
+struct TbcxLitDesc {
+    uint32_t             tag;
+    uint32_t             tags; /* TBCX_LIT_BIT of this literal and all it nests */
+    uint32_t             n;
+    uint32_t             idx;
+    uint32_t             len;
+    const unsigned char *p;
+    uint64_t             u;
+    TbcxLitDesc         *elems;
+    TbcxArgDesc         *args;
+    TbcxBlockDesc       *block;
+};
+
+struct TbcxBlockDesc {
+    const unsigned char *code;
+    uint32_t             codeLen;
+    uint32_t             numLits;
+    TbcxLitDesc         *lits;
+    uint32_t             numAux;
+    AuxData             *aux; /* payloads owned here until materialized */
+    uint32_t             numEx;
+    ExceptionRange      *ex;
+    uint32_t             maxStack;
+    uint32_t             numLocals;
+    uint32_t            *locals; /* string-table indices */
+};
+
+static void     LitDescFree(TbcxLitDesc *d);
+static int      DecodeBlock(TbcxIn *r, TbcxArena *a, TbcxBlockDesc *d);
+static int      DecodeLiteral(TbcxIn *r, TbcxArena *a, int depth, TbcxLitDesc *d);
+static Tcl_Obj *MaterializeBlock(TbcxIn *r, Tcl_Interp *ip, TbcxBlockDesc *d, Namespace *nsForDefault, uint32_t *numLocalsOut, int setPrecompiled, int dumpOnly);
+static Tcl_Obj *MaterializeLiteral(TbcxIn *r, Tcl_Interp *ip, TbcxLitDesc *d, int dumpOnly);
+
+/* DescAlloc — n zeroed elements of sz bytes from a.  Zeroed so that a
+ * tree abandoned halfway through decoding can still be walked by
+ * BlockDescFree. */
+static void *DescAlloc(TbcxIn *r, TbcxArena *a, uint32_t n, size_t sz) {
+    size_t bytes = 0;
+    if (!tbcx_checked_mul(sz, n ? n : 1u, &bytes)) {
+        R_Error(r, "tbcx: descriptor size overflow");
+        return NULL;
+    }
+    void *p = ArenaAlloc(a, bytes);
+    if (!p) {
+        R_Error(r, "tbcx: allocation failed (block descriptor)");
+        return NULL;
+    }
+    memset(p, 0, bytes);
+    return p;
+}
+
+/* R_Payload — n bytes at the cursor: a view of the span for memory
+ * readers, an arena copy for channel readers. */
+static int R_Payload(TbcxIn *r, TbcxArena *a, uint32_t n, const unsigned char **pp) {
+    if (r->mem)
+        return Tbcx_R_View(r, n, pp);
+    unsigned char *dst = (unsigned char *)ArenaAlloc(a, n ? n : 1u);
+    if (!dst) {
+        R_Error(r, "tbcx: allocation failed (block payload)");
+        return 0;
+    }
+    if (n && !Tbcx_R_Bytes(r, dst, n))
+        return 0;
+    *pp = dst;
+    return 1;
+}
+
+/* R_TextPayload — an LPString as a payload. */
+static int R_TextPayload(TbcxIn *r, TbcxArena *a, const unsigned char **pp, uint32_t *lenOut) {
+    if (!Tbcx_R_Var(r, lenOut))
+        return 0;
+    if (*lenOut > TBCX_MAX_STR) {
+        R_Error(r, "tbcx: LPString too large");
+        return 0;
+    }
+    return R_Payload(r, a, *lenOut, pp);
+}
+
+/* R_StrIdx — a string ref, checked against r->strs but not resolved. */
+static int R_StrIdx(TbcxIn *r, uint32_t *idxOut) {
+    if (!Tbcx_R_Var(r, idxOut))
+        return 0;
+    if (!r->strs || *idxOut >= r->strs->count) {
+        R_Error(r, "tbcx: string ref out of range");
+        return 0;
+    }
+    return 1;
+}
+
+/* BlockDescFree — free the AuxData payloads d and its nested blocks still
+ * own.  Materializing a block moves them into its ByteCode, so this only
+ * has work to do on failure paths. */
+static void BlockDescFree(TbcxBlockDesc *d) {
+    if (!d)
+        return;
+    for (uint32_t i = 0; i < d->numLits; i++)
+        LitDescFree(&d->lits[i]);
+    FreeAuxPayloads(d->aux, d->numAux);
+    d->aux    = NULL;
+    d->numAux = 0;
+}
+
+static void LitDescFree(TbcxLitDesc *d) {
+    switch (d->tag) {
+    case TBCX_LIT_DICT:
+    case TBCX_LIT_LIST:
+        for (uint32_t i = 0; i < d->n; i++)
+            LitDescFree(&d->elems[i]);
+        break;
+    case TBCX_LIT_LAMBDA_BC:
+        for (uint32_t i = 0; i < d->n; i++)
+            if (d->args[i].def)
+                LitDescFree(d->args[i].def);
+        BlockDescFree(d->block);
+        break;
+    case TBCX_LIT_BYTESRC:
+        BlockDescFree(d->block);
+        break;
+    default:
+        break;
+    }
+}
+
+/* DecodeElems — n nested literals into d->elems.  d->n counts the ones
+ * started, so a failure leaves them all reachable for LitDescFree. */
+static int DecodeElems(TbcxIn *r, TbcxArena *a, int depth, TbcxLitDesc *d, uint32_t n) {
+    d->elems = (TbcxLitDesc *)DescAlloc(r, a, n, sizeof(TbcxLitDesc));
+    if (!d->elems)
+        return 0;
+    for (uint32_t i = 0; i < n; i++) {
+        d->n = i + 1;
+        if (!DecodeLiteral(r, a, depth + 1, &d->elems[i]))
+            return 0;
+        d->tags |= d->elems[i].tags;
+    }
+    return 1;
+}
+
+/* DecodeNestedBlock — the compiled block of a LAMBDA_BC or BYTESRC
+ * literal.  Blocks below the top level are never back-references. */
+static int DecodeNestedBlock(TbcxIn *r, TbcxArena *a, TbcxLitDesc *d) {
+    d->block = (TbcxBlockDesc *)DescAlloc(r, a, 1, sizeof(TbcxBlockDesc));
+    return d->block && DecodeBlock(r, a, d->block);
+}
+
+static int DecodeLiteral(TbcxIn *r, TbcxArena *a, int depth, TbcxLitDesc *d) {
+    if (depth > TBCX_MAX_LITERAL_DEPTH) {
+        R_Error(r, "tbcx: literal nesting too deep");
+        return 0;
+    }
+    if (!Tbcx_R_Var(r, &d->tag))
+        return 0;
+    d->tags = TBCX_LIT_BIT(d->tag & 31u);
+
+    switch (d->tag) {
+    case TBCX_LIT_BIGNUM: {
+        uint8_t sign = 0;
+        if (!Tbcx_R_U8(r, &sign) || !Tbcx_R_Var(r, &d->len))
+            return 0;
+        if (d->len > (64u * 1024u * 1024u)) {
+            R_Error(r, "tbcx: bignum too large");
+            return 0;
+        }
+        d->u = sign;
+        /* A zero value carries no magnitude bytes. */
+        if (sign == 0 || d->len == 0) {
+            d->len = 0;
+            return 1;
+        }
+        return R_Payload(r, a, d->len, &d->p);
+    }
+    case TBCX_LIT_BOOLEAN: {
+        uint8_t b = 0;
+        if (!Tbcx_R_U8(r, &b))
+            return 0;
+        d->u = b;
+        return 1;
+    }
+    case TBCX_LIT_BYTEARR:
+        if (!Tbcx_R_Var(r, &d->len))
+            return 0;
+        if (d->len > TBCX_MAX_STR) {
+            R_Error(r, "tbcx: bytearray too large");
+            return 0;
+        }
+        return R_Payload(r, a, d->len, &d->p);
+    case TBCX_LIT_DICT: {
+        uint32_t cnt = 0;
+        if (!Tbcx_R_Var(r, &cnt))
+            return 0;
+        if (cnt > TBCX_MAX_CONTAINER_ELEMS) {
+            R_Error(r, "tbcx: dict too many pairs");
+            return 0;
+        }
+        return DecodeElems(r, a, depth, d, 2u * cnt);
+    }
+    case TBCX_LIT_DOUBLE:
+    case TBCX_LIT_WIDEINT:
+    case TBCX_LIT_WIDEUINT:
+        return Tbcx_R_U64(r, &d->u);
+    case TBCX_LIT_LIST: {
+        uint32_t cnt = 0;
+        if (!Tbcx_R_Var(r, &cnt))
+            return 0;
+        if (cnt > TBCX_MAX_CONTAINER_ELEMS) {
+            R_Error(r, "tbcx: list too many elements");
+            return 0;
+        }
+        return DecodeElems(r, a, depth, d, cnt);
+    }
+    case TBCX_LIT_BYTESRC:
+        /* source text + namespace + compiled block */
+        return R_TextPayload(r, a, &d->p, &d->len) && R_StrIdx(r, &d->idx) && DecodeNestedBlock(r, a, d);
+    case TBCX_LIT_LAMBDA_BC: {
+        /* namespace, args (name, hasDef, [default]), compiled body, body text */
+        uint32_t numArgs = 0;
+        if (!R_StrIdx(r, &d->idx) || !Tbcx_R_Var(r, &numArgs))
+            return 0;
+        if (numArgs > TBCX_MAX_LOCALS) {
+            R_Error(r, "tbcx: too many lambda arguments");
+            return 0;
+        }
+        d->args = (TbcxArgDesc *)DescAlloc(r, a, numArgs, sizeof(TbcxArgDesc));
+        if (!d->args)
+            return 0;
+        for (uint32_t i = 0; i < numArgs; i++) {
+            uint8_t hasDef = 0;
+            if (!R_StrIdx(r, &d->args[i].nameIdx) || !Tbcx_R_U8(r, &hasDef))
+                return 0;
+            d->n = i + 1;
+            if (hasDef) {
+                TbcxLitDesc *def = (TbcxLitDesc *)DescAlloc(r, a, 1, sizeof(TbcxLitDesc));
+                if (!def)
+                    return 0;
+                d->args[i].def = def;
+                if (!DecodeLiteral(r, a, depth + 1, def))
+                    return 0;
+            }
+        }
+        return DecodeNestedBlock(r, a, d) && R_TextPayload(r, a, &d->p, &d->len);
+    }
+    case TBCX_LIT_STRING:
+        return R_TextPayload(r, a, &d->p, &d->len);
+    case TBCX_LIT_STRREF:
+        return R_StrIdx(r, &d->idx);
+    default:
+        R_Error(r, "tbcx: unknown literal tag");
+        return 0;
+    }
+}
+
+/* DecodeLits — the literal pool, counted in d->numLits as it goes. */
+static int DecodeLits(TbcxIn *r, TbcxArena *a, TbcxBlockDesc *d, uint32_t numLits) {
+    if (numLits > TBCX_MAX_LITERALS) {
+        R_Error(r, "tbcx: too many literals");
+        return 0;
+    }
+    if (!numLits)
+        return 1;
+    d->lits = (TbcxLitDesc *)DescAlloc(r, a, numLits, sizeof(TbcxLitDesc));
+    if (!d->lits)
+        return 0;
+    for (uint32_t i = 0; i < numLits; i++) {
+        d->numLits = i + 1;
+        if (!DecodeLiteral(r, a, 0, &d->lits[i]))
+            return 0;
+    }
+    return 1;
+}
+
+/* DecodeLocals — numLocals string refs naming the compiled locals. */
+static int DecodeLocals(TbcxIn *r, TbcxArena *a, TbcxBlockDesc *d, uint32_t numLocals) {
+    if (!numLocals)
+        return 1;
+    d->locals = (uint32_t *)DescAlloc(r, a, numLocals, sizeof(uint32_t));
+    if (!d->locals || !Tbcx_R_VarArray(r, d->locals, numLocals))
+        return 0;
+    for (uint32_t i = 0; i < numLocals; i++) {
+        if (!r->strs || d->locals[i] >= r->strs->count) {
+            R_Error(r, "tbcx: string ref out of range");
+            return 0;
+        }
+    }
+    d->numLocals = numLocals;
+    return 1;
+}
+
+/* DecodeBlockNative — DecodeBlock for a TBCX_HDR_FL_NATIVE artifact: the
+ * block leads with its shape and stores its exception ranges in the host
+ * layout. */
+static int DecodeBlockNative(TbcxIn *r, TbcxArena *a, TbcxBlockDesc *d) {
+    if (r->nativeAbi != Tbcx_NativeAbi()) {
+        R_Error(r, "tbcx: -native artifact was saved on an incompatible platform");
+        return 0;
+    }
+
+    /* Shape: codeLen, numLits, numAux, numEx, maxStack, numLocals */
+    uint32_t shape[6];
+    if (!Tbcx_R_VarArray(r, shape, 6))
+        return 0;
+    uint32_t codeLen = shape[0], numLits = shape[1], numAux = shape[2], numEx = shape[3], maxStack = shape[4], numLocals = shape[5];
+    if (codeLen > TBCX_MAX_CODE) {
+        R_Error(r, "tbcx: code too large");
+        return 0;
+    }
+    if (numLits > TBCX_MAX_LITERALS) {
+        R_Error(r, "tbcx: too many literals");
+        return 0;
+    }
+    if (numAux > TBCX_MAX_AUX) {
+        R_Error(r, "tbcx: aux too many");
+        return 0;
+    }
+    if (numEx > TBCX_MAX_EXCEPT) {
+        R_Error(r, "tbcx: too many exceptions");
+        return 0;
+    }
+    if (maxStack > TBCX_MAX_STACK) {
+        R_ErrorLimit(r, "maxStack", maxStack, TBCX_MAX_STACK);
+        return 0;
+    }
+    if (numLocals > TBCX_MAX_LOCALS) {
+        R_ErrorLimit(r, "numLocals", numLocals, TBCX_MAX_LOCALS);
+        return 0;
+    }
+    d->codeLen  = codeLen;
+    d->maxStack = maxStack;
+
+    if (!R_Payload(r, a, codeLen, &d->code))
+        return 0;
+    if (numEx) {
+        /* Copied even from a span: the image gives no alignment promise. */
+        d->ex = (ExceptionRange *)DescAlloc(r, a, numEx, sizeof(ExceptionRange));
+        if (!d->ex || !Tbcx_R_Bytes(r, d->ex, (Tcl_Size)(sizeof(ExceptionRange) * numEx)))
+            return 0;
+        for (uint32_t i = 0; i < numEx && !r->trusted; i++) {
+            const char *bad = ExceptRangeShapeError(&d->ex[i], (Tcl_Size)numEx);
+            if (bad) {
+                R_Error(r, bad);
+                return 0;
+            }
+        }
+        d->numEx = numEx;
+    }
+    if (!DecodeLits(r, a, d, numLits))
+        return 0;
+    if (numAux) {
+        AuxData *aux = (AuxData *)DescAlloc(r, a, numAux, sizeof(AuxData));
+        if (!aux || !ReadAuxEntries(r, a, aux, numAux))
+            return 0;
+        d->aux    = aux;
+        d->numAux = numAux;
+    }
+    return DecodeLocals(r, a, d, numLocals);
+}
+
+/* ValidateBlock — ValidateBlockOperands over a decoded block. */
+static inline int ValidateBlock(TbcxIn *r, TbcxArena *a, const TbcxBlockDesc *d) {
+    return ValidateBlockOperands(r, a, d->code, d->codeLen, d->numLits, d->numAux, d->numLocals, d->aux, d->ex, d->numEx);
+}
+
+/* DecodeBlock — the block stored at the cursor, into d (zeroed by the
+ * caller).  On failure d may be partly filled; BlockDescFree releases it. */
+static int DecodeBlock(TbcxIn *r, TbcxArena *a, TbcxBlockDesc *d) {
+    if (r->native)
+        return DecodeBlockNative(r, a, d) && ValidateBlock(r, a, d);
+
+    /* 1) code */
+    if (!Tbcx_R_Var(r, &d->codeLen))
+        return 0;
+    if (d->codeLen > TBCX_MAX_CODE) {
+        R_Error(r, "tbcx: code too large");
+        return 0;
+    }
+    if (!R_Payload(r, a, d->codeLen, &d->code))
+        return 0;
+
+    /* 2) literals */
+    uint32_t numLits = 0;
+    if (!Tbcx_R_Var(r, &numLits) || !DecodeLits(r, a, d, numLits))
+        return 0;
+
+    /* 3) AuxData, 4) exceptions */
+    if (!ReadAuxArray(r, a, &d->aux, &d->numAux) || !ReadExceptions(r, a, &d->ex, &d->numEx))
+        return 0;
+
+    /* 5) Epilogue: maxStack, reserved, numLocals */
+    uint32_t reserved = 0, numLocals = 0;
+    if (!Tbcx_R_Var(r, &d->maxStack) || !Tbcx_R_Var(r, &reserved) || !Tbcx_R_Var(r, &numLocals))
+        return 0;
+    (void)reserved; /* wire-format placeholder for future use */
+
+    /* Hard caps on untrusted values from the .tbcx stream to prevent
+     * huge allocations, integer wrap, or allocator panic.  These limits
+     * are generous for legitimate bytecode but reject pathological inputs. */
+    if (d->maxStack > TBCX_MAX_STACK) {
+        R_ErrorLimit(r, "maxStack", d->maxStack, TBCX_MAX_STACK);
+        return 0;
+    }
+    if (numLocals > TBCX_MAX_LOCALS) {
+        R_ErrorLimit(r, "numLocals", numLocals, TBCX_MAX_LOCALS);
+        return 0;
+    }
+    return DecodeLocals(r, a, d, numLocals) && ValidateBlock(r, a, d);
+}
+
+/* ---- Materialization ----
+ * Each returns a refcount-0 Tcl_Obj* built from a descriptor, or NULL with
+ * the error recorded on r. */
+
+static Tcl_Obj *MaterializeBignum(TbcxIn *r, const TbcxLitDesc *d) {
+    if (d->len == 0)
+        return Tcl_NewWideIntObj(0);
+    mp_int z;
+    mp_err mrc = TclBN_mp_init(&z);
+    if (mrc != MP_OKAY) {
+        R_Error(r, "tbcx: bignum init");
+        return NULL;
+    }
+    /* Import LE magnitude bytes into mp_int via repeated shift+add.
+     * Tcl 9.1's stubs table does not expose mp_from_ubin, so we use
+     * the portable TclBN_mp_mul_2d + TclBN_mp_add_d path. */
+    for (int i = (int)d->len - 1; i >= 0; i--) {
+        if ((mrc = TclBN_mp_mul_2d(&z, 8, &z)) != MP_OKAY)
+            break;
+        if ((mrc = TclBN_mp_add_d(&z, d->p[i], &z)) != MP_OKAY)
+            break;
+    }
+    if (mrc != MP_OKAY) {
+        TclBN_mp_clear(&z);
+        R_Error(r, "tbcx: bignum import");
+        return NULL;
+    }
+    if (d->u == 2 && TclBN_mp_neg(&z, &z) != MP_OKAY) {
+        TclBN_mp_clear(&z);
+        R_Error(r, "tbcx: bignum neg");
+        return NULL;
+    }
+    return Tcl_NewBignumObj(&z);
+}
+
+static Tcl_Obj *MaterializeWideUInt(TbcxIn *r, uint64_t u) {
+    if (u <= (uint64_t)TCL_INDEX_NONE)
+        return Tcl_NewWideIntObj((Tcl_WideInt)u);
+    /* promote to bignum */
+    mp_int z;
+    mp_err mrc = TclBN_mp_init(&z);
+    if (mrc != MP_OKAY) {
+        R_Error(r, "tbcx: wideuint init");
+        return NULL;
+    }
+    /* Portable path: build from 8 bytes with shift/add so we can
+       keep checking mp_err on each TomMath call. */
+    for (int i = 7; i >= 0; i--) {
+        mrc = TclBN_mp_mul_2d(&z, 8, &z);
+        if (mrc != MP_OKAY)
+            break;
+        mrc = TclBN_mp_add_d(&z, (unsigned int)((u >> (8 * i)) & 0xFFu), &z);
+        if (mrc != MP_OKAY)
+            break;
+    }
+    if (mrc != MP_OKAY) {
+        TclBN_mp_clear(&z);
+        R_Error(r, "tbcx: wideuint import");
+        return NULL;
+    }
+    return Tcl_NewBignumObj(&z);
+}
+
+/* LiteralNamespace — the namespace a LAMBDA_BC or BYTESRC literal compiles
+ * in: created when loading, looked up (else global) when dumping. */
+static Namespace *LiteralNamespace(TbcxIn *r, Tcl_Interp *ip, Tcl_Obj *nsObj, const char *what, int dumpOnly) {
+    Tcl_Size    nsObjLen = 0;
+    const char *nsObjStr = Tbcx_GetStringFromObjStrict(ip, nsObj, &nsObjLen);
+    /* reject embedded NUL and require absolute form */
+    if (!nsObjStr || (!r->trusted && Tbcx_ValidateKeyString(ip, nsObjStr, nsObjLen, what, 1) != TCL_OK)) {
+        r->err = TCL_ERROR;
+        return NULL;
+    }
+    if (dumpOnly) {
+        Namespace *nsPtr = (Namespace *)Tcl_FindNamespace(ip, nsObjStr, NULL, 0);
+        return nsPtr ? nsPtr : (Namespace *)Tcl_GetGlobalNamespace(ip);
+    }
+    Namespace *nsPtr = (Namespace *)Tbcx_EnsureNamespace(ip, nsObjStr);
+    if (!nsPtr)
+        r->err = TCL_ERROR;
+    return nsPtr;
+}
+
+static Tcl_Obj *MaterializeLambda(TbcxIn *r, Tcl_Interp *ip, TbcxLitDesc *d, int dumpOnly) {
+    Tcl_Obj   *nsObj = r->strs->objs[d->idx]; /* borrowed from the string table */
+    Namespace *nsPtr = LiteralNamespace(r, ip, nsObj, "lambda namespace", dumpOnly);
+    if (!nsPtr)
+        return NULL;
+
+    /* Argument specifications */
+    Tcl_Obj *argList = Tcl_NewListObj(0, NULL);
+    Tcl_IncrRefCount(argList);
+    for (uint32_t i = 0; i < d->n; i++) {
+        Tcl_Obj *argNameObj = r->strs->objs[d->args[i].nameIdx];
+        Tcl_Obj *argSpec    = argNameObj;
+        if (d->args[i].def) {
+            Tcl_Obj *defVal = MaterializeLiteral(r, ip, d->args[i].def, dumpOnly);
+            if (!defVal) {
+                Tcl_DecrRefCount(argList);
+                return NULL;
+            }
+            Tcl_Obj *pair[2] = {argNameObj, defVal};
+            argSpec          = Tcl_NewListObj(2, pair);
+        }
+        Tcl_IncrRefCount(argSpec);
+        int rc = Tcl_ListObjAppendElement(ip, argList, argSpec);
+        Tcl_DecrRefCount(argSpec);
+        if (rc != TCL_OK) {
+            r->err = TCL_ERROR;
+            Tcl_DecrRefCount(argList);
+            return NULL;
+        }
+    }
+
+    /* Build Proc with precompiled bytecode */
+    Proc *procPtr = (Proc *)Tcl_Alloc(sizeof(Proc));
+    memset(procPtr, 0, sizeof(Proc));
+    procPtr->iPtr     = (Interp *)ip;
+    procPtr->refCount = 1;
+    {
+        CompiledLocal *first = NULL, *last = NULL;
+        Tcl_Size       numA = 0;
+        if (Tbcx_BuildLocals(ip, argList, &first, &last, &numA) != TCL_OK) {
+            r->err = TCL_ERROR;
+            Tcl_DecrRefCount(argList);
+            Tcl_Free((char *)procPtr);
+            return NULL;
+        }
+        procPtr->numArgs           = numA;
+        procPtr->numCompiledLocals = numA;
+        procPtr->firstLocalPtr     = first;
+        procPtr->lastLocalPtr      = last;
+    }
+
+    uint32_t nLocalsBody = 0;
+    Tcl_Obj *bodyBC      = MaterializeBlock(r, ip, d->block, nsPtr, &nLocalsBody, 1, dumpOnly);
+    if (!bodyBC) {
+        Tcl_DecrRefCount(argList);
+        Tbcx_FreeLocals(procPtr->firstLocalPtr);
+        Tcl_Free((char *)procPtr);
+        return NULL;
+    }
+    Tcl_IncrRefCount(bodyBC); /* own immediately — don't leave at refcount 0 */
+    procPtr->bodyPtr = bodyBC;
+    Tcl_IncrRefCount(bodyBC); /* Proc's own reference */
+    {
+        ByteCode *bc = TbcxGetByteCode(bodyBC);
+        if (bc)
+            TbcxFixupByteCode(bc, procPtr, ip, nsPtr, TBCX_FIXUP_CACHE_KEEP);
+    }
+    CompiledLocals(procPtr, (Tcl_Size)nLocalsBody);
+
+    /* Build lambda Tcl_Obj with original body source in string rep */
+    Tcl_Obj *bodyText = Tcl_NewStringObj((const char *)d->p, (Tcl_Size)d->len);
+    Tcl_Obj *lambda;
+    {
+        const char *nsName   = Tbcx_GetStringSafe(nsObj);
+        int         isGlobal = (nsName[0] == ':' && nsName[1] == ':' && nsName[2] == '\0');
+        if (isGlobal) {
+            Tcl_Obj *elems[2] = {argList, bodyText};
+            lambda            = Tcl_NewListObj(2, elems);
+        } else {
+            Tcl_Obj *elems[3] = {argList, bodyText, nsObj};
+            lambda            = Tcl_NewListObj(3, elems);
+        }
+        (void)Tbcx_GetStringSafe(lambda);
+    }
+
+    /* Register in ApplyShim for shimmer recovery (skip in dump mode) */
+    if (!dumpOnly) {
+        RegisterPrecompiledLambda(ip, lambda, procPtr, nsObj);
+        Tcl_DecrRefCount(bodyBC); /* local reference */
+    } else {
+        ByteCode *bc2 = TbcxGetByteCode(bodyBC);
+        if (bc2)
+            bc2->procPtr = NULL;
+        Tcl_DecrRefCount(bodyBC); /* Proc's reference */
+        Tcl_DecrRefCount(bodyBC); /* local reference  */
+        Tbcx_FreeLocals(procPtr->firstLocalPtr);
+        Tcl_Free((char *)procPtr);
+    }
+
+    Tcl_DecrRefCount(argList);
+    return lambda;
+}
+
+static Tcl_Obj *MaterializeByteSrc(TbcxIn *r, Tcl_Interp *ip, TbcxLitDesc *d, int dumpOnly) {
+    Namespace *nsPtr = LiteralNamespace(r, ip, r->strs->objs[d->idx], "bytesrc literal namespace", dumpOnly);
+    if (!nsPtr)
+        return NULL;
+    /* setPrecompiled=0: BYTESRC literals have source text, so Tcl CAN
+       recompile from the string rep.  Without PRECOMPILED, Tcl will
+       recompile on compile-epoch mismatch (after ProcShim bumps the
+       epoch) or interpHandle mismatch (child interp / interp eval).
+       The bytecode is a cache, the source is the ground truth.  With
+       PRECOMPILED=1, Tcl would error with "compiled script jumped
+       interps" on interpHandle mismatch instead of recompiling. */
+    uint32_t dummyNL = 0;
+    Tcl_Obj *bc      = MaterializeBlock(r, ip, d->block, nsPtr, &dummyNL, 0, dumpOnly);
+    if (bc && d->len > 0) {
+        /* The preserved source text becomes the string rep; the bytecode
+           internal rep is untouched. */
+        Tcl_InvalidateStringRep(bc);
+        Tcl_InitStringRep(bc, (const char *)d->p, d->len);
+    }
+    return bc;
+}
+
+static Tcl_Obj *MaterializeLiteral(TbcxIn *r, Tcl_Interp *ip, TbcxLitDesc *d, int dumpOnly) {
+    switch (d->tag) {
+    case TBCX_LIT_BIGNUM:
+        return MaterializeBignum(r, d);
+    case TBCX_LIT_BOOLEAN:
+        return Tcl_NewBooleanObj(d->u ? 1 : 0);
+    case TBCX_LIT_BYTEARR:
+        return Tcl_NewByteArrayObj(d->p, (Tcl_Size)d->len);
+    case TBCX_LIT_DICT: {
+        Tcl_Obj *dict = Tcl_NewDictObj();
+        for (uint32_t i = 0; i + 1 < d->n; i += 2) {
+            Tcl_Obj *k = MaterializeLiteral(r, ip, &d->elems[i], dumpOnly);
+            Tcl_Obj *v = k ? MaterializeLiteral(r, ip, &d->elems[i + 1], dumpOnly) : NULL;
+            if (k)
+                Tcl_IncrRefCount(k);
+            if (v)
+                Tcl_IncrRefCount(v);
+            int rc = (k && v) ? Tcl_DictObjPut(ip, dict, k, v) : TCL_ERROR;
+            if (k)
+                Tcl_DecrRefCount(k);
+            if (v)
+                Tcl_DecrRefCount(v);
+            if (rc != TCL_OK) {
+                r->err = TCL_ERROR;
+                Tcl_IncrRefCount(dict);
+                Tcl_DecrRefCount(dict);
+                return NULL;
+            }
+        }
+        return dict;
+    }
+    case TBCX_LIT_DOUBLE: {
+        union {
+            uint64_t u;
+            double   d;
+        } u;
+        u.u = d->u;
+        return Tcl_NewDoubleObj(u.d);
+    }
+    case TBCX_LIT_LIST: {
+        Tcl_Obj *lst = Tcl_NewListObj(0, NULL);
+        for (uint32_t i = 0; i < d->n; i++) {
+            Tcl_Obj *e = MaterializeLiteral(r, ip, &d->elems[i], dumpOnly);
+            if (e)
+                Tcl_IncrRefCount(e);
+            int rc = e ? Tcl_ListObjAppendElement(ip, lst, e) : TCL_ERROR;
+            if (e)
+                Tcl_DecrRefCount(e);
+            if (rc != TCL_OK) {
+                r->err = TCL_ERROR;
+                Tcl_IncrRefCount(lst);
+                Tcl_DecrRefCount(lst);
+                return NULL;
             }
         }
-        pc += (uint32_t)desc->numBytes;
+        return lst;
+    }
+    case TBCX_LIT_WIDEINT:
+        /* stored as 2's complement */
+        return Tcl_NewWideIntObj((Tcl_WideInt)d->u);
+    case TBCX_LIT_WIDEUINT:
+        return MaterializeWideUInt(r, d->u);
+    case TBCX_LIT_BYTESRC:
+        return MaterializeByteSrc(r, ip, d, dumpOnly);
+    case TBCX_LIT_LAMBDA_BC:
+        return MaterializeLambda(r, ip, d, dumpOnly);
+    case TBCX_LIT_STRING:
+        return Tcl_NewStringObj((const char *)d->p, (Tcl_Size)d->len);
+    case TBCX_LIT_STRREF:
+        /* Shared with every other ref to the same table entry; the table
+         * holds its own reference, so callers' incr/decr pairs are safe. */
+        return r->strs->objs[d->idx];
+    default:
+        R_Error(r, "tbcx: unknown literal tag");
+        return NULL;
     }
+}
 
-    /* Pass 3: walk jump-table aux payloads and validate stored targets.
-     * The stored value is the relative offset added to the jumpTable
-     * opcode's PC (see tclExecute.c processJumpTableEntry: "new pc =
-     * PC_REL + jumpOffset").  We need to locate each jumpTable /
-     * jumpTableNum opcode in the code stream and validate its aux's
-     * hash entries against THAT opcode's PC, not against 0.  Any aux
-     * index appearing more than once in the code stream (in the weird
-     * case of shared aux) is validated against each occurrence. */
-    for (uint32_t i = 0; i < numAux; i++) {
-        if (auxArr[i].type != tbcxAuxJTStr && auxArr[i].type != tbcxAuxJTNum)
-            continue;
-        Tcl_HashTable *ht = (Tcl_HashTable *)auxArr[i].clientData;
-
-        /* Find every jumpTable / jumpTableNum opcode pointing at this
-         * aux entry, and validate each hash entry's target against
-         * its PC. */
-        int validated = 0;
-        pc = 0;
-        while (pc < codeLen) {
-            unsigned int op = code[pc];
-            const InstructionDesc *desc = &instTable[op];
-            const char *nm = desc->name;
-            if (nm && (strcmp(nm, "jumpTable") == 0 || strcmp(nm, "jumpTableNum") == 0)) {
-                /* Single AUX4 operand at pc+1. */
-                unsigned int auxIdx = TclGetUInt4AtPtr(code + pc + 1);
-                if (auxIdx == i) {
-                    Tcl_HashSearch hs;
-                    Tcl_HashEntry *he;
-                    for (he = Tcl_FirstHashEntry(ht, &hs); he;
-                         he = Tcl_NextHashEntry(&hs)) {
-                        intptr_t rel = (intptr_t)PTR2INT(Tcl_GetHashValue(he));
-                        int64_t  tgt = (int64_t)pc + rel;
-                        if (tgt < 0 || tgt >= (int64_t)codeLen || !boundary[tgt]) {
-                            Tcl_SetObjResult(ip, Tcl_ObjPrintf(
-                                "tbcx: jump-table aux %u: target pc+%" PRIdPTR
-                                " = %" PRId64 " out of range or off-boundary"
-                                " (jumpTable at pc %u, codeLen %u)",
-                                i, (intptr_t)rel, tgt, pc, codeLen));
-                            Tcl_Free(boundary);
-                            return TCL_ERROR;
-                        }
-                    }
-                    validated = 1;
-                }
+/* MaterializeBlock — build the bytecode object d describes.  Pool entries
+ * are shared through r->intern when tbcx::intern is on and the whole value
+ * (nested elements included) is of an internable kind.  On success the
+ * AuxData payloads have moved into the ByteCode; on failure they are
+ * still d's (BlockDescFree). */
+static Tcl_Obj *MaterializeBlock(TbcxIn *r, Tcl_Interp *ip, TbcxBlockDesc *d, Namespace *nsForDefault, uint32_t *numLocalsOut, int setPrecompiled, int dumpOnly) {
+    TbcxArena    *arena    = R_Arena(r);
+    TbcxArenaMark mark     = ArenaMark(arena);
+    Tcl_Obj     **lits     = NULL;
+    uint32_t      litsHeld = 0;
+    Tcl_Obj      *bc       = NULL;
+
+    if (d->numLits) {
+        lits = (Tcl_Obj **)ArenaAlloc(arena, sizeof(Tcl_Obj *) * (size_t)d->numLits);
+        if (!lits) {
+            R_Error(r, "tbcx: allocation failed (literals)");
+            goto done;
+        }
+    }
+    /* The namespace the block will run in, as TbcxByteCodeAlloc picks it;
+     * global code keys its names by string alone. */
+    Namespace *internNs = NULL;
+    if (r->intern) {
+        Interp *iPtr = (Interp *)ip;
+        internNs     = nsForDefault ? nsForDefault : iPtr->varFramePtr ? iPtr->varFramePtr->nsPtr : iPtr->globalNsPtr;
+        if (internNs == iPtr->globalNsPtr)
+            internNs = NULL;
+    }
+    for (; litsHeld < d->numLits; litsHeld++) {
+        TbcxLitDesc *ld  = &d->lits[litsHeld];
+        Tcl_Obj     *lit = MaterializeLiteral(r, ip, ld, dumpOnly);
+        if (!lit)
+            goto done;
+        if (r->intern && !(ld->tags & ~TBCX_INTERN_TAGS))
+            lit = InternLiteral(r->intern, (ld->tags & ~TBCX_INTERN_NAME_TAGS) ? NULL : internNs, lit);
+        Tcl_IncrRefCount(lit); /* Protect immediately — refcount 0→1 */
+        lits[litsHeld] = lit;
+    }
+
+    /* Operands were validated when d was decoded (ValidateBlock). */
+
+    bc = ByteCodeObj(ip, nsForDefault, d->code, d->codeLen, lits, d->numLits, d->aux, d->numAux, d->ex, d->numEx, (int)d->maxStack, setPrecompiled);
+    if (!bc) {
+        r->err = TCL_ERROR; /* no ownership transferred: d keeps the payloads */
+        goto done;
+    }
+    /* Each AuxData payload now belongs to the packed ByteCode (via the
+     * memcpy in TbcxByteCode), which frees it at destruction time. */
+    d->aux    = NULL;
+    d->numAux = 0;
+
+    if (d->numLocals > 0) {
+        ByteCode *bcPtr = TbcxGetByteCode(bc);
+        if (bcPtr) {
+            size_t      bytes = offsetof(LocalCache, varName0) + sizeof(Tcl_Obj *) * (size_t)d->numLocals;
+            LocalCache *lc    = (LocalCache *)Tcl_AttemptAlloc(bytes);
+            if (!lc) {
+                R_Error(r, "tbcx: allocation failed (local cache)");
+                Tcl_IncrRefCount(bc); /* bounce refcount-0 bc */
+                Tcl_DecrRefCount(bc);
+                bc = NULL;
+                goto done;
+            }
+            lc->refCount  = 1;
+            lc->numVars   = (Tcl_Size)d->numLocals;
+            Tcl_Obj **dst = (Tcl_Obj **)&lc->varName0;
+            for (uint32_t i = 0; i < d->numLocals; i++) {
+                dst[i] = r->strs->objs[d->locals[i]];
+                Tcl_IncrRefCount(dst[i]); /* borrowed from the string table */
             }
-            pc += (uint32_t)desc->numBytes;
+            bcPtr->localCachePtr = lc;
         }
-        (void)validated;
-        /* An aux slot that is never referenced is harmless at load time
-         * — it will be freed with the ByteCode and never dispatched to.
-         * We do not require that every aux entry be reachable. */
     }
+    if (numLocalsOut)
+        *numLocalsOut = d->numLocals;
 
-    Tcl_Free(boundary);
-    return TCL_OK;
+done:
+    /* Drop our protective refcount on literals — ByteCodeObj has its own */
+    for (uint32_t j = 0; j < litsHeld; j++)
+        Tcl_DecrRefCount(lits[j]);
+    ArenaRelease(arena, mark);
+    return bc;
 }
 
-Tcl_Obj *Tbcx_ReadBlock(TbcxIn *r, Tcl_Interp *ip, Namespace *nsForDefault, uint32_t *numLocalsOut, int setPrecompiled, int dumpOnly) {
-    /* 1) code */
-    uint32_t codeLen = 0;
-    if (!Tbcx_R_U32(r, &codeLen))
-        return NULL;
-    if (codeLen > TBCX_MAX_CODE) {
-        R_Error(r, "tbcx: code too large");
-        return NULL;
+/* ==========================================================================
+ * Parallel block decoding (tbcx::load -threads)
+ *
+ * With a memory-backed reader the section directory locates every proc and
+ * method record up front, so their compiled blocks can be decoded before
+ * the interp thread reaches them.  TbcxParDecode hands the records to a few
+ * worker threads, which run DecodeBlock (the interp-free phase) on readers
+ * of their own into arenas of their own.  The interp thread reads the
+ * records in artifact order as before; when ReadBlockInline arrives at a
+ * block a worker has finished, it waits for nothing and only materializes.
+ * A block a worker could not decode (a back-reference, or a damaged record)
+ * is decoded by the interp thread, which then reports any error itself.
+ * ========================================================================== */
+
+enum { TBCX_PAR_PENDING, TBCX_PAR_READY, TBCX_PAR_SKIPPED, TBCX_PAR_TAKEN };
+
+/* One proc or method record. */
+typedef struct TbcxParBlock {
+    uint32_t      kind;     /* TBCX_SEC_PROC or TBCX_SEC_METHOD */
+    size_t        secStart; /* absolute span of the record */
+    size_t        secEnd;
+    size_t        blockOff; /* its compiled block (READY only) */
+    size_t        endOff;
+    int           state;    /* TBCX_PAR_*, under the mutex */
+    TbcxBlockDesc desc;
+} TbcxParBlock;
+
+typedef struct TbcxParWorker {
+    struct TbcxParDecode *pd;
+    Tcl_ThreadId          id;
+    TbcxArena             arena; /* holds its blocks' descriptors until the end */
+    TbcxIn                r;
+} TbcxParWorker;
+
+typedef struct TbcxParDecode {
+    Tcl_Mutex      mutex;
+    Tcl_Condition  done;     /* signalled whenever a block leaves PENDING */
+    TbcxParBlock  *blocks;   /* in artifact order */
+    uint32_t       numBlocks;
+    uint32_t       nextTask; /* next block a worker claims (mutex) */
+    uint32_t       nextTake; /* next block the interp thread expects */
+    int            stop;     /* workers claim nothing more (mutex) */
+    TbcxParWorker *workers;
+    uint32_t       numWorkers;
+} TbcxParDecode;
+
+/* ParSkipHead — step r from the start of a record to its compiled block:
+ * the string refs and flag bytes ReadProc / ReadMethod read first, then
+ * the body source text. */
+static int ParSkipHead(TbcxIn *r, uint32_t kind) {
+    uint32_t v[3];
+    uint8_t  b;
+    if (kind == TBCX_SEC_METHOD) {
+        /* class, kind, scope, origin, name, args */
+        if (!Tbcx_R_Var(r, &v[0]) || !Tbcx_R_U8(r, &b) || !Tbcx_R_U8(r, &b) || !Tbcx_R_U8(r, &b) || !Tbcx_R_VarArray(r, v, 2))
+            return 0;
+    } else if (!Tbcx_R_VarArray(r, v, 3)) { /* name, namespace, args */
+        return 0;
     }
-    unsigned char *code = (unsigned char *)Tcl_AttemptAlloc(codeLen ? codeLen : 1u);
-    if (!code) {
-        R_Error(r, "tbcx: allocation failed (code)");
-        return NULL;
+    const unsigned char *src = NULL;
+    uint32_t             len = 0;
+    return Tbcx_R_Var(r, &len) && Tbcx_R_View(r, len, &src);
+}
+
+/* ParDecodeOne — decode pb's block on a worker.  0 leaves it to the interp
+ * thread. */
+static int ParDecodeOne(TbcxParWorker *w, TbcxParBlock *pb) {
+    TbcxIn       *r    = &w->r;
+    TbcxArenaMark mark = ArenaMark(&w->arena);
+    r->err             = TCL_OK;
+    r->errMsg          = NULL;
+    r->memPos          = pb->secStart;
+    if (!ParSkipHead(r, pb->kind))
+        return 0;
+    pb->blockOff = r->memPos;
+    if (r->dedup) {
+        uint32_t lead = 0;
+        size_t   used = Tbcx_DecodeVar(r->mem + r->memPos, r->memLen - r->memPos, &lead);
+        if (!used || lead >= TBCX_BLOCK_REF_BASE)
+            return 0;
     }
-    if (codeLen && !Tbcx_R_Bytes(r, code, codeLen)) {
-        Tcl_Free((char *)code);
-        return NULL;
+    if (!DecodeBlock(r, &w->arena, &pb->desc)) {
+        BlockDescFree(&pb->desc);
+        ArenaRelease(&w->arena, mark);
+        return 0;
     }
+    pb->endOff = r->memPos;
+    return 1;
+}
 
-    /* 2) literals */
-    uint32_t numLits = 0;
-    if (!Tbcx_R_U32(r, &numLits)) {
-        Tcl_Free((char *)code);
+static Tcl_ThreadCreateType ParDecodeWorker(void *cd) {
+    TbcxParWorker *w  = (TbcxParWorker *)cd;
+    TbcxParDecode *pd = w->pd;
+    for (;;) {
+        Tcl_MutexLock(&pd->mutex);
+        if (pd->stop || pd->nextTask >= pd->numBlocks) {
+            Tcl_MutexUnlock(&pd->mutex);
+            break;
+        }
+        TbcxParBlock *pb = &pd->blocks[pd->nextTask++];
+        Tcl_MutexUnlock(&pd->mutex);
+
+        int ok = ParDecodeOne(w, pb);
+
+        Tcl_MutexLock(&pd->mutex);
+        pb->state = ok ? TBCX_PAR_READY : TBCX_PAR_SKIPPED;
+        Tcl_ConditionNotify(&pd->done);
+        Tcl_MutexUnlock(&pd->mutex);
+    }
+    Tcl_ExitThread(0);
+    TCL_THREAD_CREATE_RETURN;
+}
+
+/* ParDecodeEnd — stop and join the workers, release every descriptor the
+ * interp thread did not take, and free pd. */
+static void ParDecodeEnd(TbcxParDecode *pd) {
+    if (!pd)
+        return;
+    Tcl_MutexLock(&pd->mutex);
+    pd->stop = 1;
+    Tcl_MutexUnlock(&pd->mutex);
+    for (uint32_t i = 0; i < pd->numWorkers; i++) {
+        int status;
+        Tcl_JoinThread(pd->workers[i].id, &status);
+    }
+    for (uint32_t i = 0; i < pd->numBlocks; i++)
+        if (pd->blocks[i].state == TBCX_PAR_READY)
+            BlockDescFree(&pd->blocks[i].desc);
+    for (uint32_t i = 0; i < pd->numWorkers; i++)
+        ArenaFree(&pd->workers[i].arena);
+    Tcl_MutexFinalize(&pd->mutex);
+    Tcl_ConditionFinalize(&pd->done);
+    Tcl_Free((char *)pd->workers);
+    Tcl_Free((char *)pd->blocks);
+    Tcl_Free((char *)pd);
+}
+
+/* ParDecodeBegin — start up to threads workers on the proc and method
+ * records of the artifact r reads.  Returns NULL, and the load runs
+ * sequentially, when there is nothing to share out or r cannot seek (a
+ * channel reader has no image for the directory to index into). */
+static TbcxParDecode *ParDecodeBegin(TbcxIn *r, const TbcxHeader *H, int threads) {
+    if (threads <= 0 || !r->mem)
         return NULL;
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < H->numSections; i++) {
+        const TbcxSection *sp = &H->sections[i];
+        if (sp->kind != TBCX_SEC_PROC && sp->kind != TBCX_SEC_METHOD)
+            continue;
+        if (H->dataBase > (uint64_t)r->memLen || sp->offset > (uint64_t)r->memLen - H->dataBase || sp->length > (uint64_t)r->memLen - H->dataBase - sp->offset)
+            return NULL; /* the sequential pass reports the bad directory */
+        n++;
     }
-    if (numLits > TBCX_MAX_LITERALS) {
-        R_Error(r, "tbcx: too many literals");
-        Tcl_Free((char *)code);
+    if (n < 2)
         return NULL;
+
+    TbcxParDecode *pd = (TbcxParDecode *)Tcl_Alloc(sizeof(TbcxParDecode));
+    memset(pd, 0, sizeof(*pd));
+    pd->blocks = (TbcxParBlock *)Tcl_Alloc(sizeof(TbcxParBlock) * (size_t)n);
+    memset(pd->blocks, 0, sizeof(TbcxParBlock) * (size_t)n);
+    for (uint32_t i = 0; i < H->numSections; i++) {
+        const TbcxSection *sp = &H->sections[i];
+        if (sp->kind != TBCX_SEC_PROC && sp->kind != TBCX_SEC_METHOD)
+            continue;
+        TbcxParBlock *pb = &pd->blocks[pd->numBlocks++];
+        pb->kind         = sp->kind;
+        pb->secStart     = (size_t)(H->dataBase + sp->offset);
+        pb->secEnd       = pb->secStart + (size_t)sp->length;
+    }
+
+    uint32_t want = (uint32_t)threads < n ? (uint32_t)threads : n;
+    pd->workers   = (TbcxParWorker *)Tcl_Alloc(sizeof(TbcxParWorker) * (size_t)want);
+    memset(pd->workers, 0, sizeof(TbcxParWorker) * (size_t)want);
+    for (uint32_t i = 0; i < want; i++) {
+        TbcxParWorker *w = &pd->workers[pd->numWorkers];
+        w->pd            = pd;
+        Tbcx_R_InitMem(&w->r, NULL, r->mem, r->memLen);
+        w->r.strs      = r->strs;
+        w->r.native    = r->native;
+        w->r.nativeAbi = r->nativeAbi;
+        w->r.dedup     = r->dedup;
+        w->r.trusted   = r->trusted;
+        w->r.checked   = r->checked;
+        w->r.arena     = &w->arena;
+        if (Tcl_CreateThread(&w->id, ParDecodeWorker, w, TCL_THREAD_STACK_DEFAULT, TCL_THREAD_JOINABLE) != TCL_OK)
+            break;
+        pd->numWorkers++;
     }
-    /* stack-allocate for small literal counts */
-    Tcl_Obj  *litStack[64];
-    Tcl_Obj **lits       = NULL;
-    int       litsOnHeap = 0;
-    if (numLits) {
-        if (numLits <= 64) {
-            lits = litStack;
-        } else {
-            size_t litBytes = 0;
-            if (!tbcx_checked_mul(sizeof(Tcl_Obj *), numLits, &litBytes)) {
-                R_Error(r, "tbcx: literal array size overflow");
-                Tcl_Free((char *)code);
-                return NULL;
-            }
-            lits = (Tcl_Obj **)Tcl_AttemptAlloc(litBytes);
-            if (!lits) {
-                R_Error(r, "tbcx: allocation failed (literals)");
-                Tcl_Free((char *)code);
-                return NULL;
-            }
-            litsOnHeap = 1;
-        }
+    if (pd->numWorkers == 0) {
+        ParDecodeEnd(pd);
+        return NULL;
     }
-    for (uint32_t i = 0; i < numLits; i++) {
-        Tcl_Obj *lit = ReadLiteral(r, ip, 0, dumpOnly);
-        if (!lit) {
-            for (uint32_t j = 0; j < i; j++) {
-                Tcl_DecrRefCount(lits[j]);
-            }
-            if (litsOnHeap)
-                Tcl_Free(lits);
-            Tcl_Free((char *)code);
+    return pd;
+}
+
+/* ParDecodeTake — the finished descriptor for the block at pos, waiting
+ * for its worker if need be; NULL when the interp thread must decode it
+ * (not a record's block, a back-reference target read out of order, or a
+ * block the workers skipped). */
+static TbcxParBlock *ParDecodeTake(TbcxParDecode *pd, size_t pos) {
+    while (pd->nextTake < pd->numBlocks) {
+        TbcxParBlock *pb = &pd->blocks[pd->nextTake];
+        if (pos < pb->secStart)
             return NULL;
+        if (pos >= pb->secEnd) {
+            pd->nextTake++; /* a record the interp thread did not decode through here */
+            continue;
         }
-        Tcl_IncrRefCount(lit); /* Protect immediately — refcount 0→1 */
-        lits[i] = lit;
-    }
-
-    /* 3) AuxData */
-    AuxData *auxArr = NULL;
-    uint32_t numAux = 0;
-    if (!ReadAuxArray(r, &auxArr, &numAux)) {
-        for (uint32_t j = 0; j < numLits; j++)
-            Tcl_DecrRefCount(lits[j]); /* refcount 1→0, freed */
-        if (litsOnHeap)
-            Tcl_Free(lits);
-        Tcl_Free((char *)code);
-        return NULL;
+        Tcl_MutexLock(&pd->mutex);
+        while (pb->state == TBCX_PAR_PENDING)
+            Tcl_ConditionWait(&pd->done, &pd->mutex, NULL);
+        int ready = pb->state == TBCX_PAR_READY && pb->blockOff == pos;
+        if (ready)
+            pb->state = TBCX_PAR_TAKEN;
+        Tcl_MutexUnlock(&pd->mutex);
+        if (!ready)
+            return NULL;
+        pd->nextTake++;
+        return pb;
     }
+    return NULL;
+}
 
-    /* 4) Exceptions */
-    ExceptionRange *exArr = NULL;
-    uint32_t        numEx = 0;
-    if (!ReadExceptions(r, &exArr, &numEx)) {
-        FreeAuxArrayOwned(auxArr, numAux);
-        for (uint32_t j = 0; j < numLits; j++)
-            Tcl_DecrRefCount(lits[j]); /* refcount 1→0, freed */
-        if (litsOnHeap)
-            Tcl_Free(lits);
-        Tcl_Free((char *)code);
-        return NULL;
-    }
+/* ReadBlockInline — decode the block stored at the cursor and build it.
+ * The descriptors live in the decode arena and go back in one release;
+ * a block the -threads workers already decoded is only materialized. */
+static Tcl_Obj *ReadBlockInline(TbcxIn *r, Tcl_Interp *ip, Namespace *nsForDefault, uint32_t *numLocalsOut, int setPrecompiled, int dumpOnly) {
+    TbcxArena    *arena = R_Arena(r);
+    TbcxArenaMark mark  = ArenaMark(arena);
+    TbcxBlockDesc d;
+    Tcl_Obj      *bc = NULL;
+
+    if (r->par && r->mem) {
+        TbcxParBlock *pb = ParDecodeTake(r->par, r->memPos);
+        if (pb) {
+            bc = MaterializeBlock(r, ip, &pb->desc, nsForDefault, numLocalsOut, setPrecompiled, dumpOnly);
+            if (!bc)
+                BlockDescFree(&pb->desc);
+            r->memPos = pb->endOff;
+            return bc;
+        }
+    }
+    memset(&d, 0, sizeof(d));
+    if (DecodeBlock(r, arena, &d))
+        bc = MaterializeBlock(r, ip, &d, nsForDefault, numLocalsOut, setPrecompiled, dumpOnly);
+    if (!bc)
+        BlockDescFree(&d);
+    ArenaRelease(arena, mark);
+    return bc;
+}
 
-    /* 5) Epilogue: maxStack, reserved, numLocals */
-    uint32_t maxStack = 0, reserved = 0, numLocals = 0;
-    if (!Tbcx_R_U32(r, &maxStack) || !Tbcx_R_U32(r, &reserved) || !Tbcx_R_U32(r, &numLocals)) {
-        if (exArr)
-            Tcl_Free(exArr);
-        FreeAuxArrayOwned(auxArr, numAux);
-        for (uint32_t j = 0; j < numLits; j++)
-            Tcl_DecrRefCount(lits[j]); /* refcount 1→0, freed */
-        if (litsOnHeap)
-            Tcl_Free(lits);
-        Tcl_Free((char *)code);
+/* A back-reference target (TbcxBlockTab entry).  bc is NULL while the
+ * target itself is being decoded. */
+typedef struct {
+    Tcl_Obj *bc; /* pristine copy: never installed, fixed up or run */
+    uint32_t numLocals;
+} TbcxSharedBlock;
+
+void Tbcx_BlockTabFree(TbcxBlockTab *t) {
+    if (!t->init)
+        return;
+    Tcl_HashSearch srch;
+    for (Tcl_HashEntry *he = Tcl_FirstHashEntry(&t->ht, &srch); he; he = Tcl_NextHashEntry(&srch)) {
+        TbcxSharedBlock *sb = (TbcxSharedBlock *)Tcl_GetHashValue(he);
+        if (sb->bc)
+            Tcl_DecrRefCount(sb->bc);
+        Tcl_Free((char *)sb);
+    }
+    Tcl_DeleteHashTable(&t->ht);
+    t->init = 0;
+}
+
+/* CloneBlock — new bytecode Tcl_Obj (refCount 0) with the same code,
+ * ranges, AuxData and locals as srcObj, compiled for nsPtr.  Literals are
+ * shared, except nested bytecode literals: fixups write their enclosing
+ * Proc into those, so each clone gets its own. */
+static Tcl_Obj *CloneBlock(Tcl_Interp *ip, Tcl_Obj *srcObj, Namespace *nsPtr, int setPrecompiled) {
+    const ByteCode *src     = TbcxGetByteCode(srcObj);
+    ByteCode       *codePtr = TbcxByteCodeAlloc(ip, nsPtr, NULL, (size_t)src->numCodeBytes, src->numLitObjects, src->numExceptRanges, src->numAuxDataItems, src->maxStackDepth);
+    if (!codePtr)
         return NULL;
-    }
+    if (src->numCodeBytes)
+        memcpy(codePtr->codeStart, src->codeStart, (size_t)src->numCodeBytes);
+    if (src->numExceptRanges)
+        memcpy(codePtr->exceptArrayPtr, src->exceptArrayPtr, sizeof(ExceptionRange) * (size_t)src->numExceptRanges);
+    codePtr->maxExceptDepth = src->maxExceptDepth;
+
+    for (Tcl_Size i = 0; i < src->numLitObjects; i++) {
+        Tcl_Obj        *lit   = src->objArrayPtr[i];
+        const ByteCode *litBC = lit ? TbcxGetByteCode(lit) : NULL;
+        if (litBC) {
+            Tcl_Obj *dup = CloneBlock(ip, lit, litBC->nsPtr, (litBC->flags & TCL_BYTECODE_PRECOMPILED) != 0);
+            if (!dup)
+                goto fail;
+            Tcl_InvalidateStringRep(dup);
+            if (lit->bytes)
+                Tcl_InitStringRep(dup, lit->bytes, (size_t)lit->length);
+            lit = dup;
+        }
+        if (lit)
+            Tcl_IncrRefCount(lit);
+        codePtr->objArrayPtr[i] = lit;
+    }
+
+    for (Tcl_Size i = 0; i < src->numAuxDataItems; i++) {
+        const AuxData *ad = &src->auxDataArrayPtr[i];
+        if (ad->clientData && (!ad->type || !ad->type->dupProc)) {
+            Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: cannot share AuxData of type '%s'", (ad->type && ad->type->name) ? ad->type->name : "(null)"));
+            goto fail;
+        }
+        codePtr->auxDataArrayPtr[i].type       = ad->type;
+        codePtr->auxDataArrayPtr[i].clientData = ad->clientData ? ad->type->dupProc(ad->clientData) : NULL;
+    }
+
+    if (src->localCachePtr) {
+        const LocalCache *from  = src->localCachePtr;
+        size_t            bytes = offsetof(LocalCache, varName0) + sizeof(Tcl_Obj *) * (size_t)from->numVars;
+        LocalCache       *lc    = (LocalCache *)Tcl_AttemptAlloc(bytes);
+        if (!lc) {
+            Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: allocation failed (local cache)", -1));
+            goto fail;
+        }
+        lc->refCount          = 1;
+        lc->numVars           = from->numVars;
+        Tcl_Obj *const *names = (Tcl_Obj *const *)&from->varName0;
+        Tcl_Obj       **dst   = (Tcl_Obj **)&lc->varName0;
+        for (Tcl_Size i = 0; i < from->numVars; i++) {
+            dst[i] = names[i];
+            Tcl_IncrRefCount(dst[i]);
+        }
+        codePtr->localCachePtr = lc;
+    }
+
+    Tcl_Obj *bc = Tcl_NewObj();
+    TbcxByteCodeAttach(bc, srcObj->typePtr, codePtr, setPrecompiled);
+    return bc;
 
-    (void)reserved; /* wire-format placeholder for future use */
+fail:
+    TbcxByteCodeDiscard(codePtr);
+    return NULL;
+}
 
-    /* Hard caps on untrusted values from the .tbcx stream to prevent
-     * huge allocations, integer wrap, or allocator panic.  These limits
-     * are generous for legitimate bytecode but reject pathological inputs. */
-    if (maxStack > TBCX_MAX_STACK) {
-        Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: maxStack %u exceeds limit %u", maxStack, TBCX_MAX_STACK));
-        if (exArr)
-            Tcl_Free(exArr);
-        FreeAuxArrayOwned(auxArr, numAux);
-        for (uint32_t j = 0; j < numLits; j++)
-            Tcl_DecrRefCount(lits[j]);
-        if (litsOnHeap)
-            Tcl_Free(lits);
-        Tcl_Free((char *)code);
+/* ReadBlockRef — the back-reference at the cursor (value dist, used bytes
+ * long) to the block dist bytes before it.  The target is decoded once
+ * per table, out of line and without the precompiled flag, and every
+ * reference site gets a clone of that pristine copy. */
+static Tcl_Obj *ReadBlockRef(TbcxIn *r, Tcl_Interp *ip, Namespace *nsForDefault, uint32_t *numLocalsOut, int setPrecompiled, int dumpOnly, uint32_t dist, size_t used) {
+    size_t at = r->memPos;
+    if (!r->blocks || dist == 0 || dist > at) {
+        R_Error(r, "tbcx: bad block reference");
         return NULL;
     }
-    if (numLocals > TBCX_MAX_LOCALS) {
-        Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: numLocals %u exceeds limit %u", numLocals, TBCX_MAX_LOCALS));
-        if (exArr)
-            Tcl_Free(exArr);
-        FreeAuxArrayOwned(auxArr, numAux);
-        for (uint32_t j = 0; j < numLits; j++)
-            Tcl_DecrRefCount(lits[j]);
-        if (litsOnHeap)
-            Tcl_Free(lits);
-        Tcl_Free((char *)code);
+    TbcxBlockTab *tab = r->blocks;
+    if (!tab->init) {
+        Tcl_InitHashTable(&tab->ht, TCL_ONE_WORD_KEYS);
+        tab->init = 1;
+    }
+    size_t           target = at - dist;
+    int              isNew;
+    Tcl_HashEntry   *he     = Tcl_CreateHashEntry(&tab->ht, (const char *)(uintptr_t)target, &isNew);
+    TbcxSharedBlock *sb;
+    if (isNew) {
+        sb            = (TbcxSharedBlock *)Tcl_Alloc(sizeof(TbcxSharedBlock));
+        sb->bc        = NULL;
+        sb->numLocals = 0;
+        Tcl_SetHashValue(he, sb);
+        r->memPos = target;
+        Tcl_Obj *bc = ReadBlockInline(r, ip, nsForDefault, &sb->numLocals, 0, dumpOnly);
+        r->memPos   = at;
+        if (!bc)
+            return NULL;
+        Tcl_IncrRefCount(bc);
+        sb->bc = bc;
+    } else {
+        sb = (TbcxSharedBlock *)Tcl_GetHashValue(he);
+        if (!sb->bc) {
+            R_Error(r, "tbcx: bad block reference");
+            return NULL;
+        }
+    }
+    Tcl_Obj *bc = CloneBlock(ip, sb->bc, nsForDefault, setPrecompiled);
+    if (!bc) {
+        r->err = TCL_ERROR;
         return NULL;
     }
-
+    r->memPos += used;
     if (numLocalsOut)
-        *numLocalsOut = numLocals;
-
-    Tcl_Obj  *nameObjsStack[64];
-    Tcl_Obj **nameObjs   = NULL;
-    int       nameOnHeap = 0;
-    if (numLocals > 0) {
-        if (numLocals <= 64) {
-            nameObjs = nameObjsStack;
-        } else {
-            nameObjs = (Tcl_Obj **)Tcl_AttemptAlloc(sizeof(Tcl_Obj *) * (size_t)numLocals);
-            if (!nameObjs) {
-                R_Error(r, "tbcx: allocation failed (local names)");
-                if (exArr)
-                    Tcl_Free(exArr);
-                FreeAuxArrayOwned(auxArr, numAux);
-                for (uint32_t j = 0; j < numLits; j++)
-                    Tcl_DecrRefCount(lits[j]);
-                if (litsOnHeap)
-                    Tcl_Free(lits);
-                Tcl_Free((char *)code);
-                return NULL;
-            }
-            nameOnHeap = 1;
-        }
-        for (uint32_t i = 0; i < numLocals; i++) {
-            char    *s   = NULL;
-            uint32_t len = 0;
-            if (!Tbcx_R_LPString(r, &s, &len)) {
-                if (nameObjs) {
-                    for (uint32_t k = 0; k < i; k++)
-                        Tcl_DecrRefCount(nameObjs[k]);
-                    if (nameOnHeap)
-                        Tcl_Free(nameObjs);
-                }
-                if (exArr)
-                    Tcl_Free(exArr);
-                FreeAuxArrayOwned(auxArr, numAux);
-                /* Release the protective refcounts taken on literal objects
-                 * before freeing the lits array — otherwise they leak. */
-                for (uint32_t j = 0; j < numLits; j++)
-                    Tcl_DecrRefCount(lits[j]);
-                if (litsOnHeap)
-                    Tcl_Free(lits);
-                Tcl_Free((char *)code);
-                return NULL;
-            }
-            Tcl_Obj *o = Tcl_NewStringObj(s, (Tcl_Size)len);
-            Tcl_Free(s);
-            nameObjs[i] = o; /* refcount 0 for now */
-        }
-    }
-
-    /* The per-block operand-validation pass (ValidateBlockOperands) is
-     * intentionally OMITTED for load speed.  It guards against hostile
-     * .tbcx artifacts: Tcl core does not re-validate bytecode operands at
-     * runtime, so a crafted file could OOB-read a literal or jump
-     * off-boundary.  The loader TRUSTS its input — load ONLY artifacts you
-     * produced/trust.  Re-enable by restoring the call here. */
-
-    /* Build bytecode object */
-    Tcl_Obj *bc = ByteCodeObj(ip, nsForDefault, code, codeLen, lits, numLits, auxArr, numAux, exArr, numEx, (int)maxStack, setPrecompiled);
-
-    if (exArr)
-        Tcl_Free(exArr);
-    /* On success, ownership of each auxArr[i].clientData payload has
-     * transferred into the packed ByteCode (via the memcpy in
-     * TbcxByteCode).  Free only the outer array then — the packed
-     * ByteCode will call each aux type's freeProc at destruction time.
-     * On failure no ownership transferred; deep-free the payloads here
-     * to avoid leaking them. */
-    if (bc) {
-        if (auxArr)
-            Tcl_Free(auxArr);
-    } else {
-        FreeAuxArrayOwned(auxArr, numAux);
+        *numLocalsOut = sb->numLocals;
+    return bc;
+}
+
+/* Tbcx_ReadBlock — decode one compiled block; see ReadBlockInline and, for
+ * TBCX_HDR_FL_DEDUP artifacts (always read from memory), ReadBlockRef. */
+Tcl_Obj *Tbcx_ReadBlock(TbcxIn *r, Tcl_Interp *ip, Namespace *nsForDefault, uint32_t *numLocalsOut, int setPrecompiled, int dumpOnly) {
+    if (r->dedup && r->mem && !r->err) {
+        uint32_t lead = 0;
+        size_t   used = Tbcx_DecodeVar(r->mem + r->memPos, r->memLen - r->memPos, &lead);
+        if (used && lead >= TBCX_BLOCK_REF_BASE)
+            return ReadBlockRef(r, ip, nsForDefault, numLocalsOut, setPrecompiled, dumpOnly, lead - TBCX_BLOCK_REF_BASE, used);
     }
-    /* Drop our protective refcount on literals — ByteCodeObj has its own */
-    for (uint32_t j = 0; j < numLits; j++)
-        Tcl_DecrRefCount(lits[j]);
-    if (litsOnHeap)
-        Tcl_Free(lits);
-    if (code)
-        Tcl_Free(code);
-
-    if (bc && numLocals > 0 && nameObjs) {
-        ByteCode *bcPtr = NULL;
-        bcPtr           = TbcxGetByteCode(bc);
-        if (bcPtr) {
-            size_t varBytes = 0;
-            if (!tbcx_checked_mul((size_t)numLocals, sizeof(Tcl_Obj *), &varBytes) || varBytes > SIZE_MAX - offsetof(LocalCache, varName0)) {
-                R_Error(r, "tbcx: local cache size overflow");
-                for (uint32_t k = 0; k < numLocals; k++) {
-                    if (nameObjs[k]) {
-                        Tcl_IncrRefCount(nameObjs[k]);
-                        Tcl_DecrRefCount(nameObjs[k]);
-                    }
-                }
-                if (nameOnHeap)
-                    Tcl_Free(nameObjs);
-                Tcl_IncrRefCount(bc);
-                Tcl_DecrRefCount(bc);
-                return NULL;
-            }
-            size_t      bytes = offsetof(LocalCache, varName0) + varBytes;
-            LocalCache *lc    = (LocalCache *)Tcl_AttemptAlloc(bytes);
-            if (!lc) {
-                R_Error(r, "tbcx: allocation failed (local cache)");
-                /* Bounce refcount-0 nameObjs */
-                for (uint32_t k = 0; k < numLocals; k++) {
-                    if (nameObjs[k]) {
-                        Tcl_IncrRefCount(nameObjs[k]);
-                        Tcl_DecrRefCount(nameObjs[k]);
-                    }
-                }
-                if (nameOnHeap)
-                    Tcl_Free(nameObjs);
-                /* Bounce refcount-0 bc */
-                Tcl_IncrRefCount(bc);
-                Tcl_DecrRefCount(bc);
-                return NULL;
-            }
-            lc->refCount  = 1;
-            lc->numVars   = (Tcl_Size)numLocals;
-            Tcl_Obj **dst = (Tcl_Obj **)&lc->varName0;
-            for (uint32_t i = 0; i < numLocals; i++) {
-                dst[i] = nameObjs[i];
-                Tcl_IncrRefCount(dst[i]);
-            }
-            bcPtr->localCachePtr = lc;
-        } else {
-            /* bcPtr is NULL — nameObjs entries are at refcount 0 and
-               will not be transferred to a LocalCache.  Release them. */
-            for (uint32_t i = 0; i < numLocals; i++) {
-                if (nameObjs[i]) {
-                    Tcl_IncrRefCount(nameObjs[i]);
-                    Tcl_DecrRefCount(nameObjs[i]);
-                }
-            }
-        }
-        if (nameOnHeap)
-            Tcl_Free(nameObjs);
-    } else if (numLocals > 0 && nameObjs) {
-        /* bc is NULL — ByteCodeObj failed.  Release the refcount-0
-           nameObjs entries and free the heap array to avoid leaks. */
-        for (uint32_t i = 0; i < numLocals; i++) {
-            if (nameObjs[i]) {
-                Tcl_IncrRefCount(nameObjs[i]);
-                Tcl_DecrRefCount(nameObjs[i]);
-            }
+    return ReadBlockInline(r, ip, nsForDefault, numLocalsOut, setPrecompiled, dumpOnly);
+}
+
+/* ==========================================================================
+ * Lazy proc and method bodies (tbcx::load -lazy)
+ *
+ * A lazily loaded proc is a real Proc (args, namespace, `info body` and
+ * `info args` all work) whose bodyPtr is a tbcxLazyBody placeholder and
+ * whose command dispatches through LazyProcCmd.  The first call decodes the
+ * compiled block out of the retained artifact image, swaps it in, points
+ * the command back at the ordinary proc handlers and re-dispatches.
+ *
+ * Methods work the same way one level down: the OOShim installs them with
+ * the placeholder as the Proc body, LazyMethodsArm points each such Method
+ * at tbcxLazyMethodType, and LazyMethodInvoke materializes the body on the
+ * first dispatch, restores TclOO's own method type and forwards the call.
+ * ========================================================================== */
+
+static void LazyBodyRelease(TbcxLazyBody *lb) {
+    if (--lb->refCount > 0)
+        return;
+    ImageRelease(lb->img);
+    Tcl_DecrRefCount(lb->nsObj);
+    Tcl_Free((char *)lb);
+}
+
+static void LazyBodyFreeIntRep(Tcl_Obj *objPtr);
+static void LazyBodyDupIntRep(Tcl_Obj *srcPtr, Tcl_Obj *dupPtr);
+static void LazyBodyUpdateString(Tcl_Obj *objPtr);
+
+static const Tcl_ObjType tbcxLazyBodyType = {"tbcxLazyBody", LazyBodyFreeIntRep, LazyBodyDupIntRep, LazyBodyUpdateString, NULL, TCL_OBJTYPE_V0};
+
+static void LazyBodyFreeIntRep(Tcl_Obj *objPtr) {
+    LazyBodyRelease((TbcxLazyBody *)objPtr->internalRep.twoPtrValue.ptr1);
+}
+
+static void LazyBodyDupIntRep(Tcl_Obj *srcPtr, Tcl_Obj *dupPtr) {
+    TbcxLazyBody *lb = (TbcxLazyBody *)srcPtr->internalRep.twoPtrValue.ptr1;
+    lb->refCount++;
+    Tcl_ObjInternalRep ir;
+    ir.twoPtrValue.ptr1 = lb;
+    ir.twoPtrValue.ptr2 = NULL;
+    Tcl_StoreInternalRep(dupPtr, &tbcxLazyBodyType, &ir);
+}
+
+/* The string rep is the saved body source, or the stripped-source sentinel
+ * when the artifact was built without -include-source (or the record is
+ * damaged — the decode on first call reports that properly). */
+static void LazyBodyUpdateString(Tcl_Obj *objPtr) {
+    const TbcxLazyBody  *lb  = (const TbcxLazyBody *)objPtr->internalRep.twoPtrValue.ptr1;
+    const TbcxImage     *img = lb->img;
+    uint32_t             n   = 0;
+    if (lb->srcOff <= (uint64_t)img->len) {
+        const unsigned char *p    = img->base + lb->srcOff;
+        size_t               left = img->len - (size_t)lb->srcOff;
+        size_t               used = Tbcx_DecodeVar(p, left, &n);
+        if (used && n > 0 && (size_t)n <= left - used) {
+            Tcl_InitStringRep(objPtr, (const char *)p + used, n);
+            return;
         }
-        if (nameOnHeap)
-            Tcl_Free(nameObjs);
     }
+    Tcl_InitStringRep(objPtr, TBCX_STRIPPED_SOURCE_SENTINEL, sizeof(TBCX_STRIPPED_SOURCE_SENTINEL) - 1u);
+}
 
-    return bc;
+/* NewLazyBody — placeholder body for the proc record whose body source
+ * starts at srcOff.  Takes a new reference on img. */
+static Tcl_Obj *NewLazyBody(TbcxImage *img, uint64_t srcOff, uint64_t endOff, Tcl_Obj *nsObj) {
+    TbcxLazyBody *lb = (TbcxLazyBody *)Tcl_Alloc(sizeof(TbcxLazyBody));
+    lb->refCount     = 1;
+    lb->img          = img;
+    img->refCount++;
+    lb->srcOff = srcOff;
+    lb->endOff = endOff;
+    lb->nsObj  = nsObj;
+    Tcl_IncrRefCount(nsObj);
+
+    Tcl_Obj *objPtr = Tcl_NewObj();
+    Tcl_InvalidateStringRep(objPtr);
+    Tcl_ObjInternalRep ir;
+    ir.twoPtrValue.ptr1 = lb;
+    ir.twoPtrValue.ptr2 = NULL;
+    Tcl_StoreInternalRep(objPtr, &tbcxLazyBodyType, &ir);
+    return objPtr;
+}
+
+/* LazyBodyMaterialize — decode the compiled block behind procPtr's lazy
+ * body and install it exactly as the eager loader would have at load time.
+ * The block is decoded against lb's namespace; fixNs (that namespace when
+ * NULL) and cacheMode are passed on to TbcxFixupByteCode. */
+static int LazyBodyMaterialize(Tcl_Interp *ip, Proc *procPtr, TbcxLazyBody *lb, Namespace *fixNs, int cacheMode) {
+    TbcxIn r;
+    Tbcx_R_InitMem(&r, ip, lb->img->base, lb->img->len);
+    r.strs      = lb->img->strs;
+    r.native    = lb->img->native;
+    r.nativeAbi = lb->img->nativeAbi;
+    r.dedup     = lb->img->dedup;
+    r.trusted   = lb->img->trusted;
+    r.checked   = lb->img->checked;
+    r.blocks    = &lb->img->blocks;
+    TbcxInterpState *st = TbcxGetInterpState(ip);
+    r.intern             = st->internOn ? &st->intern : NULL;
+    if (lb->srcOff > (uint64_t)r.memLen) {
+        R_Error(&r, "tbcx: lazy body out of range");
+        return TCL_ERROR;
+    }
+    r.memPos = (size_t)lb->srcOff;
+
+    /* Skip the body source; the placeholder's string rep already has it. */
+    uint32_t             srcLen = 0;
+    const unsigned char *srcP   = NULL;
+    if (!Tbcx_R_Var(&r, &srcLen) || !Tbcx_R_View(&r, srcLen, &srcP))
+        return TCL_ERROR;
+
+    Namespace *nsPtr  = (Namespace *)Tbcx_EnsureNamespace(ip, Tcl_GetString(lb->nsObj));
+    uint32_t   nLoc   = 0;
+    Tcl_Obj   *bodyBC = Tbcx_ReadBlock(&r, ip, nsPtr, &nLoc, 1, 0);
+    if (!bodyBC)
+        return TCL_ERROR;
+    Tcl_IncrRefCount(bodyBC);
+    if (Tbcx_R_Tell(&r) != lb->endOff) {
+        Tcl_DecrRefCount(bodyBC);
+        R_Error(&r, "tbcx: lazy body does not match its record");
+        return TCL_ERROR;
+    }
+
+    /* Same string-rep attachment as ReadProc Stage 4.5. */
+    Tcl_Size    bLen = 0;
+    const char *bStr = Tcl_GetStringFromObj(procPtr->bodyPtr, &bLen);
+    Tcl_InvalidateStringRep(bodyBC);
+    Tcl_InitStringRep(bodyBC, bStr, (size_t)bLen);
+
+    Tcl_DecrRefCount(procPtr->bodyPtr); /* releases lb via the placeholder */
+    procPtr->bodyPtr = bodyBC;          /* takes our reference */
+    CompiledLocals(procPtr, (Tcl_Size)nLoc);
+    ByteCode *bc = TbcxGetByteCode(bodyBC);
+    if (bc)
+        TbcxFixupByteCode(bc, procPtr, ip, fixNs ? fixNs : nsPtr, cacheMode);
+    return TCL_OK;
+}
+
+/* LazyProcCmd — objProc2 of a proc whose body is still deferred.  cd is
+ * the Proc (as for ordinary procs, so TclIsProc and introspection see a
+ * proc).  A body that lost its lazy rep to shimmering is simply compiled
+ * from its string rep by the ordinary handler, exactly as an eagerly
+ * loaded body would be. */
+static int LazyProcCmd(void *cd, Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_ASSERT_INTERP_THREAD(ip);
+    Proc                     *procPtr = (Proc *)cd;
+    TbcxInterpState          *st      = TbcxGetInterpState(ip);
+    const Tcl_ObjInternalRep *ir      = Tcl_FetchInternalRep(procPtr->bodyPtr, &tbcxLazyBodyType);
+    if (ir) {
+        TbcxLazyBody *lb = (TbcxLazyBody *)ir->twoPtrValue.ptr1;
+        lb->refCount++; /* the placeholder is released mid-materialize */
+        int rc = LazyBodyMaterialize(ip, procPtr, lb, procPtr->cmdPtr->nsPtr, TBCX_FIXUP_CACHE_DROP);
+        LazyBodyRelease(lb);
+        if (rc != TCL_OK)
+            return TCL_ERROR;
+    }
+    Command *cmdPtr  = procPtr->cmdPtr;
+    cmdPtr->objProc2 = st->procDispatchObj;
+    cmdPtr->nreProc2 = st->procDispatchNre;
+    return st->procDispatchObj(procPtr, ip, objc, objv);
+}
+
+/* TclOO's procedure-method type, captured from the first Method armed, and
+ * copies of it whose callProc is LazyMethodCall/LazyMethodCall2 (delete and
+ * clone are TclOO's own; a cloned method keeps the lazy type and is simply
+ * restored on its first call).  Process-wide, like TclOO's static type. */
+TCL_DECLARE_MUTEX(tbcxLazyMethodMutex);
+static const Tcl_MethodType *tbcxProcMethodType = NULL;
+static Tcl_MethodType        tbcxLazyMethodType;
+static Tcl_MethodType2       tbcxLazyMethodType2;
+
+/* LazyMethodInvoke — first dispatch of a method whose body is still
+ * deferred.  cd is the ProcedureMethod.  The body is decoded against the
+ * class namespace, as ReadMethod does eagerly; TclOO re-targets the
+ * ByteCode at the object namespace on every call. */
+static int LazyMethodInvoke(void *cd, Tcl_Interp *ip, Tcl_ObjectContext context, Tcl_Size objc, Tcl_Obj *const *objv) {
+    TBCX_ASSERT_INTERP_THREAD(ip);
+    ProcedureMethod          *pmPtr   = (ProcedureMethod *)cd;
+    Proc                     *procPtr = pmPtr->procPtr;
+    const Tcl_ObjInternalRep *ir      = Tcl_FetchInternalRep(procPtr->bodyPtr, &tbcxLazyBodyType);
+    if (ir) {
+        TbcxLazyBody *lb = (TbcxLazyBody *)ir->twoPtrValue.ptr1;
+        lb->refCount++; /* the placeholder is released mid-materialize */
+        int rc = LazyBodyMaterialize(ip, procPtr, lb, NULL, TBCX_FIXUP_CACHE_KEEP);
+        LazyBodyRelease(lb);
+        if (rc != TCL_OK)
+            return TCL_ERROR;
+    }
+    /* Hand the Method back to TclOO; call chains hold the Method, not its
+       type, so cached chains and [next] pick the restored type up as-is. */
+    CallContext *ctxPtr = (CallContext *)context;
+    Method      *mPtr   = ctxPtr->callPtr->chain[ctxPtr->index].mPtr;
+    if (mPtr->clientData == cd)
+        mPtr->typePtr = tbcxProcMethodType;
+    if (tbcxProcMethodType->version < TCL_OO_METHOD_VERSION_2)
+        return tbcxProcMethodType->callProc(cd, ip, context, (int)objc, objv);
+    return ((const Tcl_MethodType2 *)tbcxProcMethodType)->callProc(cd, ip, context, objc, objv);
+}
+
+static int LazyMethodCall(void *cd, Tcl_Interp *ip, Tcl_ObjectContext context, int objc, Tcl_Obj *const *objv) {
+    return LazyMethodInvoke(cd, ip, context, (Tcl_Size)objc, objv);
+}
+
+static int LazyMethodCall2(void *cd, Tcl_Interp *ip, Tcl_ObjectContext context, Tcl_Size objc, Tcl_Obj *const *objv) {
+    return LazyMethodInvoke(cd, ip, context, objc, objv);
+}
+
+/* LazyMethodArm — point mPtr at the lazy method type if it is a procedure
+ * method whose body is a tbcxLazyBody placeholder. */
+static void LazyMethodArm(Method *mPtr) {
+    if (!mPtr || !mPtr->typePtr || !mPtr->clientData)
+        return;
+    const Tcl_MethodType *ty = mPtr->typePtr;
+    if (ty == &tbcxLazyMethodType || ty == (const Tcl_MethodType *)&tbcxLazyMethodType2)
+        return;
+    if (tbcxProcMethodType ? ty != tbcxProcMethodType : strcmp(ty->name, "method") != 0)
+        return;
+    Proc *procPtr = ((ProcedureMethod *)mPtr->clientData)->procPtr;
+    if (!procPtr || !procPtr->bodyPtr || !Tcl_FetchInternalRep(procPtr->bodyPtr, &tbcxLazyBodyType))
+        return;
+    if (!tbcxProcMethodType) {
+        Tcl_MutexLock(&tbcxLazyMethodMutex);
+        if (!tbcxProcMethodType) {
+            memcpy(&tbcxLazyMethodType, ty, sizeof(Tcl_MethodType));
+            memcpy(&tbcxLazyMethodType2, ty, sizeof(Tcl_MethodType2));
+            tbcxLazyMethodType.callProc  = LazyMethodCall;
+            tbcxLazyMethodType2.callProc = LazyMethodCall2;
+            tbcxProcMethodType           = ty;
+        }
+        Tcl_MutexUnlock(&tbcxLazyMethodMutex);
+    }
+    if (ty->version < TCL_OO_METHOD_VERSION_2)
+        mPtr->typePtr = &tbcxLazyMethodType;
+    else
+        mPtr->type2Ptr = &tbcxLazyMethodType2;
+}
+
+/* LazyMethodsArm — arm every deferred method of the object named by fqn:
+ * its per-object methods and, for a class, its class methods, constructor
+ * and destructor.  Run by the OOShim after each definition it handles, so
+ * a method is armed before anything can dispatch it.  Leaves the interp
+ * result untouched. */
+static void LazyMethodsArm(Tcl_Interp *ip, Tcl_Obj *fqn) {
+    Tcl_Obj *res = Tcl_GetObjResult(ip);
+    Tcl_IncrRefCount(res);
+    Tcl_Object tclObj = Tcl_GetObjectFromObj(ip, fqn);
+    Tcl_SetObjResult(ip, res);
+    Tcl_DecrRefCount(res);
+    if (!tclObj)
+        return;
+    Object        *oPtr = (Object *)tclObj;
+    Tcl_HashSearch s;
+    Tcl_HashEntry *e;
+    if (oPtr->methodsPtr) {
+        for (e = Tcl_FirstHashEntry(oPtr->methodsPtr, &s); e; e = Tcl_NextHashEntry(&s))
+            LazyMethodArm((Method *)Tcl_GetHashValue(e));
+    }
+    Class *clsPtr = oPtr->classPtr;
+    if (clsPtr) {
+        for (e = Tcl_FirstHashEntry(&clsPtr->classMethods, &s); e; e = Tcl_NextHashEntry(&s))
+            LazyMethodArm((Method *)Tcl_GetHashValue(e));
+        LazyMethodArm(clsPtr->constructorPtr);
+        LazyMethodArm(clsPtr->destructorPtr);
+    }
 }
 
 /* ProcShim_DirectInstall — build and register a new Proc from precompiled
  * data without going through TclCreateProc.  Called on the fast path once
  * handler pointers have been captured from the first slow-path proc.
+ * bodyObj is shared, not copied; numLocals sizes the compiled-local chain.
  * Returns TCL_OK on success, TCL_ERROR on command-creation failure. */
-static int ProcShim_DirectInstall(ProcShim *ps, Tcl_Interp *ip, Tcl_Obj *fqn, Tcl_Obj *nameObj, Proc *preProc, Tcl_Obj *savedArgs) {
+static int ProcShim_DirectInstall(ProcShim *ps, Tcl_Interp *ip, Tcl_Obj *fqn, Tcl_Obj *nameObj, Tcl_Obj *bodyObj, Tcl_Size numLocals, Tcl_Obj *savedArgs, Command **cmdOut) {
     (void)nameObj; /* install keys off fqn; name kept in the signature for callers */
     /* Build a new Proc directly from our precompiled data. */
     Proc *newProc = (Proc *)Tcl_Alloc(sizeof(Proc));
     memset(newProc, 0, sizeof(Proc));
     newProc->iPtr     = (Interp *)ip;
     newProc->refCount = 1;
-    newProc->bodyPtr  = preProc->bodyPtr;
+    newProc->bodyPtr  = bodyObj;
     Tcl_IncrRefCount(newProc->bodyPtr);
     {
         CompiledLocal *first = NULL, *last = NULL;
@@ -4429,7 +6053,7 @@ static int ProcShim_DirectInstall(ProcShim *ps, Tcl_Interp *ip, Tcl_Obj *fqn, Tc
         newProc->firstLocalPtr     = first;
         newProc->lastLocalPtr      = last;
     }
-    CompiledLocals(newProc, preProc->numCompiledLocals);
+    CompiledLocals(newProc, numLocals);
 
     /* Resolve namespace */
     const char *fqnStr = Tbcx_GetStringSafe(fqn);
@@ -4467,6 +6091,43 @@ static int ProcShim_DirectInstall(ProcShim *ps, Tcl_Interp *ip, Tcl_Obj *fqn, Tc
     if (bc) {
         TbcxFixupByteCode(bc, newProc, ip, nsPtr, TBCX_FIXUP_CACHE_DROP);
     }
+    if (cmdOut)
+        *cmdOut = cmdPtr;
+    return TCL_OK;
+}
+
+/* ProcShim_LazyInstall — define a proc whose body is a tbcxLazyBody
+ * placeholder.  Mirrors the eager install: the first proc goes through the
+ * real [proc] so the dispatch handlers can be captured, later ones are
+ * registered directly.  Either way the command then dispatches through
+ * LazyProcCmd until its first call. */
+static int ProcShim_LazyInstall(ProcShim *ps, Tcl_Interp *ip, Tcl_Obj *fqn, Tcl_Size objc, Tcl_Obj *const objv[], Tcl_Obj *lazyBody, Tcl_Obj *savedArgs) {
+    Command *cmdPtr = NULL;
+    if (ps->haveDispatch) {
+        if (ProcShim_DirectInstall(ps, ip, fqn, objv[1], lazyBody, 0, savedArgs, &cmdPtr) != TCL_OK)
+            return TCL_ERROR;
+    } else {
+        int rc = ps->savedObjProc2(ps->savedClientData2, ip, objc, objv);
+        if (rc != TCL_OK)
+            return rc;
+        Tcl_Command cmd = Tcl_FindCommand(ip, Tbcx_GetStringSafe(fqn), NULL, TCL_GLOBAL_ONLY);
+        if (!cmd || !((Command *)cmd)->objClientData2)
+            return rc;
+        cmdPtr            = (Command *)cmd;
+        Proc *newProc     = (Proc *)cmdPtr->objClientData2;
+        ps->procDispatchObj = cmdPtr->objProc2;
+        ps->procDispatchNre = cmdPtr->nreProc2;
+        ps->procDeleteProc  = cmdPtr->deleteProc;
+        ps->haveDispatch    = 1;
+        Tcl_IncrRefCount(lazyBody);
+        Tcl_DecrRefCount(newProc->bodyPtr);
+        newProc->bodyPtr = lazyBody;
+    }
+    TbcxInterpState *st = TbcxGetInterpState(ip);
+    st->procDispatchObj = ps->procDispatchObj;
+    st->procDispatchNre = ps->procDispatchNre;
+    cmdPtr->objProc2    = LazyProcCmd;
+    cmdPtr->nreProc2    = NULL;
     return TCL_OK;
 }
 
@@ -4558,6 +6219,14 @@ static int CmdProcShim(void *cd, Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const o
             const char *b = Tbcx_GetStringFromObjSafe(savedArgs, &bLen);
 
             if (aLen == bLen && memcmp(a, b, (size_t)aLen) == 0) {
+                /* Deferred body (tbcx::load -lazy) */
+                if (Tcl_FetchInternalRep(procBody, &tbcxLazyBodyType)) {
+                    int lrc = ProcShim_LazyInstall(ps, ip, fqn, objc, objv, procBody, savedArgs);
+                    if (fqn != nameObj)
+                        Tcl_DecrRefCount(fqn);
+                    return lrc;
+                }
+
                 /* Get our precompiled Proc from the registry. */
                 const Tcl_ObjInternalRep *pbIR    = Tcl_FetchInternalRep(procBody, tbcxTyProcBody);
                 Proc                     *preProc = pbIR ? (Proc *)pbIR->twoPtrValue.ptr1 : NULL;
@@ -4573,7 +6242,7 @@ static int CmdProcShim(void *cd, Tcl_Interp *ip, Tcl_Size objc, Tcl_Obj *const o
                  * entirely for subsequent procs.  This avoids N compilations
                  * of the empty body string "". */
                 if (ps->haveDispatch) {
-                    int drc = ProcShim_DirectInstall(ps, ip, fqn, nameObj, preProc, savedArgs);
+                    int drc = ProcShim_DirectInstall(ps, ip, fqn, nameObj, preProc->bodyPtr, preProc->numCompiledLocals, savedArgs, NULL);
                     if (fqn != nameObj)
                         Tcl_DecrRefCount(fqn);
                     return drc;
@@ -4927,6 +6596,19 @@ static void ApplyShimTeardown(ApplyShim *as, Tcl_Interp *ip) {
     Tcl_DeleteHashTable(&as->lambdaRegistry);
 }
 
+/* InternRelease — drop the tbcx::intern table and its references and turn
+ * interning off.  Blocks already loaded keep the objects they share. */
+static void InternRelease(TbcxInterpState *st) {
+    if (!st->internOn)
+        return;
+    Tcl_HashSearch s;
+    for (Tcl_HashEntry *e = Tcl_FirstHashEntry(&st->intern, &s); e; e = Tcl_NextHashEntry(&s)) {
+        Tcl_DecrRefCount((Tcl_Obj *)Tcl_GetHashValue(e));
+    }
+    Tcl_DeleteHashTable(&st->intern);
+    st->internOn = 0;
+}
+
 /* TbcxInterpStateCleanup — Tcl_SetAssocData delete callback.
  * Called when the interpreter is being destroyed.  Tears down the
  * apply shim (if active) and frees the consolidated state struct. */
@@ -4940,6 +6622,8 @@ static void TbcxInterpStateCleanup(void *cd, Tcl_Interp *ip) {
            apply shim was never activated — just delete the empty table. */
         Tcl_DeleteHashTable(&st->apply.lambdaRegistry);
     }
+    InternRelease(st);
+    ArenaFree(&st->scratch);
     Tcl_Free(st);
 }
 
@@ -5046,11 +6730,24 @@ static void ApplyShimPurgeStale(ApplyShim *as) {
  * Safe to call even when no ApplyShim has been installed (no-op).
  * ========================================================================== */
 
-void TbcxApplyShimPurgeAll(Tcl_Interp *ip) {
+void TbcxApplyShimPurgeAll(Tcl_Interp *ip) {
+    TBCX_ASSERT_INTERP_THREAD(ip);
+    TbcxInterpState *st = (TbcxInterpState *)Tcl_GetAssocData(ip, TBCX_INTERP_STATE_KEY, NULL);
+    if (st && st->applyActive)
+        ApplyShimPurgeStale(&st->apply);
+}
+
+/* ==========================================================================
+ * Drops tbcx::intern entries that no loaded block uses any more (the table
+ * holds the only reference).  No-op while interning is off.
+ * ========================================================================== */
+
+void TbcxInternPurge(Tcl_Interp *ip) {
     TBCX_ASSERT_INTERP_THREAD(ip);
     TbcxInterpState *st = (TbcxInterpState *)Tcl_GetAssocData(ip, TBCX_INTERP_STATE_KEY, NULL);
-    if (st && st->applyActive)
-        ApplyShimPurgeStale(&st->apply);
+    if (!st || !st->internOn)
+        return;
+    InternPrune(&st->intern);
 }
 
 /* EnsureApplyShim — get or activate the per-interp ApplyShim.
@@ -5139,42 +6836,47 @@ static void RegisterPrecompiledLambda(Tcl_Interp *ip, Tcl_Obj *lambda, Proc *pro
 }
 
 int Tbcx_ReadHeader(TbcxIn *r, TbcxHeader *H) {
-    if (!Tbcx_R_U32(r, &H->magic))
-        return 0;
-    if (!Tbcx_R_U32(r, &H->format))
-        return 0;
-    if (!Tbcx_R_U32(r, &H->tcl_version))
-        return 0;
-    if (!Tbcx_R_U64(r, &H->codeLenTop))
-        return 0;
-    if (!Tbcx_R_U32(r, &H->numExceptTop))
+    /* Fixed-width fields are read as one block and decoded in place. */
+    unsigned char fx[TBCX_HDR_FIXED];
+    if (!Tbcx_R_Bytes(r, fx, TBCX_HDR_FIXED))
         return 0;
-    if (!Tbcx_R_U32(r, &H->numLitsTop))
-        return 0;
-    if (!Tbcx_R_U32(r, &H->numAuxTop))
-        return 0;
-    if (!Tbcx_R_U32(r, &H->numLocalsTop))
-        return 0;
-    if (!Tbcx_R_U32(r, &H->maxStackTop))
-        return 0;
-
-    /* source path LPString, immediately after fixed-size fields.
-     * Empty string means the artifact was built from an inline script
-     * or channel (no path to preserve).  Non-empty means set
+    H->magic        = Tbcx_GetLe32(fx + 0);
+    H->format       = Tbcx_GetLe32(fx + 4);
+    H->tcl_version  = Tbcx_GetLe32(fx + 8);
+    H->codeLenTop   = Tbcx_GetLe64(fx + 12);
+    H->numExceptTop = Tbcx_GetLe32(fx + 20);
+    H->numLitsTop   = Tbcx_GetLe32(fx + 24);
+    H->numAuxTop    = Tbcx_GetLe32(fx + 28);
+    H->numLocalsTop = Tbcx_GetLe32(fx + 32);
+    H->maxStackTop  = Tbcx_GetLe32(fx + 36);
+
+    /* source path, immediately after fixed-size fields: a u32 length
+     * (the header is fixed-width; varints start at the data base) and the
+     * bytes.  Empty string means the artifact was built from an inline
+     * script or channel (no path to preserve).  Non-empty means set
      * iPtr->scriptFile to this during top-level eval so `info script`
      * returns the authored source path. */
     {
-        char    *srcP = NULL;
-        uint32_t srcL = 0;
-        if (!Tbcx_R_LPString(r, &srcP, &srcL))
+        uint32_t srcL = Tbcx_GetLe32(fx + 40);
+        if (srcL > TBCX_MAX_STR) {
+            R_Error(r, "tbcx: LPString too large");
             return 0;
+        }
+        H->sourcePath = NULL;
         if (srcL > 0) {
+            char *srcP = (char *)Tcl_AttemptAlloc(srcL);
+            if (!srcP) {
+                R_Error(r, "tbcx: allocation failed (LPString)");
+                return 0;
+            }
+            if (!Tbcx_R_Bytes(r, srcP, (Tcl_Size)srcL)) {
+                Tcl_Free(srcP);
+                return 0;
+            }
             H->sourcePath = Tcl_NewStringObj(srcP, (Tcl_Size)srcL);
             Tcl_IncrRefCount(H->sourcePath);
-        } else {
-            H->sourcePath = NULL;
+            Tcl_Free(srcP);
         }
-        Tcl_Free(srcP);
     }
 
     if (H->magic != TBCX_MAGIC || H->format != TBCX_FORMAT) {
@@ -5197,75 +6899,206 @@ int Tbcx_ReadHeader(TbcxIn *r, TbcxHeader *H) {
             return 0;
         }
     }
+
+    /* v93 section directory.  Entries must appear in stream order (string
+     * table, top, procs, classes, methods), must not overlap, and — when the whole
+     * artifact is in memory — must lie inside it.  Loaders still read the
+     * sections sequentially and cross-check against these entries. */
+    {
+        unsigned char dc[TBCX_DIR_COUNTS];
+        if (!Tbcx_R_Bytes(r, dc, TBCX_DIR_COUNTS))
+            return 0;
+        H->flags       = Tbcx_GetLe32(dc + 0);
+        H->numProcs    = Tbcx_GetLe32(dc + 4);
+        H->numClasses  = Tbcx_GetLe32(dc + 8);
+        H->numMethods  = Tbcx_GetLe32(dc + 12);
+        H->numSections = Tbcx_GetLe32(dc + 16);
+    }
+    /* Native blocks are only checked against the host ABI when one is
+     * decoded, so tbcx::verify still walks a foreign artifact. */
+    r->native    = (H->flags & TBCX_HDR_FL_NATIVE) != 0;
+    r->nativeAbi = (H->flags & TBCX_HDR_ABI_MASK) >> TBCX_HDR_ABI_SHIFT;
+    r->dedup     = (H->flags & TBCX_HDR_FL_DEDUP) != 0;
+    if (H->numProcs > TBCX_MAX_PROCS || H->numClasses > TBCX_MAX_CLASSES || H->numMethods > TBCX_MAX_METHODS ||
+        (uint64_t)H->numSections != 3u + (uint64_t)H->numProcs + (uint64_t)H->numMethods) {
+        R_Error(r, "tbcx: bad section directory (counts)");
+        return 0;
+    }
+    H->sections = (TbcxSection *)Tcl_AttemptAlloc(sizeof(TbcxSection) * H->numSections);
+    if (!H->sections) {
+        R_Error(r, "tbcx: allocation failed (section directory)");
+        return 0;
+    }
+    /* Entries are decoded a batch at a time: in place from a memory span,
+     * through a stack buffer from a channel. */
+    unsigned char        batch[64u * TBCX_DIR_ENTRY];
+    const unsigned char *ep      = NULL;
+    uint32_t             inBatch = 0;
+    uint64_t             prevEnd = 0;
+    for (uint32_t i = 0; i < H->numSections; i++) {
+        TbcxSection *sp = &H->sections[i];
+        uint32_t     want;
+        if (inBatch == 0) {
+            inBatch = H->numSections - i;
+            if (r->mem) {
+                if (!Tbcx_R_View(r, (size_t)inBatch * TBCX_DIR_ENTRY, &ep))
+                    return 0;
+            } else {
+                if (inBatch > 64u)
+                    inBatch = 64u;
+                if (!Tbcx_R_Bytes(r, batch, (Tcl_Size)inBatch * TBCX_DIR_ENTRY))
+                    return 0;
+                ep = batch;
+            }
+        }
+        if (i == 0)
+            want = TBCX_SEC_STRINGS;
+        else if (i == 1)
+            want = TBCX_SEC_TOP;
+        else if (i <= H->numProcs + 1u)
+            want = TBCX_SEC_PROC;
+        else if (i == H->numProcs + 2u)
+            want = TBCX_SEC_CLASSES;
+        else
+            want = TBCX_SEC_METHOD;
+        sp->kind   = Tbcx_GetLe32(ep + 0);
+        sp->offset = Tbcx_GetLe64(ep + 4);
+        sp->length = Tbcx_GetLe64(ep + 12);
+        sp->crc    = Tbcx_GetLe32(ep + 20);
+        ep += TBCX_DIR_ENTRY;
+        inBatch--;
+        if (sp->kind != want || sp->offset < prevEnd || sp->length > UINT64_MAX - sp->offset) {
+            R_Error(r, "tbcx: bad section directory (entry)");
+            return 0;
+        }
+        prevEnd = sp->offset + sp->length;
+    }
+    H->dataBase = Tbcx_R_Tell(r);
+    if (r->mem && prevEnd > (uint64_t)r->memLen - H->dataBase) {
+        R_Error(r, "tbcx: bad section directory (extends past end of data)");
+        return 0;
+    }
+    return 1;
+}
+
+/* Tbcx_FreeHeader — release what Tbcx_ReadHeader allocated.  Safe on a
+ * zeroed header and on one left behind by a failed read. */
+void Tbcx_FreeHeader(TbcxHeader *H) {
+    if (H->sourcePath) {
+        Tcl_DecrRefCount(H->sourcePath);
+        H->sourcePath = NULL;
+    }
+    if (H->sections) {
+        Tcl_Free((char *)H->sections);
+        H->sections = NULL;
+    }
+    H->numSections = 0;
+}
+
+/* CheckSectionAt — assert that the sequential cursor sits at the start
+ * (atEnd = 0) or end (atEnd = 1) of directory entry idx.  A mismatch means
+ * the directory and the body disagree, which is treated as corruption.
+ * Channel readers also bracket the section's running checksum here. */
+static int CheckSectionAt(TbcxIn *r, const TbcxHeader *H, uint32_t idx, int atEnd) {
+    if (r->err)
+        return 0;
+    const TbcxSection *sp   = &H->sections[idx];
+    uint64_t           want = H->dataBase + sp->offset + (atEnd ? sp->length : 0u);
+    if (Tbcx_R_Tell(r) != want) {
+        R_Error(r, "tbcx: section directory does not match stream layout");
+        return 0;
+    }
+    if (r->crcOn) {
+        if (!atEnd)
+            Tbcx_R_CrcMark(r);
+        else if (!Tbcx_R_CrcCheck(r, H, idx))
+            return 0;
+    }
     return 1;
 }
 
-static int ReadProc(TbcxIn *r, Tcl_Interp *ip, ProcShim *shim, uint32_t procIdx) {
+/* ReadProc — decode one proc record into the ProcShim registry.  With img
+ * set (tbcx::load -lazy) only the name, namespace and args are decoded; the
+ * body is registered as a tbcxLazyBody pointing back into img and the
+ * reader skips to the end of the record via the section directory. */
+static int ReadProc(TbcxIn *r, Tcl_Interp *ip, ProcShim *shim, uint32_t procIdx, const TbcxHeader *H, TbcxImage *img) {
     int      result = TCL_ERROR;
 
-    /* ---- Stage 1: read wire strings ---- */
-    char    *nameC  = NULL;
-    uint32_t nameL  = 0;
-    char    *nsC    = NULL;
-    uint32_t nsL    = 0;
-    char    *argsC  = NULL;
-    uint32_t argsL  = 0;
-
-    if (!Tbcx_R_LPString(r, &nameC, &nameL))
-        goto cleanup_strings;
-    if (!Tbcx_R_LPString(r, &nsC, &nsL))
-        goto cleanup_strings;
-    if (!Tbcx_R_LPString(r, &argsC, &argsL))
-        goto cleanup_strings;
-
-    /* ---- Stage 2: build Tcl_Obj wrappers ---- */
-    Tcl_Obj *nameFqn = Tcl_NewStringObj(nameC, (Tcl_Size)nameL);
+    /* ---- Stages 1-2: resolve string refs ----
+     * The objects are shared with the string table; take our own
+     * references and never modify them in place. */
+    Tcl_Obj *nameFqn = NULL;
+    Tcl_Obj *nsObj   = NULL;
+    Tcl_Obj *argsObj = NULL;
+    if (!Tbcx_R_StrRef(r, &nameFqn) || !Tbcx_R_StrRef(r, &nsObj) || !Tbcx_R_StrRef(r, &argsObj))
+        return TCL_ERROR;
     Tcl_IncrRefCount(nameFqn);
-    Tcl_Obj *nsObj = Tcl_NewStringObj(nsC, (Tcl_Size)nsL);
     Tcl_IncrRefCount(nsObj);
-    Tcl_Obj *argsObj = Tcl_NewStringObj(argsC, (Tcl_Size)argsL);
     Tcl_IncrRefCount(argsObj);
-    /* Wire strings no longer needed */
-    Tcl_Free(nameC);
-    nameC = NULL;
-    Tcl_Free(nsC);
-    nsC = NULL;
-    Tcl_Free(argsC);
-    argsC = NULL;
 
     /* ---- Stage 3: validate ---- */
     {
         Tcl_Size    nsObjLen = 0;
         const char *nsObjStr = Tbcx_GetStringFromObjStrict(ip, nsObj, &nsObjLen);
-        if (!nsObjStr || Tbcx_ValidateKeyString(ip, nsObjStr, nsObjLen, "proc namespace", 1) != TCL_OK)
+        if (!nsObjStr || (!r->trusted && Tbcx_ValidateKeyString(ip, nsObjStr, nsObjLen, "proc namespace", 1) != TCL_OK))
             goto cleanup_objs;
     }
     {
         Tcl_Size    nameObjLen = 0;
         const char *nameObjStr = Tbcx_GetStringFromObjStrict(ip, nameFqn, &nameObjLen);
-        if (!nameObjStr || Tbcx_ValidateKeyString(ip, nameObjStr, nameObjLen, "proc name", 0) != TCL_OK)
+        if (!nameObjStr || (!r->trusted && Tbcx_ValidateKeyString(ip, nameObjStr, nameObjLen, "proc name", 0) != TCL_OK))
             goto cleanup_objs;
     }
 
+    /* ---- Stage 3.2: build FQN key ---- */
+    Tcl_Obj    *fqnKey = NULL;
+    const char *nm     = Tcl_GetString(nameFqn);
+    if (nm[0] == ':' && nm[1] == ':') {
+        fqnKey = nameFqn;
+    } else {
+        Tcl_Size    nsLen = 0;
+        const char *nsStr = Tcl_GetStringFromObj(nsObj, &nsLen);
+        fqnKey            = Tcl_NewStringObj(nsStr, nsLen);
+        if (!(nsLen == 2 && nsStr[0] == ':' && nsStr[1] == ':'))
+            Tcl_AppendToObj(fqnKey, "::", 2);
+        Tcl_AppendObjToObj(fqnKey, nameFqn);
+    }
+    Tcl_IncrRefCount(fqnKey);
+    Tcl_DecrRefCount(nameFqn);
+    nameFqn       = NULL; /* consumed — fqnKey owns the reference */
+
+    Tcl_Obj *bodyBC      = NULL;
+    Tcl_Obj *procBodyObj = NULL;
+    Proc    *procPtr     = NULL;
+    if (img) {
+        /* ---- Lazy: remember where the body lives and skip it ---- */
+        const TbcxSection *sec    = &H->sections[2u + procIdx];
+        uint64_t           srcOff = Tbcx_R_Tell(r);
+        if (!Tbcx_R_Seek(r, H, sec->offset + sec->length))
+            goto cleanup_fqn;
+        procBodyObj = NewLazyBody(img, srcOff, Tbcx_R_Tell(r), nsObj);
+        goto register_pair;
+    }
+
     /* ---- Stage 3.5: body source text ----
-     * Read before the compiled block so we can attach it as the body
-     * Tcl_Obj's string rep without a second allocation.  Length==0
+     * Read before the compiled block, straight into a Tcl_Obj, so it can
+     * become the body Tcl_Obj's string rep without a second allocation.  Length==0
      * indicates the artifact was built without -include-source (the
      * default, matching tclcompiler/tbcload); the loader then
      * installs a diagnostic sentinel so `info body` is loud rather
      * than silently empty. */
-    char    *bodySrc    = NULL;
-    uint32_t bodySrcLen = 0;
-    if (!Tbcx_R_LPString(r, &bodySrc, &bodySrcLen))
-        goto cleanup_objs;
+    Tcl_Obj *bodySrc = Tbcx_R_StringObj(r);
+    if (!bodySrc)
+        goto cleanup_fqn;
+    Tcl_IncrRefCount(bodySrc);
 
     /* ---- Stage 4: read body bytecode ---- */
     Namespace *nsPtr  = (Namespace *)Tbcx_EnsureNamespace(ip, Tcl_GetString(nsObj));
     uint32_t   nLoc   = 0;
-    Tcl_Obj   *bodyBC = Tbcx_ReadBlock(r, ip, nsPtr, &nLoc, 1, 0);
+    bodyBC            = Tbcx_ReadBlock(r, ip, nsPtr, &nLoc, 1, 0);
     if (!bodyBC) {
-        Tcl_Free(bodySrc);
-        goto cleanup_objs;
+        Tcl_DecrRefCount(bodySrc);
+        goto cleanup_fqn;
     }
     Tcl_IncrRefCount(bodyBC); 
 
@@ -5279,39 +7112,24 @@ static int ReadProc(TbcxIn *r, Tcl_Interp *ip, ProcShim *shim, uint32_t procIdx)
      * requested length but does NOT memcpy from src — Tcl treats that
      * call shape as "allocate space, caller will fill it".
      *
-     * We therefore invalidate first (zeroing bytes to NULL), then call
-     * Tcl_InitStringRep which follows the allocate-and-copy branch.
-     * Neither call touches the internal rep. */
-    Tcl_InvalidateStringRep(bodyBC);
-    if (bodySrcLen > 0) {
-        Tcl_InitStringRep(bodyBC, bodySrc, (size_t)bodySrcLen);
+     * For the sentinel we therefore invalidate first (zeroing bytes to
+     * NULL), then call Tcl_InitStringRep which follows the
+     * allocate-and-copy branch.  Authored source needs no copy at all:
+     * the text was decoded straight into bodySrc's rep, which moves over
+     * (AdoptStringRep).  None of this touches the internal rep. */
+    if (bodySrc->length > 0) {
+        AdoptStringRep(bodyBC, bodySrc);
     } else {
+        Tcl_DecrRefCount(bodySrc);
+        Tcl_InvalidateStringRep(bodyBC);
         Tcl_InitStringRep(bodyBC,
             TBCX_STRIPPED_SOURCE_SENTINEL,
             sizeof(TBCX_STRIPPED_SOURCE_SENTINEL) - 1u);
     }
-    Tcl_Free(bodySrc);
     bodySrc = NULL;
 
-    /* ---- Stage 5: build FQN key ---- */
-    Tcl_Obj    *fqnKey = NULL;
-    const char *nm     = Tcl_GetString(nameFqn);
-    if (nm[0] == ':' && nm[1] == ':') {
-        fqnKey = nameFqn;
-    } else {
-        Tcl_Size    nsLen = 0;
-        const char *nsStr = Tcl_GetStringFromObj(nsObj, &nsLen);
-        fqnKey            = Tcl_NewStringObj(nsStr, nsLen);
-        if (!(nsLen == 2 && nsStr[0] == ':' && nsStr[1] == ':'))
-            Tcl_AppendToObj(fqnKey, "::", 2);
-        Tcl_AppendObjToObj(fqnKey, nameFqn);
-    }
-    Tcl_IncrRefCount(fqnKey);
-    Tcl_DecrRefCount(nameFqn);
-    nameFqn       = NULL; /* consumed — fqnKey owns the reference */
-
     /* ---- Stage 6: build Proc ---- */
-    Proc *procPtr = (Proc *)Tcl_Alloc(sizeof(Proc));
+    procPtr = (Proc *)Tcl_Alloc(sizeof(Proc));
     memset(procPtr, 0, sizeof(Proc));
     procPtr->iPtr     = (Interp *)ip;
     procPtr->refCount = 1;
@@ -5341,13 +7159,16 @@ static int ReadProc(TbcxIn *r, Tcl_Interp *ip, ProcShim *shim, uint32_t procIdx)
 
     /* ---- Stage 7: build procbody and register ---- */
     {
-        Tcl_Obj           *procBodyObj = Tcl_NewObj();
         Tcl_ObjInternalRep ir;
+        procBodyObj         = Tcl_NewObj();
         ir.twoPtrValue.ptr1 = procPtr;
         ir.twoPtrValue.ptr2 = NULL;
         Tcl_StoreInternalRep(procBodyObj, tbcxTyProcBody, &ir);
         procPtr->refCount++;
+    }
 
+register_pair:
+    {
         Tcl_Obj *pair = Tcl_NewListObj(0, NULL);
         if (Tcl_ListObjAppendElement(ip, pair, argsObj) != TCL_OK || Tcl_ListObjAppendElement(ip, pair, procBodyObj) != TCL_OK) {
             Tcl_IncrRefCount(pair);
@@ -5357,7 +7178,8 @@ static int ReadProc(TbcxIn *r, Tcl_Interp *ip, ProcShim *shim, uint32_t procIdx)
             /* procBodyObj's freeProc already did procPtr->refCount-- (2→1).
                TclProcCleanupProc does another refCount-- (1→0) and then
                frees locals, bodyPtr, and struct. */
-            TclProcCleanupProc(procPtr);
+            if (procPtr)
+                TclProcCleanupProc(procPtr);
             goto cleanup_fqn;
         }
         Tcl_IncrRefCount(pair);
@@ -5391,13 +7213,6 @@ cleanup_objs:
         Tcl_DecrRefCount(nsObj);
     if (argsObj)
         Tcl_DecrRefCount(argsObj);
-cleanup_strings:
-    if (nameC)
-        Tcl_Free(nameC);
-    if (nsC)
-        Tcl_Free(nsC);
-    if (argsC)
-        Tcl_Free(argsC);
     return result;
 }
 
@@ -5519,8 +7334,25 @@ static void TopLocals_End(Tcl_Interp *ip, TbcxTopFrameSave *sv) {
 }
 
 #define TBCX_MAX_LOAD_DEPTH 8
+#define TBCX_MAX_LOAD_THREADS 64 /* tbcx::load -threads */
 
+/* LoadTbcxStream — channel front end for LoadTbcxReader. */
 static int LoadTbcxStream(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePath) {
+    if (Tbcx_CheckBinaryChan(ip, ch) != TCL_OK)
+        return TCL_ERROR;
+    TbcxIn r;
+    Tbcx_R_Init(&r, ip, ch);
+    return LoadTbcxReader(ip, &r, scriptFilePath, NULL, 0);
+}
+
+/* LoadTbcxReader — decode and evaluate one artifact from a prepared reader
+ * (channel- or memory-backed).  scriptFilePath is the fallback value for
+ * `info script` when the artifact records no source path.  A non-NULL img
+ * selects lazy loading: r must then be a memory reader over img, and proc
+ * bodies keep a reference to img until they are first called.  threads > 0
+ * lets that many workers decode proc and method blocks ahead of the
+ * interp thread (eager memory readers only; see ParDecodeBegin). */
+static int LoadTbcxReader(Tcl_Interp *ip, TbcxIn *r, Tcl_Obj *scriptFilePath, TbcxImage *img, int threads) {
     TbcxInterpState *st = TbcxGetInterpState(ip);
     if (st->loadDepth >= TBCX_MAX_LOAD_DEPTH) {
         Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx::load: reentrancy depth %" TCL_SIZE_MODIFIER "d exceeds limit %d", st->loadDepth, TBCX_MAX_LOAD_DEPTH));
@@ -5528,24 +7360,84 @@ static int LoadTbcxStream(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePat
     }
     st->loadDepth++;
 
-    TbcxIn r;
-    Tbcx_R_Init(&r, ip, ch);
     TbcxHeader H;
-    memset(&H, 0, sizeof(H));  /* zero H.sourcePath for the early-exit path */
+    memset(&H, 0, sizeof(H));  /* zero owned fields for the early-exit path */
 
-    if (Tbcx_CheckBinaryChan(ip, ch) != TCL_OK) {
+    if (!Tbcx_ReadHeader(r, &H) || r->err) {
+        Tbcx_FreeHeader(&H);
         st->loadDepth--;
         return TCL_ERROR;
     }
 
-    if (!Tbcx_ReadHeader(&r, &H) || r.err) {
-        if (H.sourcePath) {
-            Tcl_DecrRefCount(H.sourcePath);
+    /* Back-references seek to the blocks they repeat: a channel reader
+     * takes the rest of an uncompressed artifact into memory first. */
+    unsigned char *inflated = NULL; /* owned copy: slurped or inflated */
+    if (r->dedup && !r->mem && !(H.flags & TBCX_HDR_FL_LZ)) {
+        inflated = Tbcx_R_Slurp(r, &H);
+        if (!inflated) {
+            Tbcx_FreeHeader(&H);
+            st->loadDepth--;
+            return TCL_ERROR;
+        }
+    }
+
+    /* An artifact registered with tbcx::trust (one whole-artifact digest)
+     * needs neither the section checksums nor the shape checks.  Only an
+     * image whose length a registered artifact could have is hashed
+     * (Tbcx_TrustMayMatch); channel readers have no image to hash and keep
+     * the checked path; a cached image is compared through the digest
+     * taken from its file. */
+    if (r->mem && Tbcx_TrustActive()) {
+        unsigned char        digest[TBCX_SHA256_LEN];
+        const unsigned char *hp = r->trustHash;
+        if (!hp && !r->verified && Tbcx_TrustMayMatch(r->memLen)) {
+            Tbcx_Sha256(r->mem, r->memLen, digest);
+            hp = digest;
         }
+        if (hp && Tbcx_TrustLookup(hp))
+            r->trusted = r->verified = 1;
+    }
+
+    /* Section checksums: all of them now for a memory reader, section by
+     * section as they are consumed for a channel reader. */
+    if (!Tbcx_R_VerifySections(r, &H)) {
+        if (inflated)
+            Tcl_Free((char *)inflated);
+        Tbcx_FreeHeader(&H);
         st->loadDepth--;
         return TCL_ERROR;
     }
 
+    /* Compressed artifact: inflate every frame up front; from here on the
+     * reader sees an uncompressed artifact.  A lazy image takes over the
+     * inflated bytes since deferred bodies point into them. */
+    if (H.flags & TBCX_HDR_FL_LZ) {
+        inflated = Tbcx_R_Inflate(r, &H);
+        if (!inflated) {
+            Tbcx_FreeHeader(&H);
+            st->loadDepth--;
+            return TCL_ERROR;
+        }
+        if (img) {
+            ImageAdopt(img, inflated, r->memLen);
+            inflated = NULL;
+        }
+    }
+
+    /* A lazy image that skips the checks (trusted, or validated by an
+     * earlier load) has its deferred bodies decoded long after the digest
+     * or the file identity was taken: they must not come from a mapping
+     * that a rewrite of the file in place can still change. */
+    if (img && (r->trusted || r->checked) && ImageLive(img)) {
+        r->trustHash = NULL;
+        if (!ImageDetach(ip, img)) {
+            Tbcx_FreeHeader(&H);
+            st->loadDepth--;
+            return TCL_ERROR;
+        }
+        r->mem = img->base;
+    }
+
     /* Resolve the namespace where the top-level block should run.
      *
      * Plain-source equivalence: the canonical `moduleLoad`-style wrapper
@@ -5576,15 +7468,66 @@ static int LoadTbcxStream(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePat
     Namespace *curNs   = (Namespace *)Tcl_GetCurrentNamespace(ip);
     uint32_t   dummyNL = 0;
 
-    Tcl_Obj   *topBC   = Tbcx_ReadBlock(&r, ip, curNs, &dummyNL, 1, 0);
+    /* String table first: every record after it refers into it.  Lazy
+     * loads hand a reference to the image so deferred bodies can still
+     * resolve their refs after this frame is gone. */
+    TbcxStrTab *strs = NULL;
+    if (CheckSectionAt(r, &H, 0, 0))
+        strs = Tbcx_ReadStrTab(r);
+    if (strs && !CheckSectionAt(r, &H, 0, 1)) {
+        Tbcx_StrTabRelease(strs);
+        strs = NULL;
+    }
+    if (!strs) {
+        if (inflated)
+            Tcl_Free((char *)inflated);
+        Tbcx_FreeHeader(&H);
+        st->loadDepth--;
+        return TCL_ERROR;
+    }
+    r->strs   = strs;
+    r->intern = st->internOn ? &st->intern : NULL;
+    if (img && !img->strs) {
+        img->strs = strs;
+        strs->refCount++;
+    }
+    if (img) {
+        img->native    = r->native;
+        img->nativeAbi = r->nativeAbi;
+        img->dedup     = r->dedup;
+        img->trusted   = r->trusted;
+        img->checked   = r->checked;
+    }
+    /* Back-reference targets: kept with a lazy image for the bodies decoded
+     * later, dropped at the end of an eager load. */
+    TbcxBlockTab blocks;
+    memset(&blocks, 0, sizeof(blocks));
+    r->blocks = img ? &img->blocks : &blocks;
+    if (!img)
+        r->par = ParDecodeBegin(r, &H, threads);
+
+    Tcl_Obj   *topBC   = NULL;
+    if (CheckSectionAt(r, &H, 1, 0))
+        topBC = Tbcx_ReadBlock(r, ip, curNs, &dummyNL, 1, 0);
+    if (topBC && !CheckSectionAt(r, &H, 1, 1)) {
+        Tcl_IncrRefCount(topBC);
+        Tcl_DecrRefCount(topBC);
+        topBC = NULL;
+    }
     if (!topBC) {
-        /* Release H.sourcePath — it was IncrRefCount'd by Tbcx_ReadHeader
-         * on the success path; without this guard it leaks on every
+        /* Release the header — Tbcx_ReadHeader handed us an owned
+         * sourcePath and directory; without this they leak on every
          * failed load after a successful header read.  The dumper's
          * `cleanup_no_topbc:` label shows the correct pattern. */
-        if (H.sourcePath) {
-            Tcl_DecrRefCount(H.sourcePath);
-        }
+        ParDecodeEnd(r->par);
+        r->par  = NULL;
+        r->strs = NULL;
+        Tbcx_StrTabRelease(strs);
+        if (inflated)
+            Tcl_Free((char *)inflated);
+        r->blocks = NULL;
+        Tbcx_BlockTabFree(&blocks);
+        Tbcx_FreeHeader(&H);
         st->loadDepth--;
         return TCL_ERROR;
     }
@@ -5601,12 +7544,16 @@ static int LoadTbcxStream(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePat
 
     /* Procs */
     uint32_t numProcs = 0;
-    if (!Tbcx_R_U32(&r, &numProcs))
+    if (!Tbcx_R_Var(r, &numProcs))
         goto cleanup;
     if (numProcs > TBCX_MAX_PROCS) {
         Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: numProcs %u exceeds limit %u", numProcs, TBCX_MAX_PROCS));
         goto cleanup;
     }
+    if (numProcs != H.numProcs) {
+        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: section directory does not match stream layout", -1));
+        goto cleanup;
+    }
 
     /* Build proc shim registry and fill from section */
     if (numProcs) {
@@ -5623,27 +7570,25 @@ static int LoadTbcxStream(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePat
     }
 
     for (uint32_t i = 0; i < numProcs; i++) {
-        if (ReadProc(&r, ip, &shim, i) != TCL_OK)
+        if (!CheckSectionAt(r, &H, 2u + i, 0) || ReadProc(r, ip, &shim, i, &H, img) != TCL_OK || !CheckSectionAt(r, &H, 2u + i, 1))
             goto cleanup;
     }
 
     /* Classes section (saver currently emits 0) */
     uint32_t numClasses = 0;
-    if (!Tbcx_R_U32(&r, &numClasses))
+    if (!CheckSectionAt(r, &H, 2u + numProcs, 0) || !Tbcx_R_Var(r, &numClasses))
         goto cleanup;
     if (numClasses > TBCX_MAX_CLASSES) {
         Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: numClasses %u exceeds limit %u", numClasses, TBCX_MAX_CLASSES));
         goto cleanup;
     }
     for (uint32_t c = 0; c < numClasses; c++) {
-        /* classFqn + nSupers + supers… — saver writes 0; ignore here */
-        char    *cls = NULL;
-        uint32_t cl  = 0;
-        if (!Tbcx_R_LPString(&r, &cls, &cl))
+        /* classFqn ref + nSupers + supers… — saver writes 0; ignore here */
+        Tcl_Obj *cls = NULL;
+        if (!Tbcx_R_StrRef(r, &cls))
             goto cleanup;
-        Tcl_Free(cls);
         uint32_t nSup = 0;
-        if (!Tbcx_R_U32(&r, &nSup))
+        if (!Tbcx_R_Var(r, &nSup))
             goto cleanup;
         if (nSup > 1024u) {
             Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: nSuperclasses %u exceeds limit 1024", nSup));
@@ -5652,27 +7597,36 @@ static int LoadTbcxStream(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePat
         for (uint32_t s = 0; s < nSup; s++) {
             char    *su = NULL;
             uint32_t sl = 0;
-            if (!Tbcx_R_LPString(&r, &su, &sl))
+            if (!Tbcx_R_LPString(r, &su, &sl))
                 goto cleanup;
             Tcl_Free(su);
         }
     }
+    if (!CheckSectionAt(r, &H, 2u + numProcs, 1))
+        goto cleanup;
     uint32_t numMethods = 0;
-    if (!Tbcx_R_U32(&r, &numMethods))
+    if (!Tbcx_R_Var(r, &numMethods))
         goto cleanup;
     if (numMethods > TBCX_MAX_METHODS) {
         Tcl_SetObjResult(ip, Tcl_ObjPrintf("tbcx: numMethods %u exceeds limit %u", numMethods, TBCX_MAX_METHODS));
         goto cleanup;
     }
+    if (numClasses != H.numClasses || numMethods != H.numMethods) {
+        Tcl_SetObjResult(ip, Tcl_NewStringObj("tbcx: section directory does not match stream layout", -1));
+        goto cleanup;
+    }
     if (numMethods) {
         if (AddOOShim(ip, &ooshim) != TCL_OK)
             goto cleanup;
         ooshimInited = 1;
     }
     for (uint32_t m = 0; m < numMethods; m++) {
-        if (ReadMethod(&r, ip, &ooshim) != TCL_OK)
+        uint32_t idx = 3u + numProcs + m;
+        if (!CheckSectionAt(r, &H, idx, 0) || ReadMethod(r, ip, &ooshim, m, &H, img) != TCL_OK || !CheckSectionAt(r, &H, idx, 1))
             goto cleanup;
     }
+    ParDecodeEnd(r->par); /* every block is in: join the workers before running anything */
+    r->par = NULL;
 
     /* Execute */
     {
@@ -5765,11 +7719,16 @@ static int LoadTbcxStream(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePat
     }
 
 cleanup:
-    if (H.sourcePath) {
-        Tcl_DecrRefCount(H.sourcePath);
-        H.sourcePath = NULL;
-    }
+    ParDecodeEnd(r->par);
+    r->par = NULL;
+    Tbcx_FreeHeader(&H);
     Tcl_DecrRefCount(topBC);
+    r->blocks = NULL;
+    Tbcx_BlockTabFree(&blocks);
+    r->strs = NULL;
+    Tbcx_StrTabRelease(strs);
+    if (inflated)
+        Tcl_Free((char *)inflated);
     if (ooshimInited)
         DelOOShim(ip, &ooshim);
     if (shimInited)
@@ -5778,11 +7737,185 @@ cleanup:
     return rc;
 }
 
+/* CacheNoteChecked — remember on ce, and for its file, that an eager load
+ * r validated the operands of every block, so later loads of the image or
+ * the file skip the walk.  A trusted load validated nothing; a failed one
+ * may have stopped early. */
+static void CacheNoteChecked(TbcxCached *ce, const TbcxIn *r, int rc) {
+    if (rc == TCL_OK && !r->trusted && !r->checked) {
+        atomic_store_explicit(&ce->checked, 1, memory_order_release);
+        Tbcx_FileNoteChecked(&ce->id);
+    }
+}
+
+/* LoadTbcxLazy — lazy load over an artifact image; consumes the caller's
+ * reference to img (lazily installed bodies hold their own). */
+static int LoadTbcxLazy(Tcl_Interp *ip, TbcxImage *img, Tcl_Obj *scriptFilePath) {
+    TbcxIn r;
+    Tbcx_R_InitMem(&r, ip, img->base, img->len);
+    r.verified  = img->cached != NULL;
+    r.checked   = img->checked || (img->cached && atomic_load_explicit(&img->cached->checked, memory_order_acquire));
+    r.trustHash = img->cached && img->cached->hashed ? img->cached->trustHash : NULL;
+    int rc      = LoadTbcxReader(ip, &r, scriptFilePath, img, 0);
+    ImageRelease(img);
+    return rc;
+}
+
+/* LoadChannelLazy — slurp the rest of ch into an image and load lazily. */
+static int LoadChannelLazy(Tcl_Interp *ip, Tcl_Channel ch, Tcl_Obj *scriptFilePath) {
+    if (Tbcx_CheckBinaryChan(ip, ch) != TCL_OK)
+        return TCL_ERROR;
+    TbcxImage *img = ImageFromChannel(ip, ch);
+    if (!img)
+        return TCL_ERROR;
+    return LoadTbcxLazy(ip, img, scriptFilePath);
+}
+
+/* ZipfsInfoProc — the core's implementation of ::tcl::zipfs::info, read
+ * once per process from a fresh interp, where no script can have replaced
+ * it yet.  NULL when this Tcl has none.  Racing first callers compute the
+ * same value, as TbcxInitTypes does. */
+static Tcl_ObjCmdProc2 *ZipfsInfoProc(void) {
+    static _Atomic(Tcl_ObjCmdProc2 *) infoProc;
+    static _Atomic int                probed;
+    if (!atomic_load_explicit(&probed, memory_order_acquire)) {
+        Tcl_ObjCmdProc2 *found   = NULL;
+        Tcl_Interp      *scratch = Tcl_CreateInterp();
+        Tcl_CmdInfo      ci;
+        if (Tcl_GetCommandInfo(scratch, "::tcl::zipfs::info", &ci))
+            found = ci.objProc2;
+        Tcl_DeleteInterp(scratch);
+        atomic_store_explicit(&infoProc, found, memory_order_relaxed);
+        atomic_store_explicit(&probed, 1, memory_order_release);
+    }
+    return atomic_load_explicit(&infoProc, memory_order_relaxed);
+}
+
+/* MapZipfsMember — map the archive holding the zipfs file pathObj and
+ * point [*pOut, *pOut + *nOut) at its bytes.  Only a stored member whose
+ * bytes start with the artifact magic qualifies: deflated or encrypted
+ * members, and anything zipfs will not describe, return 0 and are read
+ * through a channel as before.  The interp state (result, errorInfo,
+ * errorCode) is left as it was. */
+static int MapZipfsMember(Tcl_Interp *interp, Tcl_Obj *pathObj, TbcxMap *m, const unsigned char **pOut, size_t *nOut) {
+    const Tcl_Filesystem *fs = Tcl_FSGetFileSystemForPath(pathObj);
+    if (!fs || !fs->typeName || strcmp(fs->typeName, "zipfs") != 0)
+        return 0;
+    /* ::tcl::zipfs::info: archive, size, stored size, data offset.  Its
+     * implementation is called directly — no script-level dispatch, so no
+     * traces, and no evaluation a safe interp would refuse.  Only the
+     * core's own implementation is called: where the command is not
+     * visible (hidden in a safe interp) or has been replaced by a proc,
+     * alias or anything else, the member is read through a channel. */
+    Tcl_CmdInfo ci;
+    if (!Tcl_GetCommandInfo(interp, "::tcl::zipfs::info", &ci) || !ci.objProc2 || ci.objProc2 != ZipfsInfoProc())
+        return 0;
+    Tcl_Obj *cmd[2] = {Tcl_NewStringObj("::tcl::zipfs::info", -1), pathObj};
+    Tcl_IncrRefCount(cmd[0]);
+    Tcl_IncrRefCount(pathObj);
+    Tcl_InterpState saved = Tcl_SaveInterpState(interp, TCL_OK);
+    Tcl_ResetResult(interp);
+    int      rc   = ci.objProc2(ci.objClientData2, interp, 2, cmd);
+    Tcl_Obj *info = Tcl_GetObjResult(interp);
+    Tcl_IncrRefCount(info);
+    Tcl_RestoreInterpState(interp, saved);
+    Tcl_DecrRefCount(cmd[0]);
+    Tcl_DecrRefCount(pathObj);
+
+    Tcl_Size    ne;
+    Tcl_Obj   **ev;
+    Tcl_WideInt size, stored, off;
+    int         ok = rc == TCL_OK && Tcl_ListObjGetElements(NULL, info, &ne, &ev) == TCL_OK && ne >= 4 && Tcl_GetWideIntFromObj(NULL, ev[1], &size) == TCL_OK &&
+             Tcl_GetWideIntFromObj(NULL, ev[2], &stored) == TCL_OK && Tcl_GetWideIntFromObj(NULL, ev[3], &off) == TCL_OK && size == stored && size >= 4 && off >= 0 &&
+             Tbcx_MapFile(ev[0], m);
+    Tcl_DecrRefCount(info);
+    if (!ok)
+        return 0;
+    if ((uint64_t)off > (uint64_t)m->len || (uint64_t)size > (uint64_t)m->len - (uint64_t)off || Tbcx_GetLe32(m->base + off) != TBCX_MAGIC) {
+        Tbcx_UnmapFile(m);
+        return 0;
+    }
+    *pOut = m->base + off;
+    *nOut = (size_t)size;
+    return 1;
+}
+
+/* LoadFile — tbcx::load of the readable file inObj: from the artifact
+ * cache, a mapping (of the file, or of the zipfs archive holding it), or a
+ * channel, whichever applies first. */
+static int LoadFile(Tcl_Interp *interp, Tcl_Obj *inObj, int lazy, int threads) {
+    /* With the process-wide cache enabled, a settled artifact comes from
+     * it already verified and inflated: only the decode is left to this
+     * interp. */
+    TbcxCached *ce = Tbcx_CacheGet(interp, inObj);
+    if (ce) {
+        if (lazy)
+            return LoadTbcxLazy(interp, ImageFromCache(ce), inObj);
+        TbcxIn r;
+        Tbcx_R_InitMem(&r, interp, ce->base, ce->len);
+        r.verified  = 1;
+        r.checked   = atomic_load_explicit(&ce->checked, memory_order_acquire);
+        r.trustHash = ce->hashed ? ce->trustHash : NULL;
+        int rc      = LoadTbcxReader(interp, &r, inObj, NULL, threads);
+        CacheNoteChecked(ce, &r, rc);
+        Tbcx_CacheRelease(ce);
+        return rc;
+    }
+    /* Regular native files are decoded straight out of a read-only
+     * mapping: no channel buffering and no staging copy of code bytes
+     * or bytearray literals.  An artifact appended to another file (a
+     * single-file executable) is found through its trailer, and a stored
+     * zipfs member is read in place from its archive.  Anything else
+     * that cannot be mapped (VFS, FIFOs, empty files, deflated members)
+     * takes the channel path below.  The file's identity, taken first and
+     * matched by the mapping's size, keys the validation memo
+     * (Tbcx_FileChecked). */
+    TbcxMap    map;
+    TbcxFileId id;
+    int        haveId = Tbcx_FileId(inObj, &id);
+    if (Tbcx_MapFile(inObj, &map)) {
+        size_t off, n;
+        Tbcx_FindPayload(map.base, map.len, &off, &n);
+        haveId = haveId && (unsigned long long)map.len == id.size;
+        return LoadMapSpan(interp, &map, map.base + off, n, inObj, haveId ? &id : NULL, lazy, threads);
+    }
+    const unsigned char *p;
+    size_t               n;
+    if (MapZipfsMember(interp, inObj, &map, &p, &n))
+        return LoadMapSpan(interp, &map, p, n, inObj, NULL, lazy, threads);
+    Tcl_Channel ch = Tcl_FSOpenFileChannel(interp, inObj, "r", 0);
+    if (!ch) {
+        return TCL_ERROR;
+    }
+    /* File branch: pass the .tbcx path so `info script` inside
+     * the loaded top-level block returns the artifact's path —
+     * matching Tcl_FSEvalFileEx's scriptFile handling (tclIOUtil.c
+     * lines 1806-1807).  This is what `source` does, and any
+     * sourced script that checks `[info script] eq $::argv0` as
+     * a self-invocation guard (standard Tcl idiom) depends on
+     * that value being distinct from the outer script's path. */
+    int rc = lazy ? LoadChannelLazy(interp, ch, inObj) : LoadTbcxStream(interp, ch, inObj);
+    if (Tcl_Close(interp, ch) != TCL_OK) {
+        rc = TCL_ERROR;
+    }
+    return rc;
+}
+
 /* ==========================================================================
  * Tcl command: tbcx::load
  *
- * Synopsis:   tbcx::load in
- * Arguments:  in — input source: an open binary channel name, or a
+ * Synopsis:   tbcx::load ?-lazy? ?-threads n? in
+ * Arguments:  -lazy — install procs with deferred bodies: each proc's
+ *                   compiled block is decoded on its first call instead of
+ *                   up front.  The artifact (mapping, or an in-memory copy
+ *                   for channels and non-mappable files) is retained until
+ *                   the last deferred body has been decoded or deleted.
+ *             -threads n — decode proc and method blocks on up to n worker
+ *                   threads (0 to TBCX_MAX_LOAD_THREADS, default 0) while
+ *                   the interp thread materializes them in artifact order.
+ *                   Only file loads read from a mapping or the artifact
+ *                   cache fan out; channels, and -lazy, load as before.
+ *             in — input source: an open binary channel name, or a
  *                   filesystem path to a .tbcx file.
  * Returns:    The result of evaluating the deserialized top-level bytecode.
  * Errors:     TCL_ERROR on read/parse failure, malformed .tbcx stream,
@@ -5795,12 +7928,38 @@ cleanup:
 
 int Tbcx_LoadObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
     TBCX_CHECK_INTERP_THREAD(interp);
-    if (objc != 2) {
-        Tcl_WrongNumArgs(interp, 1, objv, "in");
+    static const char *const opts[] = {"-lazy", "-threads", NULL};
+    int                      lazy = 0, threads = 0;
+    Tcl_Size                 i    = 1;
+    if (objc < 2) {
+        Tcl_WrongNumArgs(interp, 1, objv, "?-lazy? ?-threads n? in");
+        return TCL_ERROR;
+    }
+    for (; i < objc - 1; i++) {
+        int idx;
+        if (Tcl_GetString(objv[i])[0] != '-')
+            break;
+        if (Tcl_GetIndexFromObj(interp, objv[i], opts, "option", 0, &idx) != TCL_OK)
+            return TCL_ERROR;
+        if (idx == 0) {
+            lazy = 1;
+        } else if (i + 1 >= objc - 1) {
+            break; /* -threads without a count */
+        } else {
+            if (Tcl_GetIntFromObj(interp, objv[++i], &threads) != TCL_OK)
+                return TCL_ERROR;
+            if (threads < 0 || threads > TBCX_MAX_LOAD_THREADS) {
+                Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx::load: -threads must be between 0 and %d", TBCX_MAX_LOAD_THREADS));
+                return TCL_ERROR;
+            }
+        }
+    }
+    if (i != objc - 1) {
+        Tcl_WrongNumArgs(interp, 1, objv, "?-lazy? ?-threads n? in");
         return TCL_ERROR;
     }
 
-    Tcl_Obj    *inObj = objv[1];
+    Tcl_Obj    *inObj = objv[objc - 1];
     Tcl_Channel inCh  = NULL;
 
     if (Tbcx_ProbeOpenChannel(interp, inObj, &inCh)) {
@@ -5808,29 +7967,400 @@ int Tbcx_LoadObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
          * pass NULL so LoadTbcxStream leaves scriptFile alone.  Callers
          * that use an already-open channel typically don't care about
          * `info script` anyway. */
+        if (lazy)
+            return LoadChannelLazy(interp, inCh, NULL);
         return LoadTbcxStream(interp, inCh, NULL);
     }
 
-    if (Tbcx_ProbeReadableFile(interp, inObj)) {
-        Tcl_Channel ch = Tcl_FSOpenFileChannel(interp, inObj, "r", 0);
-        if (!ch) {
+    if (Tbcx_ProbeReadableFile(interp, inObj))
+        return LoadFile(interp, inObj, lazy, threads);
+
+    Tcl_SetObjResult(interp, Tcl_NewStringObj("tbcx::load: input is neither an open channel nor a readable file", -1));
+    Tcl_SetErrorCode(interp, "TBCX", "LOAD", "BADINPUT", NULL);
+    return TCL_ERROR;
+}
+
+/* ==========================================================================
+ * Bulk preload (tbcx::preload)
+ *
+ * A worker coming up loads its artifacts one after another, and every file
+ * costs a map, a checksum pass and (for -compress) an inflate before any
+ * decoding starts.  TbcxPreload runs that part for the whole list on a few
+ * threads, in list order, while the interp thread loads each artifact as
+ * soon as its verified image is ready: I/O and verification of the later
+ * files overlap the decoding and execution of the earlier ones.
+ * ========================================================================== */
+
+/* One artifact of the list. */
+typedef struct TbcxPreloadItem {
+    char        *path;    /* normalized, for the workers */
+    TbcxCached  *ce;      /* verified image, or NULL: load by path (mutex) */
+    int          ready;   /* ce is final (mutex) */
+    Tcl_WideInt  fetchUs; /* time spent producing ce */
+} TbcxPreloadItem;
+
+typedef struct TbcxPreload {
+    Tcl_Mutex        mutex;
+    Tcl_Condition    done;     /* signalled whenever an item becomes ready */
+    TbcxPreloadItem *items;
+    Tcl_Size         numItems;
+    Tcl_Size         nextTask; /* next item a worker claims (mutex) */
+    int              stop;     /* workers claim nothing more (mutex) */
+    Tcl_ThreadId    *workers;
+    int              numWorkers;
+} TbcxPreload;
+
+static Tcl_WideInt PreloadNow(void) {
+    Tcl_Time t;
+    Tcl_GetTime(&t);
+    return (Tcl_WideInt)t.sec * 1000000 + t.usec;
+}
+
+/* PreloadFetch — the verified image of it (Tbcx_CacheFetch), timed.  The
+ * path object is the worker's own and never leaves it. */
+static void PreloadFetch(TbcxPreloadItem *it, TbcxCached **ceOut) {
+    Tcl_WideInt t0      = PreloadNow();
+    Tcl_Obj    *pathObj = Tcl_NewStringObj(it->path, -1);
+    Tcl_IncrRefCount(pathObj);
+    *ceOut = Tbcx_CacheFetch(pathObj);
+    Tcl_DecrRefCount(pathObj);
+    it->fetchUs = PreloadNow() - t0;
+}
+
+static Tcl_ThreadCreateType PreloadWorker(void *cd) {
+    TbcxPreload *pl = (TbcxPreload *)cd;
+    for (;;) {
+        Tcl_MutexLock(&pl->mutex);
+        if (pl->stop || pl->nextTask >= pl->numItems) {
+            Tcl_MutexUnlock(&pl->mutex);
+            break;
+        }
+        TbcxPreloadItem *it = &pl->items[pl->nextTask++];
+        Tcl_MutexUnlock(&pl->mutex);
+
+        TbcxCached *ce = NULL;
+        PreloadFetch(it, &ce);
+
+        Tcl_MutexLock(&pl->mutex);
+        it->ce    = ce;
+        it->ready = 1;
+        Tcl_ConditionNotify(&pl->done);
+        Tcl_MutexUnlock(&pl->mutex);
+    }
+    Tcl_ExitThread(0);
+    TCL_THREAD_CREATE_RETURN;
+}
+
+/* PreloadTake — item k's image, waiting for its worker if need be; with no
+ * workers the interp thread fetches it itself.  Returns the time waited. */
+static Tcl_WideInt PreloadTake(TbcxPreload *pl, Tcl_Size k, TbcxCached **ceOut) {
+    TbcxPreloadItem *it = &pl->items[k];
+    if (pl->numWorkers == 0) {
+        PreloadFetch(it, ceOut);
+        return it->fetchUs;
+    }
+    Tcl_WideInt t0 = PreloadNow();
+    Tcl_MutexLock(&pl->mutex);
+    while (!it->ready)
+        Tcl_ConditionWait(&pl->done, &pl->mutex, NULL);
+    *ceOut = it->ce;
+    it->ce = NULL;
+    Tcl_MutexUnlock(&pl->mutex);
+    return PreloadNow() - t0;
+}
+
+/* PreloadEnd — stop and join the workers and release what was fetched but
+ * never loaded. */
+static void PreloadEnd(TbcxPreload *pl) {
+    Tcl_MutexLock(&pl->mutex);
+    pl->stop = 1;
+    Tcl_MutexUnlock(&pl->mutex);
+    for (int i = 0; i < pl->numWorkers; i++) {
+        int status;
+        Tcl_JoinThread(pl->workers[i], &status);
+    }
+    for (Tcl_Size k = 0; k < pl->numItems; k++) {
+        Tbcx_CacheRelease(pl->items[k].ce);
+        Tcl_Free(pl->items[k].path);
+    }
+    Tcl_MutexFinalize(&pl->mutex);
+    Tcl_ConditionFinalize(&pl->done);
+    Tcl_Free((char *)pl->workers);
+    Tcl_Free((char *)pl->items);
+}
+
+/* ==========================================================================
+ * Tcl command: tbcx::preload
+ *
+ * Synopsis:   tbcx::preload ?-threads n? ?-decode n? pathList
+ * Arguments:  -threads n — map, verify and inflate the artifacts on up to n
+ *                   worker threads (0 to TBCX_MAX_LOAD_THREADS, default 0),
+ *                   in list order, ahead of the interp thread.
+ *             -decode n — decode each artifact's proc and method blocks on
+ *                   up to n workers of its own, as tbcx::load -threads n
+ *                   does (0 to TBCX_MAX_LOAD_THREADS, default 0).
+ *             pathList — .tbcx files, loaded in list order exactly as
+ *                   tbcx::load would, each top-level in the caller's
+ *                   current namespace.
+ * Returns:    A list with one dict per element of pathList, in order: path
+ *             (as given), status (ok or error), wait (µs the interp thread
+ *             waited for the file's image), fetch (µs spent producing it),
+ *             load (µs to decode and run it) and result, the load's result
+ *             or error message.  An artifact that fails does not stop the
+ *             rest.
+ * Errors:     TCL_ERROR on bad arguments, or if the interp is deleted by
+ *             one of the loads.
+ * Thread:     Must be called on the interp-owning thread.  The workers
+ *             only touch files and the artifact cache, through path
+ *             objects of their own; every object a load sees is made on
+ *             the interp thread.
+ * ========================================================================== */
+
+int Tbcx_PreloadObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_CHECK_INTERP_THREAD(interp);
+    static const char *const opts[] = {"-decode", "-threads", NULL};
+    enum { OPT_DECODE, OPT_THREADS };
+    int      threads = 0, decode = 0;
+    Tcl_Size i       = 1;
+    for (; i < objc - 1; i += 2) {
+        int idx;
+        if (Tcl_GetIndexFromObj(interp, objv[i], opts, "option", 0, &idx) != TCL_OK)
+            return TCL_ERROR;
+        if (i + 1 >= objc - 1)
+            break; /* an option without its count */
+        int *valp = idx == OPT_DECODE ? &decode : &threads;
+        if (Tcl_GetIntFromObj(interp, objv[i + 1], valp) != TCL_OK)
+            return TCL_ERROR;
+        if (*valp < 0 || *valp > TBCX_MAX_LOAD_THREADS) {
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx::preload: %s must be between 0 and %d", opts[idx], TBCX_MAX_LOAD_THREADS));
             return TCL_ERROR;
         }
-        /* File branch: pass the .tbcx path so `info script` inside
-         * the loaded top-level block returns the artifact's path —
-         * matching Tcl_FSEvalFileEx's scriptFile handling (tclIOUtil.c
-         * lines 1806-1807).  This is what `source` does, and any
-         * sourced script that checks `[info script] eq $::argv0` as
-         * a self-invocation guard (standard Tcl idiom) depends on
-         * that value being distinct from the outer script's path. */
-        int rc = LoadTbcxStream(interp, ch, inObj);
-        if (Tcl_Close(interp, ch) != TCL_OK) {
+    }
+    if (objc < 2 || i != objc - 1) {
+        Tcl_WrongNumArgs(interp, 1, objv, "?-threads n? ?-decode n? pathList");
+        return TCL_ERROR;
+    }
+    /* Pin the list: the loads run arbitrary scripts. */
+    Tcl_Obj *listObj = Tcl_DuplicateObj(objv[objc - 1]);
+    Tcl_IncrRefCount(listObj);
+    Tcl_Size  n;
+    Tcl_Obj **paths;
+    if (Tcl_ListObjGetElements(interp, listObj, &n, &paths) != TCL_OK) {
+        Tcl_DecrRefCount(listObj);
+        return TCL_ERROR;
+    }
+
+    TbcxPreload pl;
+    memset(&pl, 0, sizeof(pl));
+    pl.numItems = n;
+    pl.items    = (TbcxPreloadItem *)Tcl_Alloc(sizeof(TbcxPreloadItem) * (size_t)(n ? n : 1));
+    memset(pl.items, 0, sizeof(TbcxPreloadItem) * (size_t)(n ? n : 1));
+    for (Tcl_Size k = 0; k < n; k++) {
+        Tcl_Obj    *norm = Tcl_FSGetNormalizedPath(NULL, paths[k]);
+        Tcl_Size    len;
+        const char *s    = Tcl_GetStringFromObj(norm ? norm : paths[k], &len);
+        pl.items[k].path = (char *)Tcl_Alloc((size_t)len + 1);
+        memcpy(pl.items[k].path, s, (size_t)len + 1);
+    }
+    int want   = (Tcl_Size)threads < n ? threads : (int)n;
+    pl.workers = (Tcl_ThreadId *)Tcl_Alloc(sizeof(Tcl_ThreadId) * (size_t)(want ? want : 1));
+    for (int w = 0; w < want; w++) {
+        if (Tcl_CreateThread(&pl.workers[pl.numWorkers], PreloadWorker, &pl, TCL_THREAD_STACK_DEFAULT, TCL_THREAD_JOINABLE) != TCL_OK)
+            break;
+        pl.numWorkers++;
+    }
+
+    Tcl_Obj *report = Tcl_NewListObj(0, NULL);
+    Tcl_IncrRefCount(report);
+    int rc = TCL_OK;
+    for (Tcl_Size k = 0; k < n; k++) {
+        TbcxCached *ce     = NULL;
+        Tcl_WideInt waitUs = PreloadTake(&pl, k, &ce);
+        Tcl_WideInt t0     = PreloadNow();
+        int         lrc;
+        if (ce) {
+            TbcxIn r;
+            Tbcx_R_InitMem(&r, interp, ce->base, ce->len);
+            r.verified  = 1;
+            r.checked   = atomic_load_explicit(&ce->checked, memory_order_acquire);
+            r.trustHash = ce->hashed ? ce->trustHash : NULL;
+            lrc         = LoadTbcxReader(interp, &r, paths[k], NULL, decode);
+            CacheNoteChecked(ce, &r, lrc);
+            Tbcx_CacheRelease(ce);
+        } else if (Tbcx_ProbeReadableFile(interp, paths[k])) {
+            lrc = LoadFile(interp, paths[k], 0, decode); /* unmappable, or damaged: let it report */
+        } else {
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx::preload: cannot read \"%s\"", Tcl_GetString(paths[k])));
+            lrc = TCL_ERROR;
+        }
+        Tcl_WideInt loadUs = PreloadNow() - t0;
+        if (Tcl_InterpDeleted(interp)) {
+            Tcl_SetObjResult(interp, Tcl_NewStringObj("tbcx::preload: interpreter deleted during load", -1));
             rc = TCL_ERROR;
+            break;
         }
-        return rc;
+
+        Tcl_Obj *ent = Tcl_NewDictObj();
+        Tcl_DictObjPut(NULL, ent, Tcl_NewStringObj("path", -1), paths[k]);
+        Tcl_DictObjPut(NULL, ent, Tcl_NewStringObj("status", -1), Tcl_NewStringObj(lrc == TCL_ERROR ? "error" : "ok", -1));
+        Tcl_DictObjPut(NULL, ent, Tcl_NewStringObj("wait", -1), Tcl_NewWideIntObj(waitUs));
+        Tcl_DictObjPut(NULL, ent, Tcl_NewStringObj("fetch", -1), Tcl_NewWideIntObj(pl.items[k].fetchUs));
+        Tcl_DictObjPut(NULL, ent, Tcl_NewStringObj("load", -1), Tcl_NewWideIntObj(loadUs));
+        Tcl_DictObjPut(NULL, ent, Tcl_NewStringObj("result", -1), Tcl_GetObjResult(interp));
+        Tcl_ListObjAppendElement(NULL, report, ent);
+        Tcl_ResetResult(interp);
     }
 
-    Tcl_SetObjResult(interp, Tcl_NewStringObj("tbcx::load: input is neither an open channel nor a readable file", -1));
-    Tcl_SetErrorCode(interp, "TBCX", "LOAD", "BADINPUT", NULL);
-    return TCL_ERROR;
+    PreloadEnd(&pl);
+    Tcl_DecrRefCount(listObj);
+    if (rc == TCL_OK)
+        Tcl_SetObjResult(interp, report);
+    Tcl_DecrRefCount(report);
+    return rc;
+}
+
+/* ==========================================================================
+ * Tcl command: tbcx::loadbytes
+ *
+ * Synopsis:   tbcx::loadbytes ?-lazy? bytes
+ * Arguments:  -lazy — as for tbcx::load; the deferred bodies decode from a
+ *                     private copy of bytes, so the value may change or be
+ *                     freed after the call.
+ *             bytes — a byte array holding a complete .tbcx artifact (e.g.
+ *                     the result of [tbcx::save in -tobytes], or a value
+ *                     fetched from an artifact store or tsv).
+ * Returns:    The result of evaluating the deserialized top-level bytecode.
+ * Errors:     As tbcx::load.  A value that is not a byte array (contains
+ *             code points above 255) is rejected.
+ * Thread:     Must be called on the interp-owning thread.  Same shimming
+ *             behavior as tbcx::load.  `info script` is left unchanged
+ *             unless the artifact records an authored source path.
+ * ========================================================================== */
+
+int Tbcx_LoadBytesObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_CHECK_INTERP_THREAD(interp);
+    int lazy = (objc == 3 && strcmp(Tcl_GetString(objv[1]), "-lazy") == 0);
+    if (objc != 2 && !lazy) {
+        Tcl_WrongNumArgs(interp, 1, objv, "?-lazy? bytes");
+        return TCL_ERROR;
+    }
+
+    /* Pin the value: the whole artifact is decoded before the top-level
+     * block runs, but the script could still rebind the variable that
+     * held it, and the span must stay live for the duration. */
+    Tcl_Obj *bytesObj = objv[objc - 1];
+    Tcl_IncrRefCount(bytesObj);
+    Tcl_Size             n = 0;
+    const unsigned char *p = Tbcx_GetByteArrayFromObjStrict(interp, bytesObj, &n);
+    if (!p) {
+        Tcl_DecrRefCount(bytesObj);
+        Tcl_SetErrorCode(interp, "TBCX", "LOAD", "BADINPUT", NULL);
+        return TCL_ERROR;
+    }
+    int rc;
+    if (lazy) {
+        TbcxImage *img = ImageCopy(interp, p, (size_t)n);
+        rc             = img ? LoadTbcxLazy(interp, img, NULL) : TCL_ERROR;
+    } else {
+        TbcxIn r;
+        Tbcx_R_InitMem(&r, interp, p, (size_t)n);
+        rc = LoadTbcxReader(interp, &r, NULL, NULL, 0);
+    }
+    Tcl_DecrRefCount(bytesObj);
+    return rc;
+}
+
+/* LoadMapSpan — load the artifact at [p, p + n).  With m non-NULL the span
+ * lies inside that mapping and the call consumes it: it is unmapped on
+ * return, or kept by the image of a lazy load for as long as deferred
+ * bodies need it (on Windows the image copies the span instead).  With m NULL the span is the caller's and a lazy load
+ * takes a private copy.  id, when known, is the identity of the file the
+ * span is: its validation memo is consulted, and an eager load adds to it. */
+static int LoadMapSpan(Tcl_Interp *ip, TbcxMap *m, const unsigned char *p, size_t n, Tcl_Obj *scriptFilePath, const TbcxFileId *id, int lazy, int threads) {
+    int checked = id && Tbcx_FileChecked(id);
+    if (lazy) {
+        TbcxImage *img = NULL;
+#ifdef _WIN32
+        /* A view held until the last deferred body is called would block
+         * deleting or renaming over the file (tbcx::save to the same path
+         * among them), so a lazy image keeps a copy here instead. */
+        img = ImageCopy(ip, p, n);
+        if (m)
+            Tbcx_UnmapFile(m);
+        if (!img)
+            return TCL_ERROR;
+#else
+        if (m) {
+            img       = ImageFromMap(m);
+            img->base = p;
+            img->len  = n;
+        } else {
+            img = ImageCopy(ip, p, n);
+            if (!img)
+                return TCL_ERROR;
+        }
+#endif
+        img->checked = checked;
+        return LoadTbcxLazy(ip, img, scriptFilePath);
+    }
+    TbcxIn r;
+    Tbcx_R_InitMem(&r, ip, p, n);
+    r.checked = checked;
+    int rc    = LoadTbcxReader(ip, &r, scriptFilePath, NULL, threads);
+    if (m)
+        Tbcx_UnmapFile(m);
+    if (id && rc == TCL_OK && !r.trusted && !r.checked)
+        Tbcx_FileNoteChecked(id);
+    return rc;
+}
+
+/* Tbcx_LoadSpan — LoadMapSpan for one member of a bundle (tbcxbundle.c). */
+int Tbcx_LoadSpan(Tcl_Interp *ip, TbcxMap *m, const unsigned char *p, size_t n, Tcl_Obj *scriptFilePath, int lazy) {
+    return LoadMapSpan(ip, m, p, n, scriptFilePath, NULL, lazy, 0);
+}
+
+/* ==========================================================================
+ * Tcl command: tbcx::intern
+ *
+ * Synopsis:   tbcx::intern ?enable?
+ * Arguments:  enable — boolean.  On: every literal-pool entry decoded from
+ *                      here on (eager, lazy and bundle loads alike) whose
+ *                      value is a string, number, boolean, or a list or
+ *                      dict of those, is shared with every other loaded
+ *                      literal of the same string rep; plain strings only
+ *                      within one namespace.  Off: releases the table;
+ *                      loaded code keeps what it shares.
+ * Returns:    A dict: enabled (0|1) and literals (objects in the table).
+ * Errors:     A non-boolean enable; disabling from inside a tbcx::load.
+ * Thread:     Must be called on the interp-owning thread.  The table is
+ *             per interp.
+ * ========================================================================== */
+
+int Tbcx_InternObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_CHECK_INTERP_THREAD(interp);
+    if (objc > 2) {
+        Tcl_WrongNumArgs(interp, 1, objv, "?enable?");
+        return TCL_ERROR;
+    }
+    TbcxInterpState *st = TbcxGetInterpState(interp);
+    if (objc == 2) {
+        int on = 0;
+        if (Tcl_GetBooleanFromObj(interp, objv[1], &on) != TCL_OK)
+            return TCL_ERROR;
+        if (on && !st->internOn) {
+            Tcl_InitHashTable(&st->intern, TCL_STRING_KEYS);
+            st->internOn = 1;
+        } else if (!on && st->internOn) {
+            if (st->loadDepth > 0) {
+                Tcl_SetObjResult(interp, Tcl_NewStringObj("tbcx::intern: cannot disable during tbcx::load", -1));
+                return TCL_ERROR;
+            }
+            InternRelease(st);
+        }
+    }
+    Tcl_Obj *res = Tcl_NewDictObj();
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("enabled", -1), Tcl_NewBooleanObj(st->internOn));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("literals", -1), Tcl_NewWideIntObj(st->internOn ? (Tcl_WideInt)st->intern.numEntries : 0));
+    Tcl_SetObjResult(interp, res);
+    return TCL_OK;
 }
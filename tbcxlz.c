@@ -0,0 +1,184 @@
+/* ==========================================================================
+ * tbcxlz.c — Section codec for compressed .tbcx artifacts (Tcl 9.1)
+ *
+ * A byte-oriented LZ77 in the LZ4 block layout: each sequence is a token
+ * byte (high nibble literal count, low nibble match length - 4), optional
+ * 255-run length extensions, the literals, a 16-bit little-endian back
+ * offset and optional match length extensions.  The final sequence carries
+ * literals only.  No entropy stage: decoding is a copy loop, which is what
+ * makes a compressed cold load cheaper than reading the raw bytes.
+ *
+ * The decoder trusts nothing: every length, offset and copy is bounds
+ * checked against both buffers, and the output must come out at exactly
+ * the size the frame header promised.
+ * ========================================================================== */
+
+#include "tbcx.h"
+
+#define LZ_MINMATCH 4u
+#define LZ_LASTLITERALS 5u  /* the last bytes of a block are always literals */
+#define LZ_MFLIMIT 12u      /* no match may start this close to the end */
+#define LZ_MAXOFFSET 65535u
+#define LZ_HASHLOG 12u
+
+/* ==========================================================================
+ * Encoder
+ * ========================================================================== */
+
+static inline uint32_t LzRead32(const unsigned char *p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline uint32_t LzHash(uint32_t v) {
+    return (v * 2654435761u) >> (32u - LZ_HASHLOG);
+}
+
+/* Append a run-length extension for len (already reduced by 15). */
+static inline unsigned char *LzPutLen(unsigned char *op, size_t len) {
+    while (len >= 255u) {
+        *op++ = 255u;
+        len -= 255u;
+    }
+    *op++ = (unsigned char)len;
+    return op;
+}
+
+/* Tbcx_LzBound — worst-case compressed size for n input bytes. */
+size_t Tbcx_LzBound(size_t n) {
+    return n + n / 255u + 16u;
+}
+
+/* Tbcx_LzCompress — greedy single-probe compressor.  Returns the packed
+ * size, or 0 when the result would not fit in cap (callers then store the
+ * section raw). */
+size_t Tbcx_LzCompress(const unsigned char *src, size_t n, unsigned char *dst, size_t cap) {
+    if (cap < Tbcx_LzBound(n))
+        return 0;
+    uint32_t             table[1u << LZ_HASHLOG];
+    const unsigned char *ip     = src;
+    const unsigned char *anchor = src;
+    const unsigned char *iend   = src + n;
+    unsigned char       *op     = dst;
+
+    memset(table, 0, sizeof(table));
+    if (n >= LZ_MFLIMIT + 1u) {
+        const unsigned char *mflimit = iend - LZ_MFLIMIT;
+        const unsigned char *mlimit  = iend - LZ_LASTLITERALS;
+        ip++;
+        while (ip < mflimit) {
+            uint32_t             seq = LzRead32(ip);
+            uint32_t             h   = LzHash(seq);
+            const unsigned char *ref = src + table[h];
+            table[h]                 = (uint32_t)(ip - src);
+            if (ref >= ip || (size_t)(ip - ref) > LZ_MAXOFFSET || LzRead32(ref) != seq) {
+                ip++;
+                continue;
+            }
+            /* extend backwards over pending literals */
+            while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+                ip--;
+                ref--;
+            }
+            const unsigned char *mp = ip + LZ_MINMATCH;
+            const unsigned char *rp = ref + LZ_MINMATCH;
+            while (mp < mlimit && *mp == *rp) {
+                mp++;
+                rp++;
+            }
+            size_t         litLen   = (size_t)(ip - anchor);
+            size_t         matchLen = (size_t)(mp - ip) - LZ_MINMATCH;
+            unsigned char *token    = op++;
+            *token = (unsigned char)(((litLen >= 15u) ? 15u : litLen) << 4);
+            if (litLen >= 15u)
+                op = LzPutLen(op, litLen - 15u);
+            memcpy(op, anchor, litLen);
+            op += litLen;
+            uint16_t off = (uint16_t)(ip - ref);
+            *op++        = (unsigned char)(off & 0xFFu);
+            *op++        = (unsigned char)(off >> 8);
+            *token |= (unsigned char)((matchLen >= 15u) ? 15u : matchLen);
+            if (matchLen >= 15u)
+                op = LzPutLen(op, matchLen - 15u);
+            ip     = mp;
+            anchor = ip;
+            if (ip < mflimit)
+                table[LzHash(LzRead32(ip - 2))] = (uint32_t)(ip - 2 - src);
+        }
+    }
+    /* trailing literals */
+    size_t litLen = (size_t)(iend - anchor);
+    *op++         = (unsigned char)(((litLen >= 15u) ? 15u : litLen) << 4);
+    if (litLen >= 15u)
+        op = LzPutLen(op, litLen - 15u);
+    memcpy(op, anchor, litLen);
+    op += litLen;
+    return (size_t)(op - dst);
+}
+
+/* ==========================================================================
+ * Decoder
+ * ========================================================================== */
+
+/* Read a run-length extension; 0 on truncation or a length that could not
+ * fit any buffer. */
+static inline int LzGetLen(const unsigned char **pp, const unsigned char *end, size_t *len) {
+    const unsigned char *p = *pp;
+    unsigned             b;
+    do {
+        if (p >= end || *len > TBCX_MAX_IMAGE)
+            return 0;
+        b = *p++;
+        *len += b;
+    } while (b == 255u);
+    *pp = p;
+    return 1;
+}
+
+/* Tbcx_LzDecompress — decode [src, src + n) into exactly rawLen bytes at
+ * dst.  Returns 1 on success, 0 on any malformed or inconsistent input. */
+int Tbcx_LzDecompress(const unsigned char *src, size_t n, unsigned char *dst, size_t rawLen) {
+    const unsigned char *ip   = src;
+    const unsigned char *iend = src + n;
+    unsigned char       *op   = dst;
+    unsigned char       *oend = dst + rawLen;
+
+    for (;;) {
+        if (ip >= iend)
+            return 0;
+        unsigned token  = *ip++;
+        size_t   litLen = token >> 4;
+        if (litLen == 15u && !LzGetLen(&ip, iend, &litLen))
+            return 0;
+        if (litLen > (size_t)(iend - ip) || litLen > (size_t)(oend - op))
+            return 0;
+        memcpy(op, ip, litLen);
+        ip += litLen;
+        op += litLen;
+        if (ip == iend)
+            return op == oend; /* last sequence: literals only */
+
+        if ((size_t)(iend - ip) < 2u)
+            return 0;
+        size_t off = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (off == 0 || off > (size_t)(op - dst))
+            return 0;
+        size_t matchLen = token & 15u;
+        if (matchLen == 15u && !LzGetLen(&ip, iend, &matchLen))
+            return 0;
+        matchLen += LZ_MINMATCH;
+        if (matchLen > (size_t)(oend - op))
+            return 0;
+        const unsigned char *ref = op - off;
+        if (off >= matchLen) {
+            memcpy(op, ref, matchLen);
+            op += matchLen;
+        } else {
+            /* overlapping run: byte-wise so the pattern repeats */
+            while (matchLen--)
+                *op++ = *ref++;
+        }
+    }
+}
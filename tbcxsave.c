@@ -17,6 +17,15 @@ TCL_DECLARE_MUTEX(tbcxSaveTmpMutex);
  * Type definitions
  * ========================================================================== */
 
+/* One outermost block already staged (see BlockDedup). */
+typedef struct {
+    uint64_t   start; /* staging offset of its first byte */
+    size_t     len;
+    Namespace *nsPtr;
+    uint32_t   crc;
+    size_t     next; /* older record with the same fingerprint, + 1 */
+} TbcxBlockRec;
+
 typedef struct TbcxCtx {
     Tcl_Interp   *interp;
     Tcl_HashTable stripBodies;
@@ -67,6 +76,14 @@ typedef struct TbcxCtx {
      * as an LPString so the loader can set iPtr->scriptFile to match
      * what `source` would have done.  NULL when no path is available. */
     Tcl_Obj      *sourcePath;
+    /* Outermost blocks staged so far, so that a repeat can be written as a
+     * back-reference (TBCX_HDR_FL_DEDUP).  blockIndex maps a fingerprint to
+     * its newest record (index + 1); older ones chain through `next`. */
+    Tcl_HashTable blockIndex; /* ONE_WORD_KEYS: fingerprint -> index + 1 */
+    int           blockIndexInit;
+    TbcxBlockRec *blockRecs;
+    size_t        numBlockRecs, capBlockRecs;
+    uint32_t      numBlockRefs; /* back-references written */
 } TbcxCtx;
 
 typedef struct {
@@ -145,6 +162,7 @@ static int                     CmpJTEntryUtf8_qsort(const void *pa, const void *
 static int                     CmpJTNumEntry_qsort(const void *pa, const void *pb);
 static int                     CmpStrPtr_qsort(const void *pa, const void *pb);
 static int                     CompileProcLike(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *nsFQN, Tcl_Obj *argsList, Tcl_Obj *bodyObj, const char *whereTag);
+static uint32_t                BlockNumLocals(ByteCode *bc);
 static uint32_t                ComputeNumLocals(ByteCode *bc);
 static void                    CS_Add(ClsSet *cs, Tcl_Obj *clsFqn);
 static void                    CS_Free(ClsSet *cs);
@@ -180,6 +198,7 @@ static void                    Lit_List(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *o);
 static inline const Tcl_Token *NextWord(const Tcl_Token *wordTok);
 static Tcl_Obj                *NsFqn(Tcl_Namespace *nsPtr);
 static int                     ReadAllFromChannel(Tcl_Interp *interp, Tcl_Channel ch, Tcl_Obj **outObjPtr);
+static int                     ReadScriptFile(Tcl_Interp *interp, Tcl_Obj *pathObj, Tcl_Obj **scriptOut, Tcl_Obj **sourcePathOut);
 static Tcl_Obj                *ResolveToBytecodeObj(Tcl_Obj *cand);
 static int                     ShouldStripBody(TbcxCtx *ctx, Tcl_Obj *obj);
 static Tcl_Obj                *StubbedBuilderBody(Tcl_Interp *ip, Tcl_Obj *bodyObj);
@@ -188,16 +207,22 @@ int                            Tbcx_SaveObjCmd(TCL_UNUSED(void *), Tcl_Interp *i
 static inline void             W_Bytes(TbcxOut *w, const void *p, size_t n);
 static inline void             W_Error(TbcxOut *w, const char *msg);
 static inline void             W_LPString(TbcxOut *w, const char *s, Tcl_Size n);
-static inline void             W_U32(TbcxOut *w, uint32_t v);
+static inline uint64_t         W_Pos(const TbcxOut *w);
+static inline void             W_Var(TbcxOut *w, uint32_t v);
 static inline void             W_U64(TbcxOut *w, uint64_t v);
 static inline void             W_U8(TbcxOut *w, uint8_t v);
+static void                    W_VarArray(TbcxOut *w, const uint32_t *v, size_t n);
 static Tcl_Obj                *WordLiteralObj(const Tcl_Token *wordTok);
 static void                    WriteAux_DictUpdate(TbcxOut *w, AuxData *ad);
 static void                    WriteAux_Foreach(TbcxOut *w, AuxData *ad);
 static void                    WriteAux_JTNum(TbcxOut *w, AuxData *ad);
 static void                    WriteAux_JTStr(TbcxOut *w, AuxData *ad);
+static void                    WriteBlockBody(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj);
 static void                    WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj);
 static void                    WriteHeaderTop(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *topObj);
+static void                    WriteSectionDirectory(TbcxOut *w, const TbcxHeader *H);
+static void                    WriteExceptionsNative(TbcxOut *w, ByteCode *bc);
+static void                    WriteCompressedSections(TbcxOut *out, TbcxHeader *H, const unsigned char *strTab, size_t strLen, const unsigned char *data);
 static void                    WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj);
 static void                    WriteLocalNames(TbcxOut *w, ByteCode *bc, uint32_t numLocals);
 
@@ -241,13 +266,54 @@ void Tbcx_W_Init(TbcxOut *w, Tcl_Interp *ip, Tcl_Channel ch) {
     w->interp     = ip;
     w->chan       = ch;
     w->err        = TCL_OK;
+    w->toMem      = 0;
+    w->mem        = NULL;
+    w->memLen     = 0;
+    w->memCap     = 0;
     w->bufPos     = 0;
     w->totalBytes = 0;
+    w->strs       = NULL;
+}
+
+/* Tbcx_W_InitMem — writer that accumulates the artifact in memory.  After
+ * the final flush the bytes are in w->mem[0 .. memLen); release them with
+ * Tbcx_W_FreeMem.  Output limits are the same as for channels. */
+void Tbcx_W_InitMem(TbcxOut *w, Tcl_Interp *ip) {
+    Tbcx_W_Init(w, ip, NULL);
+    w->toMem = 1;
+}
+
+void Tbcx_W_FreeMem(TbcxOut *w) {
+    if (w->mem)
+        Tcl_Free((char *)w->mem);
+    w->mem    = NULL;
+    w->memLen = 0;
+    w->memCap = 0;
 }
 
 int Tbcx_W_Flush(TbcxOut *w) {
     if (w->err || w->bufPos == 0)
         return w->err;
+    if (w->toMem) {
+        size_t need = w->memLen + (size_t)w->bufPos;
+        if (need > w->memCap) {
+            size_t cap = w->memCap ? w->memCap : TBCX_BUFSIZE;
+            while (cap < need)
+                cap *= 2;
+            unsigned char *grown = (unsigned char *)Tcl_AttemptRealloc((char *)w->mem, cap);
+            if (!grown) {
+                W_Error(w, "tbcx: allocation failed (output buffer)");
+                return w->err;
+            }
+            w->mem    = grown;
+            w->memCap = cap;
+        }
+        memcpy(w->mem + w->memLen, w->buf, (size_t)w->bufPos);
+        w->memLen += (size_t)w->bufPos;
+        w->totalBytes += w->bufPos;
+        w->bufPos = 0;
+        return w->err;
+    }
     Tcl_Size off = 0;
     while (off < w->bufPos) {
         Tcl_Size toWrite = w->bufPos - off;
@@ -298,18 +364,54 @@ static inline void W_U8(TbcxOut *w, uint8_t v) {
     W_Bytes(w, &v, 1);
 }
 
-static inline void W_U32(TbcxOut *w, uint32_t v) {
-    if (!atomic_load_explicit(&tbcxHostIsLE, memory_order_relaxed)) {
-        v = ((v & 0xFF) << 24) | ((v & 0xFF00) << 8) | ((v >> 8) & 0xFF00) | (v >> 24);
+/* W_Var — write v as a varint (unsigned LEB128, see tbcx.h). */
+static inline void W_Var(TbcxOut *w, uint32_t v) {
+    unsigned char b[TBCX_VAR_MAX];
+    size_t        n = 0;
+    while (v >= 0x80u) {
+        b[n++] = (unsigned char)(v | 0x80u);
+        v >>= 7;
     }
-    W_Bytes(w, &v, 4);
+    b[n++] = (unsigned char)v;
+    W_Bytes(w, b, n);
 }
-static inline void W_U64(TbcxOut *w, uint64_t v) {
-    if (!atomic_load_explicit(&tbcxHostIsLE, memory_order_relaxed)) {
-        v = ((v & 0x00000000000000FFull) << 56) | ((v & 0x000000000000FF00ull) << 40) | ((v & 0x0000000000FF0000ull) << 24) | ((v & 0x00000000FF000000ull) << 8) | ((v & 0x000000FF00000000ull) >> 8) |
-            ((v & 0x0000FF0000000000ull) >> 24) | ((v & 0x00FF000000000000ull) >> 40) | ((v & 0xFF00000000000000ull) >> 56);
+
+/* W_VarArray — write n varints, encoding straight into the output buffer
+ * a batch at a time rather than through W_Bytes once per value. */
+static void W_VarArray(TbcxOut *w, const uint32_t *v, size_t n) {
+    while (n && !w->err) {
+        size_t room = TBCX_BUFSIZE - w->bufPos;
+        if (room < TBCX_VAR_MAX) {
+            Tbcx_W_Flush(w);
+            continue;
+        }
+        size_t k = room / TBCX_VAR_MAX;
+        if (k > n)
+            k = n;
+        w->bufPos += Tbcx_EncodeVars(w->buf + w->bufPos, v, k);
+        if (w->totalBytes + w->bufPos > TBCX_MAX_OUTPUT_BYTES) {
+            W_Error(w, "tbcx: output too large");
+            return;
+        }
+        v += k;
+        n -= k;
+    }
+}
+
+/* VarLen — encoded size of v as a varint. */
+static inline uint32_t VarLen(uint32_t v) {
+    uint32_t n = 1;
+    while (v >= 0x80u) {
+        v >>= 7;
+        n++;
     }
-    W_Bytes(w, &v, 8);
+    return n;
+}
+
+static inline void W_U64(TbcxOut *w, uint64_t v) {
+    unsigned char b[8];
+    Tbcx_PutLe64(b, v);
+    W_Bytes(w, b, 8);
 }
 
 static inline void W_LPString(TbcxOut *w, const char *s, Tcl_Size n) {
@@ -319,10 +421,96 @@ static inline void W_LPString(TbcxOut *w, const char *s, Tcl_Size n) {
         W_Error(w, "tbcx: string too large");
         return;
     }
-    W_U32(w, (uint32_t)n);
+    W_Var(w, (uint32_t)n);
     W_Bytes(w, s, (size_t)n);
 }
 
+/* TbcxStrPool — the artifact string table under construction.  index maps
+ * each distinct string (Tcl_Obj key, compared by value) to its position in
+ * order, which is the emission order of TBCX_SEC_STRINGS. */
+typedef struct TbcxStrPool {
+    Tcl_HashTable index; /* Tcl_Obj* -> (intptr_t) table index */
+    Tcl_Obj      *order; /* list of the distinct strings */
+    uint32_t      count;
+    uint64_t      bytes; /* wire size of the entries (count excluded) */
+} TbcxStrPool;
+
+static void StrPoolInit(TbcxStrPool *sp) {
+    Tcl_InitObjHashTable(&sp->index);
+    sp->order = Tcl_NewListObj(0, NULL);
+    Tcl_IncrRefCount(sp->order);
+    sp->count = 0;
+    sp->bytes = 0;
+}
+
+static void StrPoolFree(TbcxStrPool *sp) {
+    Tcl_DeleteHashTable(&sp->index);
+    Tcl_DecrRefCount(sp->order);
+}
+
+/* W_StrRef — write a string ref: intern [s, s + n) in the artifact string
+ * table and emit its index. */
+static void W_StrRef(TbcxOut *w, const char *s, Tcl_Size n) {
+    if (w->err)
+        return;
+    if (n < 0)
+        n = (Tcl_Size)strlen(s);
+    if ((uint64_t)n > TBCX_MAX_STR) {
+        W_Error(w, "tbcx: string too large");
+        return;
+    }
+    TbcxStrPool *sp = w->strs;
+    if (!sp) {
+        W_Error(w, "tbcx: string ref written outside an artifact");
+        return;
+    }
+    Tcl_Obj *key = Tcl_NewStringObj(s, n);
+    Tcl_IncrRefCount(key);
+    int            isNew = 0;
+    Tcl_HashEntry *he    = Tcl_CreateHashEntry(&sp->index, (const char *)key, &isNew);
+    if (isNew) {
+        if (sp->count >= TBCX_MAX_STRINGS) {
+            Tcl_DeleteHashEntry(he);
+            Tcl_DecrRefCount(key);
+            W_Error(w, "tbcx: too many distinct strings");
+            return;
+        }
+        Tcl_SetHashValue(he, (void *)(intptr_t)sp->count);
+        Tcl_ListObjAppendElement(NULL, sp->order, key);
+        sp->count++;
+        sp->bytes += VarLen((uint32_t)n) + (uint64_t)n;
+    }
+    Tcl_DecrRefCount(key);
+    W_Var(w, (uint32_t)(intptr_t)Tcl_GetHashValue(he));
+}
+
+/* W_LitString — a string literal: a string ref when short enough to be
+ * worth sharing (TBCX_STRTAB_INTERN_MAX), else inline. */
+static void W_LitString(TbcxOut *w, const char *s, Tcl_Size n) {
+    if (n < 0)
+        n = (Tcl_Size)strlen(s);
+    if ((uint64_t)n <= TBCX_STRTAB_INTERN_MAX) {
+        W_Var(w, TBCX_LIT_STRREF);
+        W_StrRef(w, s, n);
+    } else {
+        W_Var(w, TBCX_LIT_STRING);
+        W_LPString(w, s, n);
+    }
+}
+
+/* WriteStrTab — emit the TBCX_SEC_STRINGS body: count, then each string. */
+static void WriteStrTab(TbcxOut *w, const TbcxStrPool *sp) {
+    Tcl_Size  n  = 0;
+    Tcl_Obj **ov = NULL;
+    Tcl_ListObjGetElements(NULL, sp->order, &n, &ov);
+    W_Var(w, sp->count);
+    for (Tcl_Size i = 0; i < n; i++) {
+        Tcl_Size    ln = 0;
+        const char *str = Tcl_GetStringFromObj(ov[i], &ln);
+        W_LPString(w, str, ln);
+    }
+}
+
 static void CtxInitStripBodies(TbcxCtx *ctx) {
     if (!ctx)
         return;
@@ -1106,7 +1294,7 @@ static void Lit_Bignum(TbcxOut *w, Tcl_Obj *o) {
     if (be_bytes == 0 || !be) {
         /* Zero magnitude — emit compact zero encoding */
         W_U8(w, 0);
-        W_U32(w, 0);
+        W_Var(w, 0);
         if (be)
             Tcl_Free((char *)be);
         TclBN_mp_clear(&mag);
@@ -1118,7 +1306,7 @@ static void Lit_Bignum(TbcxOut *w, Tcl_Obj *o) {
     size_t magLen = be_bytes - firstNZ;
     if (magLen == 0) { /* zero */
         W_U8(w, 0);
-        W_U32(w, 0);
+        W_Var(w, 0);
     } else {
         if (magLen > (size_t)UINT32_MAX) {
             W_Error(w, "tbcx: bignum magnitude exceeds uint32_t");
@@ -1129,7 +1317,7 @@ static void Lit_Bignum(TbcxOut *w, Tcl_Obj *o) {
         }
         int sign = mp_isneg(&z) ? 2 : 1;
         W_U8(w, (uint8_t)sign);
-        W_U32(w, (uint32_t)magLen);
+        W_Var(w, (uint32_t)magLen);
         /* write little-endian bytes */
         for (size_t i = 0; i < magLen; i++) {
             W_U8(w, be[be_bytes - 1 - i]);
@@ -1148,7 +1336,7 @@ static void Lit_List(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *o) {
         W_Error(w, "tbcx: list decode");
         return;
     }
-    W_U32(w, (uint32_t)n);
+    W_Var(w, (uint32_t)n);
     for (Tcl_Size i = 0; i < n; i++)
         WriteLiteral(w, ctx, v[i]);
 }
@@ -1191,7 +1379,7 @@ static void Lit_Dict(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *o) {
     }
     /* Preserve insertion order — do NOT sort.  Sorting would alter
        dict iteration order, which is observable via [dict for] etc. */
-    W_U32(w, (uint32_t)idx);
+    W_Var(w, (uint32_t)idx);
     for (Tcl_Size i = 0; i < idx; i++) {
         WriteLiteral(w, ctx, pairs[i].key);
         if (pairs[i].val) {
@@ -1236,7 +1424,7 @@ static void Lit_LambdaBC(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *lambda) {
     int         compiled_ok = 0;
     Tcl_Size    nsLen       = 0;
     const char *nsStr       = Tbcx_GetStringFromObjSafe(nsFQN, &nsLen);
-    W_LPString(w, nsStr, nsLen);
+    W_StrRef(w, nsStr, nsLen);
 
     /* Marshal args & defaults from the public args list */
     Tcl_Size  argc = 0;
@@ -1246,7 +1434,7 @@ static void Lit_LambdaBC(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *lambda) {
         W_Error(w, "tbcx: bad lambda args list");
         return;
     }
-    W_U32(w, (uint32_t)argc);
+    W_Var(w, (uint32_t)argc);
     for (Tcl_Size i = 0; i < argc; i++) {
         Tcl_Size  nf = 0;
         Tcl_Obj **fv = NULL;
@@ -1257,7 +1445,7 @@ static void Lit_LambdaBC(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *lambda) {
         }
         Tcl_Size    nmLen = 0;
         const char *nm    = Tbcx_GetStringFromObjSafe(fv[0], &nmLen);
-        W_LPString(w, nm, nmLen);
+        W_StrRef(w, nm, nmLen);
         if (nf == 2) {
             W_U8(w, 1);
             WriteLiteral(w, ctx, fv[1]);
@@ -1353,7 +1541,7 @@ static void Lit_Bytecode(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
     Tcl_Obj    *nsFQN = NsFqn((Tcl_Namespace *)(codePtr ? codePtr->nsPtr : NULL));
     Tcl_Size    nsLen;
     const char *nsStr = Tbcx_GetStringFromObjSafe(nsFQN, &nsLen);
-    W_LPString(w, nsStr, nsLen);
+    W_StrRef(w, nsStr, nsLen);
     WriteCompiledBlock(w, ctx, bcObj);
     Tcl_DecrRefCount(nsFQN);
 }
@@ -1518,10 +1706,10 @@ static void WriteLocalNames(TbcxOut *w, ByteCode *bc, uint32_t numLocals) {
             if (tmp[i]) {
                 Tcl_Size    ln = 0;
                 const char *s  = Tbcx_GetStringFromObjSafe(tmp[i], &ln);
-                W_LPString(w, s, ln);
+                W_StrRef(w, s, ln);
                 Tcl_DecrRefCount(tmp[i]);
             } else {
-                W_LPString(w, "", 0);
+                W_StrRef(w, "", 0);
             }
         }
         Tcl_Free((char *)tmp);
@@ -1539,16 +1727,16 @@ static void WriteLocalNames(TbcxOut *w, ByteCode *bc, uint32_t numLocals) {
             if (i < nVars && names[i]) {
                 Tcl_Size    ln = 0;
                 const char *s  = Tbcx_GetStringFromObjSafe(names[i], &ln);
-                W_LPString(w, s, ln);
+                W_StrRef(w, s, ln);
             } else {
-                W_LPString(w, "", 0);
+                W_StrRef(w, "", 0);
             }
         }
         return;
     }
     /* No procPtr and no LocalCache: emit empty names (keeps format consistent). */
     for (i = 0; i < n; i++) {
-        W_LPString(w, "", 0);
+        W_StrRef(w, "", 0);
     }
 }
 
@@ -1557,7 +1745,7 @@ static void WriteLocalNames(TbcxOut *w, ByteCode *bc, uint32_t numLocals) {
  * lookup, on-the-fly precompilation, integer fidelity probing, and
  * falls back to plain string emission. */
 /* LambdaRoundtripFaithful — 1 iff serialising `obj` as a precompiled lambda
- * reproduces its exact string value on reload.  ReadLit_LambdaBC rebuilds the
+ * reproduces its exact string value on reload.  MaterializeLambda rebuilds the
  * value as [list <args-as-list> <body> ?<ns>?]; re-listifying the args can
  * re-quote a first token that needs list-bracing ("#a" -> args "{#a}" ->
  * embedded "{{#a}}"), corrupting a genuine DATA list that merely looks
@@ -1575,7 +1763,7 @@ static int LambdaRoundtripFaithful(Tcl_Interp *ip, Tcl_Obj *obj) {
     Tcl_Obj **aV = NULL;
     if (Tcl_ListObjGetElements(NULL, E[0], &aN, &aV) != TCL_OK)
         return 0;
-    /* The loader (ReadLit_LambdaBC) requires the namespace element to be
+    /* The loader (MaterializeLambda) requires the namespace element to be
        ABSOLUTE (::-prefixed) and COLLAPSES an exactly-"::" namespace back to a
        2-element value.  A 3-element DATA list whose 3rd token is non-absolute
        (e.g. "relative", "#ns", "", "a b") would make the whole .tbcx file fail
@@ -1590,7 +1778,7 @@ static int LambdaRoundtripFaithful(Tcl_Interp *ip, Tcl_Obj *obj) {
         if (!absolute || globalOnly)
             return 0;
     }
-    /* Rebuild the args list the way ReadLit_LambdaBC does: split each arg into
+    /* Rebuild the args list the way MaterializeLambda does: split each arg into
        name + optional default and re-list the {name ?default?} pair.  Re-
        canonicalising only the whole arg token (Tcl_NewListObj(aN,aV)) would be
        MORE faithful than the actual codec — which writes each default as a
@@ -1692,7 +1880,7 @@ static void WriteLit_Untyped(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
                 }
             }
             if (isLambdaLike && LambdaRoundtripFaithful(ctx->interp, lcopy)) {
-                W_U32(w, TBCX_LIT_LAMBDA_BC);
+                W_Var(w, TBCX_LIT_LAMBDA_BC);
                 Lit_LambdaBC(w, ctx, lcopy);
                 Tcl_DecrRefCount(lcopy);
                 return;
@@ -1712,15 +1900,14 @@ static void WriteLit_Untyped(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
             int isNew;
             Tcl_CreateHashEntry(&ctx->emittedBodies, s, &isNew);
         }
-        W_U32(w, TBCX_LIT_BYTESRC);
+        W_Var(w, TBCX_LIT_BYTESRC);
         W_LPString(w, s, n);
         Lit_Bytecode(w, ctx, compiled);
         return;
     }
 
     if (ShouldStripBody(ctx, obj)) {
-        W_U32(w, TBCX_LIT_STRING);
-        W_LPString(w, "", 0);
+        W_LitString(w, "", 0);
         return;
     }
 
@@ -1781,7 +1968,7 @@ static void WriteLit_Untyped(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
                                 Tcl_CreateHashEntry(&ctx->emittedBodies, s, &isNew);
                             }
                             ctx->precompileDepth++;
-                            W_U32(w, TBCX_LIT_BYTESRC);
+                            W_Var(w, TBCX_LIT_BYTESRC);
                             W_LPString(w, s, n);
                             Lit_Bytecode(w, ctx, copy);
                             ctx->precompileDepth--;
@@ -1825,7 +2012,7 @@ static void WriteLit_Untyped(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
                         ibc->nsPtr   = targetNs;
                         ibc->nsEpoch = targetNs->resolverEpoch;
                         ctx->precompileDepth++;
-                        W_U32(w, TBCX_LIT_BYTESRC);
+                        W_Var(w, TBCX_LIT_BYTESRC);
                         W_LPString(w, s, n);
                         Lit_Bytecode(w, ctx, copy);
                         ctx->precompileDepth--;
@@ -1861,10 +2048,10 @@ static void WriteLit_Untyped(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
             if (cl == n && memcmp(s, canon, (size_t)n) == 0) {
                 Tcl_DecrRefCount(canonObj);
                 if (wv >= 0) {
-                    W_U32(w, TBCX_LIT_WIDEUINT);
+                    W_Var(w, TBCX_LIT_WIDEUINT);
                     W_U64(w, (uint64_t)wv);
                 } else {
-                    W_U32(w, TBCX_LIT_WIDEINT);
+                    W_Var(w, TBCX_LIT_WIDEINT);
                     W_U64(w, (uint64_t)wv);
                 }
                 return;
@@ -1890,8 +2077,8 @@ static void WriteLit_Untyped(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
             Tcl_Size       bLen  = 0;
             unsigned char *bytes = Tbcx_GetByteArrayFromObjSafe(probe, &bLen);
             if (bytes && bLen > 0) {
-                W_U32(w, TBCX_LIT_BYTEARR);
-                W_U32(w, (uint32_t)bLen);
+                W_Var(w, TBCX_LIT_BYTEARR);
+                W_Var(w, (uint32_t)bLen);
                 W_Bytes(w, bytes, (size_t)bLen);
                 Tcl_DecrRefCount(probe);
                 return;
@@ -1900,8 +2087,7 @@ static void WriteLit_Untyped(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
         }
     }
 
-    W_U32(w, TBCX_LIT_STRING);
-    W_LPString(w, s, n);
+    W_LitString(w, s, n);
 }
 static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
     /* Runaway detection */
@@ -1932,15 +2118,15 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
         Tcl_WideInt wv = 0;
         if (Tcl_GetWideIntFromObj(NULL, obj, &wv) == TCL_OK) {
             if (wv >= 0) {
-                W_U32(w, TBCX_LIT_WIDEUINT);
+                W_Var(w, TBCX_LIT_WIDEUINT);
                 W_U64(w, (uint64_t)wv);
             } else {
-                W_U32(w, TBCX_LIT_WIDEINT);
+                W_Var(w, TBCX_LIT_WIDEINT);
                 W_U64(w, (uint64_t)wv);
             }
         } else {
             /* True bignum — doesn't fit in 64 bits */
-            W_U32(w, TBCX_LIT_BIGNUM);
+            W_Var(w, TBCX_LIT_BIGNUM);
             Lit_Bignum(w, obj);
         }
     } else if (tbcxTyBoolean && tbcxTyBoolean != tbcxTyInt && ty == tbcxTyBoolean) {
@@ -1950,7 +2136,7 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
         int b = 0;
         if (Tcl_GetBooleanFromObj(NULL, obj, &b) != TCL_OK)
             b = 0; /* defensive: should not happen given type check above */
-        W_U32(w, TBCX_LIT_BOOLEAN);
+        W_Var(w, TBCX_LIT_BOOLEAN);
         W_U8(w, (uint8_t)(b != 0));
     } else if (ty == tbcxTyByteArray) {
         Tcl_Size       n = 0;
@@ -1959,8 +2145,8 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
             W_Error(w, "tbcx: bytearray conversion returned NULL");
             return;
         }
-        W_U32(w, TBCX_LIT_BYTEARR);
-        W_U32(w, (uint32_t)n);
+        W_Var(w, TBCX_LIT_BYTEARR);
+        W_Var(w, (uint32_t)n);
         if (n > 0)
             W_Bytes(w, p, (size_t)n);
     } else if (ty == tbcxTyDict) {
@@ -1968,10 +2154,9 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
            to avoid unnecessary dict alloc on load. */
         Tcl_Size dsz = 0;
         if (Tcl_DictObjSize(NULL, obj, &dsz) == TCL_OK && dsz == 0) {
-            W_U32(w, TBCX_LIT_STRING);
-            W_LPString(w, "", 0);
+            W_LitString(w, "", 0);
         } else {
-            W_U32(w, TBCX_LIT_DICT);
+            W_Var(w, TBCX_LIT_DICT);
             Lit_Dict(w, ctx, obj);
         }
     } else if (ty == tbcxTyDouble) {
@@ -1985,7 +2170,7 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
             uint64_t u;
         } u;
         u.d = d;
-        W_U32(w, TBCX_LIT_DOUBLE);
+        W_Var(w, TBCX_LIT_DOUBLE);
         W_U64(w, u.u);
     } else if (ty == tbcxTyList) {
         /* Guard against a scalar value carrying a parasitic list intrep.
@@ -2056,16 +2241,15 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
             }
         }
         if (isLambdaLike && LambdaRoundtripFaithful(ctx->interp, obj)) {
-            W_U32(w, TBCX_LIT_LAMBDA_BC);
+            W_Var(w, TBCX_LIT_LAMBDA_BC);
             Lit_LambdaBC(w, ctx, obj);
         } else {
-            W_U32(w, TBCX_LIT_LIST);
+            W_Var(w, TBCX_LIT_LIST);
             Lit_List(w, ctx, obj);
         }
     } else if (ty == tbcxTyBytecode) {
         if (ctx && ctx->stripActive) {
-            W_U32(w, TBCX_LIT_STRING);
-            W_LPString(w, "", 0);
+            W_LitString(w, "", 0);
         } else {
             /* Dual dedup: pointer + string, mark-before-visit */
             int deduped = 0;
@@ -2090,12 +2274,11 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
             if (deduped) {
                 Tcl_Size    fl = 0;
                 const char *fs = Tbcx_GetStringFromObjSafe(obj, &fl);
-                W_U32(w, TBCX_LIT_STRING);
-                W_LPString(w, fs, fl);
+                W_LitString(w, fs, fl);
             } else {
                 Tcl_Size    _srcLen = 0;
                 const char *_srcStr = Tbcx_GetStringFromObjSafe(obj, &_srcLen);
-                W_U32(w, TBCX_LIT_BYTESRC);
+                W_Var(w, TBCX_LIT_BYTESRC);
                 W_LPString(w, _srcStr, _srcLen);
                 Lit_Bytecode(w, ctx, obj);
             }
@@ -2103,8 +2286,7 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
     } else if (obj->typePtr == tbcxTyProcBody) {
         /* Strip proc bodies during top-level write. */
         if (ctx && ctx->stripActive) {
-            W_U32(w, TBCX_LIT_STRING);
-            W_LPString(w, "", 0);
+            W_LitString(w, "", 0);
         } else {
             Proc *p = (Proc *)obj->internalRep.twoPtrValue.ptr1;
             if (p && p->bodyPtr) {
@@ -2119,8 +2301,7 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
                             if (!isNew) {
                                 Tcl_Size    fl = 0;
                                 const char *fs = Tbcx_GetStringFromObjSafe(p->bodyPtr, &fl);
-                                W_U32(w, TBCX_LIT_STRING);
-                                W_LPString(w, fs, fl);
+                                W_LitString(w, fs, fl);
                                 return;
                             }
                         }
@@ -2131,8 +2312,7 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
                                 int isNew;
                                 Tcl_CreateHashEntry(&ctx->emittedBodies, pbStr, &isNew);
                                 if (!isNew) {
-                                    W_U32(w, TBCX_LIT_STRING);
-                                    W_LPString(w, pbStr, pbLen);
+                                    W_LitString(w, pbStr, pbLen);
                                     return;
                                 }
                             }
@@ -2141,18 +2321,17 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
                     {
                         Tcl_Size    _srcLen2 = 0;
                         const char *_srcStr2 = Tbcx_GetStringFromObjSafe(p->bodyPtr, &_srcLen2);
-                        W_U32(w, TBCX_LIT_BYTESRC);
+                        W_Var(w, TBCX_LIT_BYTESRC);
                         W_LPString(w, _srcStr2, _srcLen2);
                         Lit_Bytecode(w, ctx, p->bodyPtr);
                     }
                     return;
                 }
             }
-            W_U32(w, TBCX_LIT_STRING);
-            W_LPString(w, "", 0);
+            W_LitString(w, "", 0);
         }
     } else if (tbcxTyLambda != NULL && ty == tbcxTyLambda) {
-        W_U32(w, TBCX_LIT_LAMBDA_BC);
+        W_Var(w, TBCX_LIT_LAMBDA_BC);
         Lit_LambdaBC(w, ctx, obj);
     } else {
         WriteLit_Untyped(w, ctx, obj);
@@ -2162,7 +2341,7 @@ static void WriteLiteral(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *obj) {
 static void WriteAux_JTStr(TbcxOut *w, AuxData *ad) {
     JumptableInfo *info = (JumptableInfo *)ad->clientData;
     if (!info) {
-        W_U32(w, 0);
+        W_Var(w, 0);
         return;
     }
     Tcl_HashSearch srch;
@@ -2172,7 +2351,7 @@ static void WriteAux_JTStr(TbcxOut *w, AuxData *ad) {
     for (h = Tcl_FirstHashEntry(&info->hashTable, &srch); h; h = Tcl_NextHashEntry(&srch))
         cnt++;
     if (cnt == 0) {
-        W_U32(w, 0);
+        W_Var(w, 0);
         return;
     }
     size_t arrBytes = 0;
@@ -2190,11 +2369,11 @@ static void WriteAux_JTStr(TbcxOut *w, AuxData *ad) {
     if (cnt > 1) {
         qsort(arr, (size_t)cnt, sizeof(JTEntry), CmpJTEntryUtf8_qsort);
     }
-    W_U32(w, cnt);
+    W_Var(w, cnt);
     for (uint32_t k = 0; k < cnt; k++) {
         const char *s = arr[k].key ? arr[k].key : "";
         W_LPString(w, s, (Tcl_Size)strlen(s));
-        W_U32(w, (uint32_t)arr[k].targetOffset);
+        W_Var(w, (uint32_t)arr[k].targetOffset);
     }
     Tcl_Free((char *)arr);
 }
@@ -2202,7 +2381,7 @@ static void WriteAux_JTStr(TbcxOut *w, AuxData *ad) {
 static void WriteAux_JTNum(TbcxOut *w, AuxData *ad) {
     JumptableNumInfo *info = (JumptableNumInfo *)ad->clientData;
     if (!info) {
-        W_U32(w, 0);
+        W_Var(w, 0);
         return;
     }
     Tcl_HashSearch srch;
@@ -2211,7 +2390,7 @@ static void WriteAux_JTNum(TbcxOut *w, AuxData *ad) {
     for (h = Tcl_FirstHashEntry(&info->hashTable, &srch); h; h = Tcl_NextHashEntry(&srch))
         cnt++;
     if (cnt == 0) {
-        W_U32(w, 0);
+        W_Var(w, 0);
         return;
     }
     size_t numBytes = 0;
@@ -2229,10 +2408,10 @@ static void WriteAux_JTNum(TbcxOut *w, AuxData *ad) {
     if (cnt > 1) {
         qsort(arr, (size_t)cnt, sizeof(JTNumEntry), CmpJTNumEntry_qsort);
     }
-    W_U32(w, cnt);
+    W_Var(w, cnt);
     for (uint32_t k = 0; k < cnt; k++) {
         W_U64(w, (uint64_t)arr[k].key);
-        W_U32(w, (uint32_t)arr[k].targetOffset);
+        W_Var(w, (uint32_t)arr[k].targetOffset);
     }
     Tcl_Free((char *)arr);
 }
@@ -2240,31 +2419,90 @@ static void WriteAux_JTNum(TbcxOut *w, AuxData *ad) {
 static void WriteAux_DictUpdate(TbcxOut *w, AuxData *ad) {
     DictUpdateInfo *info = (DictUpdateInfo *)ad->clientData;
     if (!info) {
-        W_U32(w, 0);
+        W_Var(w, 0);
         return;
     }
-    W_U32(w, (uint32_t)info->length);
-    for (Tcl_Size i = 0; i < info->length; i++)
-        W_U32(w, (uint32_t)info->varIndices[i]);
+    W_Var(w, (uint32_t)info->length);
+    uint32_t idx[64];
+    for (Tcl_Size i = 0; i < info->length;) {
+        size_t k = 0;
+        for (; k < 64u && i < info->length; k++, i++)
+            idx[k] = (uint32_t)info->varIndices[i];
+        W_VarArray(w, idx, k);
+    }
 }
 
 static void WriteAux_Foreach(TbcxOut *w, AuxData *ad) {
     ForeachInfo *info     = (ForeachInfo *)ad->clientData;
     Tcl_Size     numLists = info ? info->numLists : 0;
-    W_U32(w, (uint32_t)numLists);
-    W_U32(w, (uint32_t)(info ? info->loopCtTemp : 0));
-    W_U32(w, (uint32_t)(info ? info->firstValueTemp : 0));
-    W_U32(w, (uint32_t)numLists); /* intentional duplicate — loader validates match */
+    W_Var(w, (uint32_t)numLists);
+    W_Var(w, (uint32_t)(info ? info->loopCtTemp : 0));
+    W_Var(w, (uint32_t)(info ? info->firstValueTemp : 0));
+    W_Var(w, (uint32_t)numLists); /* intentional duplicate — loader validates match */
     for (Tcl_Size i = 0; i < numLists; i++) {
         ForeachVarList *vl = info->varLists[i];
         Tcl_Size        nv = vl ? vl->numVars : 0;
-        W_U32(w, (uint32_t)nv);
-        for (Tcl_Size j = 0; j < nv; j++) {
-            W_U32(w, (uint32_t)vl->varIndexes[j]);
+        W_Var(w, (uint32_t)nv);
+        uint32_t idx[64];
+        for (Tcl_Size j = 0; j < nv;) {
+            size_t k = 0;
+            for (; k < 64u && j < nv; k++, j++)
+                idx[k] = (uint32_t)vl->varIndexes[j];
+            W_VarArray(w, idx, k);
         }
     }
 }
 
+/* BlockNumLocals — local slot count written in a compiled block's
+ * epilogue (or, with -native, its shape). */
+static uint32_t BlockNumLocals(ByteCode *bc) {
+    uint32_t numLocals = 0u;
+
+    if (bc->procPtr) {
+        /* procPtr->numCompiledLocals is authoritative for proc bytecodes.
+           It includes ALL locals: parameters, named variables, AND compiler
+           temporaries (foreach iteration vars, etc.).
+           Do NOT use ComputeNumLocals(bc) here — the AuxData scan can
+           read garbage from misaligned ForeachInfo structs in Tcl 9.1,
+           producing billion-scale numLocals and a 12GB output explosion. */
+        numLocals = (uint32_t)bc->procPtr->numCompiledLocals;
+    } else if (bc->localCachePtr && bc->localCachePtr->numVars > 0) {
+        /* For top-level bytecode, LocalCache is authoritative. */
+        numLocals = (uint32_t)bc->localCachePtr->numVars;
+    } else {
+        /* No Proc and no LocalCache — fall back to AuxData scan.
+           This only applies to bare top-level scripts with no LocalCache,
+           where foreach/dictupdate temps need to be inferred from AuxData. */
+        numLocals = ComputeNumLocals(bc);
+    }
+
+    /* Sanity cap — defence in depth.  Silently cap instead of writing to
+     * stderr — extension code must not use stderr directly. */
+    if (numLocals > TBCX_MAX_LOCALS) {
+        numLocals = 0;
+    }
+
+    return numLocals;
+}
+
+/* WriteExceptionsNative — the -native exception table: each range as the
+ * host ExceptionRange, padding zeroed so the artifact is reproducible. */
+static void WriteExceptionsNative(TbcxOut *w, ByteCode *bc) {
+    for (Tcl_Size i = 0; i < bc->numExceptRanges; i++) {
+        const ExceptionRange *src = &bc->exceptArrayPtr[i];
+        ExceptionRange        er;
+        memset(&er, 0, sizeof(er));
+        er.type           = src->type;
+        er.nestingLevel   = src->nestingLevel;
+        er.codeOffset     = src->codeOffset;
+        er.numCodeBytes   = src->numCodeBytes;
+        er.breakOffset    = src->breakOffset;
+        er.continueOffset = src->continueOffset;
+        er.catchOffset    = src->catchOffset;
+        W_Bytes(w, &er, sizeof(er));
+    }
+}
+
 static uint32_t ComputeNumLocals(ByteCode *bc) {
     if (!bc)
         return 0;
@@ -3036,7 +3274,66 @@ static void InstrScanBodyLiterals(ByteCode *bc, TbcxCtx *ctx, char *phase2marks)
 #undef ISCAN_POP
 }
 
+/* BlockDedup — the outermost block just staged at [start, W_Pos(w)) is
+ * either recorded, or, when an earlier one has the same bytes and was
+ * compiled for the same namespace, dropped again and replaced by a
+ * back-reference to it.  Nested blocks are left alone: their bytes are part
+ * of the enclosing block's, and a reference inside one would make two
+ * otherwise identical parents differ. */
+static void BlockDedup(TbcxOut *w, TbcxCtx *ctx, uint64_t start, Namespace *nsPtr) {
+    if (Tbcx_W_Flush(w) != TCL_OK)
+        return;
+    const unsigned char *body = w->mem + start;
+    size_t               len  = w->memLen - (size_t)start;
+    uint32_t             crc  = Tbcx_Crc32c(0, body, len);
+    uintptr_t            key  = (uintptr_t)crc ^ ((uintptr_t)len << 7) ^ (uintptr_t)nsPtr;
+    int                  isNew;
+    Tcl_HashEntry       *he   = Tcl_CreateHashEntry(&ctx->blockIndex, (const char *)key, &isNew);
+    size_t               head = isNew ? 0 : (size_t)(uintptr_t)Tcl_GetHashValue(he);
+    for (size_t i = head; i; i = ctx->blockRecs[i - 1].next) {
+        const TbcxBlockRec *rec = &ctx->blockRecs[i - 1];
+        if (rec->crc != crc || rec->len != len || rec->nsPtr != nsPtr || memcmp(w->mem + rec->start, body, len) != 0)
+            continue;
+        uint64_t dist = start - rec->start;
+        if (dist > (uint64_t)(UINT32_MAX - TBCX_BLOCK_REF_BASE))
+            break; /* too far back to encode; keep this copy */
+        w->memLen     = (size_t)start;
+        w->totalBytes = start;
+        W_Var(w, TBCX_BLOCK_REF_BASE + (uint32_t)dist);
+        ctx->numBlockRefs++;
+        return;
+    }
+    if (ctx->numBlockRecs == ctx->capBlockRecs) {
+        size_t        cap   = ctx->capBlockRecs ? ctx->capBlockRecs * 2u : 64u;
+        TbcxBlockRec *grown = (TbcxBlockRec *)Tcl_AttemptRealloc((char *)ctx->blockRecs, cap * sizeof(TbcxBlockRec));
+        if (!grown)
+            return; /* not indexed; later repeats are simply written out */
+        ctx->blockRecs    = grown;
+        ctx->capBlockRecs = cap;
+    }
+    TbcxBlockRec *rec = &ctx->blockRecs[ctx->numBlockRecs++];
+    rec->start        = start;
+    rec->len          = len;
+    rec->nsPtr        = nsPtr;
+    rec->crc          = crc;
+    rec->next         = head;
+    Tcl_SetHashValue(he, (void *)(uintptr_t)ctx->numBlockRecs);
+}
+
 static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
+    ByteCode *bc = TbcxGetByteCode(bcObj);
+    if (!bc || !ctx || !ctx->blockIndexInit || !w->toMem || ctx->blockDepth > 0) {
+        WriteBlockBody(w, ctx, bcObj);
+        return;
+    }
+    uint64_t   start = W_Pos(w);
+    Namespace *nsPtr = bc->nsPtr;
+    WriteBlockBody(w, ctx, bcObj);
+    if (!w->err && !ctx->runaway)
+        BlockDedup(w, ctx, start, nsPtr);
+}
+
+static void WriteBlockBody(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
     ByteCode *bc = NULL;
     bc           = TbcxGetByteCode(bcObj);
 
@@ -3097,7 +3394,17 @@ static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
             ctx->blockDepth--;
         return;
     }
-    W_U32(w, (uint32_t)bc->numCodeBytes);
+    /* -native: the whole shape leads the block so the loader can allocate
+     * the final ByteCode before reading anything else. */
+    const int native    = ctx && (ctx->saveFlags & TBCX_SAVE_FL_NATIVE);
+    uint32_t  numLocals = BlockNumLocals(bc);
+    if (native) {
+        uint32_t shape[6] = {(uint32_t)bc->numCodeBytes,    (uint32_t)bc->numLitObjects, (uint32_t)bc->numAuxDataItems,
+                             (uint32_t)bc->numExceptRanges, (uint32_t)bc->maxStackDepth, numLocals};
+        W_VarArray(w, shape, 6);
+    } else {
+        W_Var(w, (uint32_t)bc->numCodeBytes);
+    }
     if (tbcxOpStartCmd != 0 && tbcxStartCmdBytes > 0) {
         const InstructionDesc *instTable = (const InstructionDesc *)TclGetInstructionTable();
         unsigned char         *stripped  = (unsigned char *)Tcl_Alloc((size_t)bc->numCodeBytes);
@@ -3133,6 +3440,10 @@ static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
         W_Bytes(w, bc->codeStart, (size_t)bc->numCodeBytes);
     }
 
+    /* -native: exception ranges follow the code as host structs */
+    if (native)
+        WriteExceptionsNative(w, bc);
+
     /* 2) literal pool */
     /* scan instructions to identify body-argument literals
        BEFORE emitting the pool.
@@ -3152,7 +3463,8 @@ static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
         }
         InstrScanBodyLiterals(bc, ctx, phase2marks);
     }
-    W_U32(w, (uint32_t)bc->numLitObjects);
+    if (!native)
+        W_Var(w, (uint32_t)bc->numLitObjects);
     for (Tcl_Size i = 0; i < bc->numLitObjects; i++) {
         Tcl_Obj *lit       = bc->objArrayPtr[i];
         /* Phase 2: if this literal index was marked as an unpushed loop
@@ -3169,7 +3481,7 @@ static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
                 Tcl_Size    _p2sLen = 0;
                 const char *_p2sStr = Tbcx_GetStringFromObjSafe(lit, &_p2sLen);
                 ctx->precompileDepth++;
-                W_U32(w, TBCX_LIT_BYTESRC);
+                W_Var(w, TBCX_LIT_BYTESRC);
                 W_LPString(w, _p2sStr, _p2sLen);
                 Lit_Bytecode(w, ctx, lit);
                 ctx->precompileDepth--;
@@ -3195,7 +3507,7 @@ static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
                             ibc->nsPtr   = targetNs;
                             ibc->nsEpoch = targetNs->resolverEpoch;
                             ctx->precompileDepth++;
-                            W_U32(w, TBCX_LIT_BYTESRC);
+                            W_Var(w, TBCX_LIT_BYTESRC);
                             W_LPString(w, ss2, sl2);
                             Lit_Bytecode(w, ctx, copy);
                             ctx->precompileDepth--;
@@ -3222,7 +3534,8 @@ static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
         Tcl_Free(phase2marks);
 
     /* 3) AuxData array */
-    W_U32(w, (uint32_t)bc->numAuxDataItems);
+    if (!native)
+        W_Var(w, (uint32_t)bc->numAuxDataItems);
     for (Tcl_Size i = 0; i < bc->numAuxDataItems; i++) {
         AuxData *ad  = &bc->auxDataArrayPtr[i];
         uint32_t tag = 0xFFFFFFFFu;
@@ -3244,7 +3557,7 @@ static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
                 ctx->blockDepth--;
             return;
         }
-        W_U32(w, tag);
+        W_Var(w, tag);
         switch (tag) {
         case TBCX_AUX_JT_STR:
             WriteAux_JTStr(w, ad);
@@ -3261,49 +3574,29 @@ static void WriteCompiledBlock(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *bcObj) {
         }
     }
 
+    if (native) {
+        if (numLocals > 0)
+            WriteLocalNames(w, bc, numLocals);
+        if (ctx)
+            ctx->blockDepth--;
+        return;
+    }
+
     /* 4) exception ranges */
-    W_U32(w, (uint32_t)bc->numExceptRanges);
+    W_Var(w, (uint32_t)bc->numExceptRanges);
     for (Tcl_Size i = 0; i < bc->numExceptRanges; i++) {
-        ExceptionRange *er = &bc->exceptArrayPtr[i];
-        W_U8(w, (uint8_t)er->type);
-        W_U32(w, (uint32_t)er->nestingLevel);
-        W_U32(w, (uint32_t)er->codeOffset);
-        W_U32(w, (uint32_t)er->numCodeBytes);
-        W_U32(w, (uint32_t)er->continueOffset);
-        W_U32(w, (uint32_t)er->breakOffset);
-        W_U32(w, (uint32_t)er->catchOffset);
+        /* the type (0 or 1) is a u8 on the wire, which a one-byte varint
+         * encodes identically */
+        ExceptionRange *er   = &bc->exceptArrayPtr[i];
+        uint32_t        e[7] = {(uint32_t)(uint8_t)er->type,       (uint32_t)er->nestingLevel,   (uint32_t)er->codeOffset, (uint32_t)er->numCodeBytes,
+                                (uint32_t)er->continueOffset, (uint32_t)er->breakOffset, (uint32_t)er->catchOffset};
+        W_VarArray(w, e, 7);
     }
 
     /* 5) epilogue */
-    W_U32(w, (uint32_t)bc->maxStackDepth);
-    W_U32(w, 0);
-    uint32_t numLocals = 0u;
-
-    if (bc->procPtr) {
-        /* procPtr->numCompiledLocals is authoritative for proc bytecodes.
-           It includes ALL locals: parameters, named variables, AND compiler
-           temporaries (foreach iteration vars, etc.).
-           Do NOT use ComputeNumLocals(bc) here — the AuxData scan can
-           read garbage from misaligned ForeachInfo structs in Tcl 9.1,
-           producing billion-scale numLocals and a 12GB output explosion. */
-        numLocals = (uint32_t)bc->procPtr->numCompiledLocals;
-    } else if (bc->localCachePtr && bc->localCachePtr->numVars > 0) {
-        /* For top-level bytecode, LocalCache is authoritative. */
-        numLocals = (uint32_t)bc->localCachePtr->numVars;
-    } else {
-        /* No Proc and no LocalCache — fall back to AuxData scan.
-           This only applies to bare top-level scripts with no LocalCache,
-           where foreach/dictupdate temps need to be inferred from AuxData. */
-        numLocals = ComputeNumLocals(bc);
-    }
-
-    /* Sanity cap — defence in depth.  Silently cap instead of writing to
-     * stderr — extension code must not use stderr directly. */
-    if (numLocals > TBCX_MAX_LOCALS) {
-        numLocals = 0;
-    }
-
-    W_U32(w, numLocals);
+    W_Var(w, (uint32_t)bc->maxStackDepth);
+    W_Var(w, 0);
+    W_Var(w, numLocals);
     if (numLocals > 0) {
         WriteLocalNames(w, bc, numLocals);
     }
@@ -3342,22 +3635,103 @@ static void WriteHeaderTop(TbcxOut *w, TbcxCtx *ctx, Tcl_Obj *topObj) {
             nl = 0;
         H.numLocalsTop = nl;
     }
-    W_U32(w, H.magic);
-    W_U32(w, H.format);
-    W_U32(w, H.tcl_version);
-    W_U64(w, H.codeLenTop);
-    W_U32(w, H.numExceptTop);
-    W_U32(w, H.numLitsTop);
-    W_U32(w, H.numAuxTop);
-    W_U32(w, H.numLocalsTop);
-    W_U32(w, H.maxStackTop);
-    if (ctx->sourcePath) {
-        Tcl_Size    pLen = 0;
-        const char *pStr = Tbcx_GetStringFromObjSafe(ctx->sourcePath, &pLen);
-        W_LPString(w, pStr, pLen);
-    } else {
-        W_LPString(w, "", 0);
+    /* The header stays fixed-width (the source path length is a u32, not
+     * a varint) and is encoded as one block. */
+    Tcl_Size    pLen = 0;
+    const char *pStr = ctx->sourcePath ? Tbcx_GetStringFromObjSafe(ctx->sourcePath, &pLen) : "";
+    if ((uint64_t)pLen > TBCX_MAX_STR) {
+        W_Error(w, "tbcx: string too large");
+        return;
+    }
+    unsigned char fx[TBCX_HDR_FIXED];
+    Tbcx_PutLe32(fx + 0, H.magic);
+    Tbcx_PutLe32(fx + 4, H.format);
+    Tbcx_PutLe32(fx + 8, H.tcl_version);
+    Tbcx_PutLe64(fx + 12, H.codeLenTop);
+    Tbcx_PutLe32(fx + 20, H.numExceptTop);
+    Tbcx_PutLe32(fx + 24, H.numLitsTop);
+    Tbcx_PutLe32(fx + 28, H.numAuxTop);
+    Tbcx_PutLe32(fx + 32, H.numLocalsTop);
+    Tbcx_PutLe32(fx + 36, H.maxStackTop);
+    Tbcx_PutLe32(fx + 40, (uint32_t)pLen);
+    W_Bytes(w, fx, TBCX_HDR_FIXED);
+    W_Bytes(w, pStr, (size_t)pLen);
+}
+
+/* WriteSectionDirectory — the v93 header tail that follows sourcePath:
+ * flags, the three definition counts, numSections and one (kind, offset,
+ * length) entry per section.  Offsets are relative to the data base, i.e.
+ * the first byte written after this directory. */
+static void WriteSectionDirectory(TbcxOut *w, const TbcxHeader *H) {
+    unsigned char dc[TBCX_DIR_COUNTS];
+    Tbcx_PutLe32(dc + 0, H->flags);
+    Tbcx_PutLe32(dc + 4, H->numProcs);
+    Tbcx_PutLe32(dc + 8, H->numClasses);
+    Tbcx_PutLe32(dc + 12, H->numMethods);
+    Tbcx_PutLe32(dc + 16, H->numSections);
+    W_Bytes(w, dc, TBCX_DIR_COUNTS);
+    /* entries go out a batch at a time */
+    unsigned char batch[64u * TBCX_DIR_ENTRY];
+    for (uint32_t i = 0; i < H->numSections;) {
+        size_t k = 0;
+        for (; k < 64u && i < H->numSections; k++, i++) {
+            unsigned char     *e  = batch + k * TBCX_DIR_ENTRY;
+            const TbcxSection *sp = &H->sections[i];
+            Tbcx_PutLe32(e + 0, sp->kind);
+            Tbcx_PutLe64(e + 4, sp->offset);
+            Tbcx_PutLe64(e + 12, sp->length);
+            Tbcx_PutLe32(e + 20, sp->crc);
+        }
+        W_Bytes(w, batch, k * TBCX_DIR_ENTRY);
+    }
+}
+
+/* WriteCompressedSections — -compress tail: directory plus one frame per
+ * section (tbcx.h, TBCX_FRAME_*).  Section 0 is the string table at strTab;
+ * the others sit in data at the offsets H still holds from staging, and are
+ * rewritten here to the frame offsets and lengths.  A section that does not
+ * shrink is stored raw. */
+static void WriteCompressedSections(TbcxOut *out, TbcxHeader *H, const unsigned char *strTab, size_t strLen, const unsigned char *data) {
+    size_t cap = 0;
+    H->sections[0].offset = 0;
+    H->sections[0].length = strLen;
+    for (uint32_t k = 0; k < H->numSections; k++)
+        cap += TBCX_FRAME_HDR + Tbcx_LzBound((size_t)H->sections[k].length);
+    unsigned char *fr = (unsigned char *)Tcl_AttemptAlloc(cap ? cap : 1u);
+    if (!fr) {
+        W_Error(out, "tbcx: allocation failed (compress)");
+        return;
     }
+    size_t pos = 0;
+    for (uint32_t k = 0; k < H->numSections; k++) {
+        TbcxSection         *sp     = &H->sections[k];
+        const unsigned char *src    = k ? data + sp->offset : strTab;
+        size_t               rawLen = (size_t)sp->length;
+        unsigned char       *hdr    = fr + pos;
+        size_t               packed = Tbcx_LzCompress(src, rawLen, hdr + TBCX_FRAME_HDR, cap - pos - TBCX_FRAME_HDR);
+        if (packed && packed < rawLen) {
+            hdr[0] = TBCX_FRAME_LZ;
+        } else {
+            hdr[0] = TBCX_FRAME_STORED;
+            packed = rawLen;
+            if (rawLen)
+                memcpy(hdr + TBCX_FRAME_HDR, src, rawLen);
+        }
+        Tbcx_PutLe32(hdr + 1, (uint32_t)rawLen);
+        sp->offset = pos;
+        sp->length = TBCX_FRAME_HDR + packed;
+        sp->crc    = Tbcx_Crc32c(0, hdr, (size_t)sp->length);
+        pos += TBCX_FRAME_HDR + packed;
+    }
+    H->flags |= TBCX_HDR_FL_LZ;
+    WriteSectionDirectory(out, H);
+    W_Bytes(out, fr, pos);
+    Tcl_Free((char *)fr);
+}
+
+/* Current write position: bytes already flushed plus bytes still buffered. */
+static inline uint64_t W_Pos(const TbcxOut *w) {
+    return (uint64_t)w->totalBytes + (uint64_t)w->bufPos;
 }
 
 static void DV_Init(DefVec *dv) {
@@ -6243,10 +6617,10 @@ static Tcl_Obj *CaptureAndRewriteScript(Tcl_Interp *ip, const char *script, Tcl_
     return rew;
 }
 
-static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tcl_Obj *sourcePath) {
+static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *out, unsigned saveFlags, Tcl_Obj *sourcePath) {
     int     rc  = TCL_ERROR; /* set to TCL_OK only on success */
     TbcxCtx ctx = {0};
-    ctx.interp     = w->interp;
+    ctx.interp     = out->interp;
     ctx.saveFlags  = saveFlags;
     ctx.sourcePath = sourcePath;
     CtxInitStripBodies(&ctx);
@@ -6258,6 +6632,23 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
     ctx.emittedPtrsInit = 1;
     Tcl_InitHashTable(&ctx.instrBodyLits, TCL_ONE_WORD_KEYS);
     ctx.instrBodyInit = 1;
+    Tcl_InitHashTable(&ctx.blockIndex, TCL_ONE_WORD_KEYS);
+    ctx.blockIndexInit = 1;
+
+    /* Section bodies are staged in memory so the header can carry the
+       section directory (v93) ahead of them; `w` is that staging writer and
+       only the header, directory, string table and final copy go to `out`.
+       Heap-allocated because TbcxOut embeds a TBCX_BUFSIZE buffer.  String
+       refs written while staging collect in strs. */
+    TbcxHeader   dir;
+    TbcxSection *secs = NULL;
+    uint32_t     sec  = 1; /* entry 0 is the string table */
+    memset(&dir, 0, sizeof(dir));
+    TbcxStrPool strs;
+    StrPoolInit(&strs);
+    TbcxOut *w = (TbcxOut *)Tcl_Alloc(sizeof(TbcxOut));
+    Tbcx_W_InitMem(w, out->interp);
+    w->strs = &strs;
 
     DefVec defs;
     DV_Init(&defs);
@@ -6376,17 +6767,44 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
     }
     PrecompileLiteralPool(&ctx, top);
 
-    /* 3. Header */
-    WriteHeaderTop(w, &ctx, srcCopy);
-    if (w->err)
+    /* 3. Header (fixed fields + sourcePath; the directory follows once the
+       section sizes are known) */
+    WriteHeaderTop(out, &ctx, srcCopy);
+    if (out->err)
+        goto cleanup;
+
+    /* One directory entry for the string table, the top block, each proc,
+       the classes table and each method, in stream order. */
+    uint32_t numProcs = 0, numMethods = 0;
+    for (Tcl_Size i = 0; i < defs.n; i++) {
+        if (defs.v[i].kind == DEF_KIND_PROC)
+            numProcs++;
+        else
+            numMethods++;
+    }
+    dir.flags       = (ctx.saveFlags & TBCX_SAVE_FL_INCLUDE_SOURCE) ? TBCX_HDR_FL_SOURCE : 0u;
+    if (ctx.saveFlags & TBCX_SAVE_FL_NATIVE)
+        dir.flags |= TBCX_HDR_FL_NATIVE | (Tbcx_NativeAbi() << TBCX_HDR_ABI_SHIFT);
+    dir.numProcs    = numProcs;
+    dir.numMethods  = numMethods;
+    dir.numSections = 3u + numProcs + numMethods;
+    secs            = (TbcxSection *)Tcl_AttemptAlloc(sizeof(TbcxSection) * dir.numSections);
+    if (!secs) {
+        W_Error(w, "tbcx: allocation failed (section directory)");
         goto cleanup;
+    }
+    dir.sections = secs;
+#define SEC_BEGIN(k) (secs[sec].kind = (k), secs[sec].offset = W_Pos(w))
+#define SEC_END() (secs[sec].length = W_Pos(w) - secs[sec].offset, sec++)
 
     /* 4. Top-level compiled block */
+    SEC_BEGIN(TBCX_SEC_TOP);
     ctx.stripActive = 1;
     WriteCompiledBlock(w, &ctx, srcCopy);
     ctx.stripActive = 0;
     if (w->err)
         goto cleanup;
+    SEC_END();
 
     /* 5. Procs section: nameFqn, namespace, args, srcText, block
      *    srcText is the original proc body as authored — attached at load
@@ -6396,23 +6814,19 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
      *    correctly.  Only emitted when -include-source was specified;
      *    otherwise the field is written empty and the loader
      *    substitutes a diagnostic sentinel. */
-    uint32_t numProcs = 0;
-    for (Tcl_Size i = 0; i < defs.n; i++) {
-        if (defs.v[i].kind == DEF_KIND_PROC)
-            numProcs++;
-    }
-    W_U32(w, numProcs);
+    W_Var(w, numProcs);
     for (Tcl_Size i = 0; i < defs.n; i++)
         if (defs.v[i].kind == DEF_KIND_PROC) {
+            SEC_BEGIN(TBCX_SEC_PROC);
             /* Serialize FQN/name, ns, args */
             Tcl_Size    ln;
             const char *s;
             s = Tbcx_GetStringFromObjSafe(defs.v[i].name, &ln);
-            W_LPString(w, s, ln);
+            W_StrRef(w, s, ln);
             s = Tbcx_GetStringFromObjSafe(defs.v[i].ns, &ln);
-            W_LPString(w, s, ln);
+            W_StrRef(w, s, ln);
             s = Tbcx_GetStringFromObjSafe(defs.v[i].args, &ln);
-            W_LPString(w, s, ln);
+            W_StrRef(w, s, ln);
 
             /* Body source text.  Emitted before the compiled block
              * so the loader can read+allocate the string up front and
@@ -6430,6 +6844,7 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
                 if (CompileProcLike(w, &ctx, defs.v[i].ns, defs.v[i].args, defs.v[i].body, "body of proc") != TCL_OK)
                     goto cleanup;
             }
+            SEC_END();
         }
 
     /* 6. Classes section (FQN + nSupers=0 for now) — use unique set.
@@ -6442,7 +6857,9 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
         for (h = Tcl_FirstHashEntry(&classes.ht, &srch); h; h = Tcl_NextHashEntry(&srch)) {
             numClasses++;
         }
-        W_U32(w, numClasses);
+        dir.numClasses = numClasses;
+        SEC_BEGIN(TBCX_SEC_CLASSES);
+        W_Var(w, numClasses);
         if (numClasses > 0) {
             /* Collect keys, sort, then emit for reproducibility */
             size_t keyBytes = 0;
@@ -6458,12 +6875,13 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
             qsort(keys, (size_t)numClasses, sizeof(const char *), CmpStrPtr_qsort);
             for (ki = 0; ki < numClasses; ki++) {
                 Tcl_Size ln = (Tcl_Size)strlen(keys[ki]);
-                W_LPString(w, keys[ki], ln);
-                W_U32(w, 0); /* nSupers */
+                W_StrRef(w, keys[ki], ln);
+                W_Var(w, 0); /* nSupers */
             }
             Tcl_Free((char *)keys);
         }
-    done_classes:;
+    done_classes:
+        SEC_END();
     }
 
     /* 7-pre0. Per-object self/class methods are not representable.  A `self
@@ -6492,19 +6910,15 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
        distinctly at load and coexist. */
 
     /* 7. Methods section: emit captured OO methods/ctors/dtors */
-    uint32_t numMethods = 0;
-    for (Tcl_Size i = 0; i < defs.n; i++) {
-        if (defs.v[i].kind != DEF_KIND_PROC)
-            numMethods++;
-    }
-    W_U32(w, numMethods);
+    W_Var(w, numMethods);
     for (Tcl_Size i = 0; i < defs.n; i++)
         if (defs.v[i].kind != DEF_KIND_PROC) {
+            SEC_BEGIN(TBCX_SEC_METHOD);
             Tcl_Size    ln;
             const char *s;
             /* classFqn */
             s = Tbcx_GetStringFromObjSafe(defs.v[i].cls, &ln);
-            W_LPString(w, s, ln);
+            W_StrRef(w, s, ln);
             /* wire kind 0..4 expected by loader (inst=0, class=1, ctor=2, dtor=3, self=4) */
             {
                 uint8_t wireKind = (uint8_t)(defs.v[i].kind - DEF_KIND_INST);
@@ -6530,14 +6944,14 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
             W_U8(w, (uint8_t)((defs.v[i].flags & DEF_F_OBJDEFINE) ? TBCX_MORIGIN_OBJECT : TBCX_MORIGIN_CLASS));
             /* name (empty for ctor/dtor) */
             if (defs.v[i].kind == DEF_KIND_CTOR || defs.v[i].kind == DEF_KIND_DTOR) {
-                W_LPString(w, "", 0);
+                W_StrRef(w, "", 0);
             } else {
                 s = Tbcx_GetStringFromObjSafe(defs.v[i].name, &ln);
-                W_LPString(w, s, ln);
+                W_StrRef(w, s, ln);
             }
             /* args */
             s = Tbcx_GetStringFromObjSafe(defs.v[i].args, &ln);
-            W_LPString(w, s, ln);
+            W_StrRef(w, s, ln);
 
             /* Body source text — see Procs-section comment above.
              * Applies identically to inst, class, ctor, dtor, and self
@@ -6555,12 +6969,56 @@ static int EmitTbcxStream(Tcl_Obj *scriptObj, TbcxOut *w, unsigned saveFlags, Tc
             /* Compile & emit block (proc semantics) */
             if (CompileProcLike(w, &ctx, defs.v[i].cls, defs.v[i].args, defs.v[i].body, "body of method") != TCL_OK)
                 goto cleanup;
+            SEC_END();
         }
+#undef SEC_BEGIN
+#undef SEC_END
 
-    Tbcx_W_Flush(w); /* flush buffered writes before returning */
-    rc = (w->err == TCL_OK) ? TCL_OK : TCL_ERROR;
+    /* 8. Directory, string table, then the staged sections verbatim.  The
+       table is only complete now, so the staged offsets move up past it. */
+    Tbcx_W_Flush(w);
+    if (w->err)
+        goto cleanup;
+    if (ctx.numBlockRefs)
+        dir.flags |= TBCX_HDR_FL_DEDUP;
+    secs[0].kind = TBCX_SEC_STRINGS;
+    {
+        /* Stage the table too: every section is checksummed (and, with
+         * -compress, compressed) on its own. */
+        TbcxOut *tw = (TbcxOut *)Tcl_Alloc(sizeof(TbcxOut));
+        Tbcx_W_InitMem(tw, out->interp);
+        WriteStrTab(tw, &strs);
+        Tbcx_W_Flush(tw);
+        if (tw->err) {
+            out->err = tw->err;
+        } else if (ctx.saveFlags & TBCX_SAVE_FL_COMPRESS) {
+            WriteCompressedSections(out, &dir, tw->mem, tw->memLen, w->mem);
+        } else {
+            secs[0].offset = 0;
+            secs[0].length = tw->memLen;
+            secs[0].crc    = Tbcx_Crc32c(0, tw->mem, tw->memLen);
+            for (uint32_t k = 1; k < dir.numSections; k++) {
+                secs[k].crc = Tbcx_Crc32c(0, w->mem + secs[k].offset, (size_t)secs[k].length);
+                secs[k].offset += secs[0].length;
+            }
+            WriteSectionDirectory(out, &dir);
+            W_Bytes(out, tw->mem, tw->memLen);
+            W_Bytes(out, w->mem, w->memLen);
+        }
+        Tbcx_W_FreeMem(tw);
+        Tcl_Free((char *)tw);
+    }
+    Tbcx_W_Flush(out); /* flush buffered writes before returning */
+    rc = (out->err == TCL_OK) ? TCL_OK : TCL_ERROR;
 
 cleanup:
+    if (w->err && out->err == TCL_OK)
+        out->err = w->err; /* staging failures are the caller's failures */
+    Tbcx_W_FreeMem(w);
+    Tcl_Free((char *)w);
+    StrPoolFree(&strs);
+    if (secs)
+        Tcl_Free((char *)secs);
     DV_Free(&defs);
     CS_Free(&classes);
     Tcl_DecrRefCount(srcCopy);
@@ -6574,6 +7032,10 @@ cleanup:
         Tcl_DeleteHashTable(&ctx.emittedPtrs);
     if (ctx.instrBodyInit)
         Tcl_DeleteHashTable(&ctx.instrBodyLits);
+    if (ctx.blockIndexInit)
+        Tcl_DeleteHashTable(&ctx.blockIndex);
+    if (ctx.blockRecs)
+        Tcl_Free((char *)ctx.blockRecs);
     return rc;
 }
 
@@ -6644,6 +7106,128 @@ static int ReadAllFromChannel(Tcl_Interp *interp, Tcl_Channel ch, Tcl_Obj **outO
     return TCL_OK;
 }
 
+/* ReadScriptFile — read the script file at pathObj as text (default UTF-8
+ * for Tcl 9.1; binary mode would mishandle multi-byte sequences in
+ * Tcl_ReadChars).  *scriptOut and *sourcePathOut receive new references;
+ * the latter is the normalized path, recorded in the header so `info
+ * script` returns the authored .tcl path at load time — matching source
+ * semantics. */
+static int ReadScriptFile(Tcl_Interp *interp, Tcl_Obj *pathObj, Tcl_Obj **scriptOut, Tcl_Obj **sourcePathOut) {
+    Tcl_Channel tmp = Tcl_FSOpenFileChannel(interp, pathObj, "r", 0);
+    if (!tmp)
+        return TCL_ERROR;
+    Tcl_Obj *script = NULL;
+    if (ReadAllFromChannel(interp, tmp, &script) != TCL_OK) {
+        Tcl_Close(interp, tmp);
+        return TCL_ERROR;
+    }
+    if (Tcl_Close(interp, tmp) != TCL_OK) {
+        Tcl_DecrRefCount(script);
+        return TCL_ERROR;
+    }
+    Tcl_Obj *sourcePath = Tcl_FSGetNormalizedPath(interp, pathObj);
+    if (!sourcePath) {
+        sourcePath = pathObj; /* fallback to as-given */
+    }
+    Tcl_IncrRefCount(sourcePath);
+    *scriptOut     = script;
+    *sourcePathOut = sourcePath;
+    return TCL_OK;
+}
+
+/* Tbcx_SaveFile — compile the script file at pathObj into w, which the
+ * caller set up (usually with Tbcx_W_InitMem), exactly as `tbcx::save path
+ * ...` would.  *sourcePathOut receives the recorded source path (a new
+ * reference) on success. */
+int Tbcx_SaveFile(Tcl_Interp *interp, Tcl_Obj *pathObj, unsigned saveFlags, TbcxOut *w, Tcl_Obj **sourcePathOut) {
+    Tcl_Obj *script     = NULL;
+    Tcl_Obj *sourcePath = NULL;
+    if (ReadScriptFile(interp, pathObj, &script, &sourcePath) != TCL_OK)
+        return TCL_ERROR;
+    int rc = EmitTbcxStream(script, w, saveFlags, sourcePath);
+    Tcl_DecrRefCount(script);
+    if (rc != TCL_OK) {
+        Tcl_DecrRefCount(sourcePath);
+        return rc;
+    }
+    *sourcePathOut = sourcePath;
+    return TCL_OK;
+}
+
+/* Tbcx_OpenTempOutput — open a uniquely named temp file beside outObj for
+ * an atomic write, in binary mode.  Returns the channel with *tmpPathOut
+ * holding a new reference to its path, or NULL with the interp result
+ * set.  Finish with Tbcx_CommitTempOutput. */
+Tcl_Channel Tbcx_OpenTempOutput(Tcl_Interp *interp, Tcl_Obj *outObj, Tcl_Obj **tmpPathOut) {
+    Tcl_Obj *outNorm = Tcl_FSGetNormalizedPath(interp, outObj);
+    if (!outNorm)
+        return NULL;
+    Tcl_Obj *tmpPath = Tcl_DuplicateObj(outNorm);
+    /* Generate a unique temp name to prevent races between concurrent
+       saves targeting the same destination. */
+    {
+        Tcl_MutexLock(&tbcxSaveTmpMutex);
+        uint64_t myTmpId = tbcxSaveTmpId++;
+        Tcl_MutexUnlock(&tbcxSaveTmpMutex);
+        Tcl_Obj *suffix = Tcl_ObjPrintf(".tbcx.%" PRIu64 ".tmp", myTmpId);
+        Tcl_IncrRefCount(suffix);
+        Tcl_AppendObjToObj(tmpPath, suffix);
+        Tcl_DecrRefCount(suffix);
+    }
+    Tcl_IncrRefCount(tmpPath);
+    Tcl_Channel ch = Tcl_FSOpenFileChannel(interp, tmpPath, "w", 0666);
+    if (!ch) {
+        Tcl_DecrRefCount(tmpPath);
+        return NULL;
+    }
+    if (Tbcx_CheckBinaryChan(interp, ch) != TCL_OK) {
+        Tcl_Close(interp, ch);
+        Tcl_FSDeleteFile(tmpPath);
+        Tcl_DecrRefCount(tmpPath);
+        return NULL;
+    }
+    *tmpPathOut = tmpPath;
+    return ch;
+}
+
+/* Tbcx_CommitTempOutput — close a Tbcx_OpenTempOutput channel and, when rc
+ * is TCL_OK, rename the temp file onto outObj and leave the normalized
+ * output path as the interp result.  Otherwise (or when closing or
+ * renaming fails) the temp file is removed, so a failed write never
+ * leaves a truncated file at the final path.  Releases tmpPath; returns
+ * the final status. */
+int Tbcx_CommitTempOutput(Tcl_Interp *interp, Tcl_Channel ch, Tcl_Obj *tmpPath, Tcl_Obj *outObj, int rc) {
+    if (Tcl_Close(interp, ch) != TCL_OK)
+        rc = TCL_ERROR;
+    if (rc == TCL_OK) {
+        Tcl_Obj *outNorm = Tcl_FSGetNormalizedPath(interp, outObj);
+        if (!outNorm) {
+            /* Normalization failed — e.g. parent directory was deleted
+             * between write and rename.  Clean up temp and report. */
+            Tcl_FSDeleteFile(tmpPath);
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx: cannot normalize output path \"%s\"", Tbcx_GetStringSafe(outObj)));
+            rc = TCL_ERROR;
+        } else if (Tcl_FSRenameFile(tmpPath, outNorm) == TCL_OK) {
+            Tcl_SetObjResult(interp, outNorm);
+        } else {
+            /* Rename failed — clean up temp and report */
+            Tcl_FSDeleteFile(tmpPath);
+            {
+                Tcl_Size errLen = 0;
+                (void)Tbcx_GetStringFromObjSafe(Tcl_GetObjResult(interp), &errLen);
+                if (errLen == 0)
+                    Tcl_SetObjResult(interp, Tcl_NewStringObj("tbcx: failed to rename temp file to output path", -1));
+            }
+            rc = TCL_ERROR;
+        }
+    } else {
+        /* Serialization failed — remove the partial temp file */
+        Tcl_FSDeleteFile(tmpPath);
+    }
+    Tcl_DecrRefCount(tmpPath);
+    return rc;
+}
+
 int Tbcx_ProbeOpenChannel(Tcl_Interp *interp, Tcl_Obj *obj, Tcl_Channel *chPtr) {
     const char *name = Tbcx_GetStringSafe(obj);
     /* Tcl_GetChannel may set error state; clear it if we fail, since we’ll try other forms. */
@@ -6673,12 +7257,15 @@ int Tbcx_ProbeReadableFile(Tcl_Interp *interp, Tcl_Obj *pathObj) {
 /* ==========================================================================
  * Tcl command: tbcx::save
  *
- * Synopsis:   tbcx::save in out
+ * Synopsis:   tbcx::save in out|-tobytes ?-include-source? ?-compress? ?-native?
  * Arguments:  in  — Tcl script source: an open channel name, a filesystem
  *                    path to a .tcl file, or a literal script string.
  *             out — output destination: an open binary channel name, or a
  *                    filesystem path (written atomically via temp+rename).
- * Returns:    On success, the output path or channel name.
+ *                    The literal word -tobytes in this position builds the
+ *                    artifact in memory instead.
+ * Returns:    On success, the output path or channel name; with -tobytes,
+ *             the artifact as a byte array (feed to tbcx::loadbytes).
  * Errors:     TCL_ERROR on read/write failure, compilation failure, or
  *             unsupported AuxData types.  Sets interp result with details.
  * Thread:     Must be called on the interp-owning thread.  Uses
@@ -6689,9 +7276,9 @@ int Tbcx_SaveObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
     TBCX_CHECK_INTERP_THREAD(interp);
 
     /* Argument grammar:
-     *     tbcx::save in out ?-include-source?
+     *     tbcx::save in out|-tobytes ?-include-source? ?-compress? ?-native?
      *
-     * The optional flag is positional-after-args.  Any unrecognized
+     * The optional flags are positional-after-args, in any order.  Any unrecognized
      * trailing token is reported with the same error style as
      * Tcl_WrongNumArgs.
      *
@@ -6712,11 +7299,24 @@ int Tbcx_SaveObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
      *                   annotations, or any introspection-based clone
      *                   (cloneRule / `info class definition` / etc.).
      *                   Artifact size grows proportional to the
-     *                   aggregate source text of all procs + methods. */
-    if (objc < 3 || objc > 4) {
-        Tcl_WrongNumArgs(interp, 1, objv, "in out ?-include-source?");
+     *                   aggregate source text of all procs + methods.
+     *
+     * -compress : store every section as an independently compressed
+     *                   frame (tbcxlz.c).  Loaders inflate transparently;
+     *                   the section directory addresses the frames.
+     *
+     * -native : store every compiled block in the loader's ByteCode
+     *                   layout, code and exception ranges as host bytes.
+     *                   Faster to materialize; loads only on hosts with
+     *                   the same ABI tag (TBCX_HDR_ABI_*).
+     *
+     * -tobytes (in the out position) : no channel or file is touched; the
+     *                   artifact is returned as a byte array. */
+    if (objc < 3 || objc > 6) {
+        Tcl_WrongNumArgs(interp, 1, objv, "in out|-tobytes ?-include-source? ?-compress? ?-native?");
         return TCL_ERROR;
     }
+    int toBytes = (strcmp(Tbcx_GetStringSafe(objv[2]), "-tobytes") == 0);
     unsigned saveFlags = 0;
     for (Tcl_Size i = 3; i < objc; i++) {
         const char *flag = Tbcx_GetStringStrict(interp, objv[i]);
@@ -6725,10 +7325,14 @@ int Tbcx_SaveObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
         }
         if (strcmp(flag, "-include-source") == 0) {
             saveFlags |= TBCX_SAVE_FL_INCLUDE_SOURCE;
+        } else if (strcmp(flag, "-compress") == 0) {
+            saveFlags |= TBCX_SAVE_FL_COMPRESS;
+        } else if (strcmp(flag, "-native") == 0) {
+            saveFlags |= TBCX_SAVE_FL_NATIVE;
         } else {
             Tcl_SetObjResult(interp,
                 Tcl_ObjPrintf("tbcx::save: unknown option \"%s\"; "
-                              "expected -include-source", flag));
+                              "expected -include-source, -compress or -native", flag));
             return TCL_ERROR;
         }
     }
@@ -6750,32 +7354,26 @@ int Tbcx_SaveObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
             return TCL_ERROR;
         }
     } else if (Tbcx_ProbeReadableFile(interp, inObj)) {
-        /* Open in text mode (default UTF-8 encoding for Tcl 9.1) so that
-           the script is properly decoded.  Binary mode would mishandle
-           multi-byte UTF-8 sequences in Tcl_ReadChars. */
-        Tcl_Channel tmp = Tcl_FSOpenFileChannel(interp, inObj, "r", 0);
-        if (!tmp)
+        if (ReadScriptFile(interp, inObj, &script, &sourcePath) != TCL_OK)
             return TCL_ERROR;
-        if (ReadAllFromChannel(interp, tmp, &script) != TCL_OK) {
-            Tcl_Close(interp, tmp);
-            return TCL_ERROR;
-        }
-        if (Tcl_Close(interp, tmp) != TCL_OK) {
-            Tcl_DecrRefCount(script);
-            return TCL_ERROR;
-        }
-        /* Record the normalized source path so `info script` returns the
-         * authored .tcl path at load time — matching source semantics. */
-        sourcePath = Tcl_FSGetNormalizedPath(interp, inObj);
-        if (!sourcePath) {
-            sourcePath = inObj; /* fallback to as-given */
-        }
-        Tcl_IncrRefCount(sourcePath);
     } else {
         script = inObj;
         Tcl_IncrRefCount(script);
     }
 
+    if (toBytes) {
+        TbcxOut w;
+        Tbcx_W_InitMem(&w, interp);
+        rc = EmitTbcxStream(script, &w, saveFlags, sourcePath);
+        Tcl_DecrRefCount(script);
+        if (sourcePath)
+            Tcl_DecrRefCount(sourcePath);
+        if (rc == TCL_OK)
+            Tcl_SetObjResult(interp, Tcl_NewByteArrayObj(w.mem, (Tcl_Size)w.memLen));
+        Tbcx_W_FreeMem(&w);
+        return rc;
+    }
+
     Tcl_Channel outCh       = NULL;
     int         weOpenedOut = 0;
     Tcl_Obj    *tmpPath     = NULL; /* temp file path for atomic write (weOpenedOut only) */
@@ -6790,38 +7388,12 @@ int Tbcx_SaveObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
         /* Treat as path; write to a temp file in the same directory and
            rename on success so a failed serialization never leaves a
            truncated .tbcx at the final path. */
-        Tcl_Obj *outNorm = Tcl_FSGetNormalizedPath(interp, outObj);
-        if (!outNorm) {
-            Tcl_DecrRefCount(script);
-            return TCL_ERROR;
-        }
-        tmpPath = Tcl_DuplicateObj(outNorm);
-        /* Generate a unique temp name to prevent races between concurrent
-           tbcx::save calls targeting the same destination. */
-        {
-            Tcl_MutexLock(&tbcxSaveTmpMutex);
-            uint64_t myTmpId = tbcxSaveTmpId++;
-            Tcl_MutexUnlock(&tbcxSaveTmpMutex);
-            Tcl_Obj *suffix = Tcl_ObjPrintf(".tbcx.%" PRIu64 ".tmp", myTmpId);
-            Tcl_IncrRefCount(suffix);
-            Tcl_AppendObjToObj(tmpPath, suffix);
-            Tcl_DecrRefCount(suffix);
-        }
-        Tcl_IncrRefCount(tmpPath);
-        outCh = Tcl_FSOpenFileChannel(interp, tmpPath, "w", 0666);
+        outCh = Tbcx_OpenTempOutput(interp, outObj, &tmpPath);
         if (!outCh) {
-            Tcl_DecrRefCount(tmpPath);
             Tcl_DecrRefCount(script);
             return TCL_ERROR;
         }
         weOpenedOut = 1;
-        if (Tbcx_CheckBinaryChan(interp, outCh) != TCL_OK) {
-            Tcl_Close(interp, outCh);
-            Tcl_FSDeleteFile(tmpPath);
-            Tcl_DecrRefCount(tmpPath);
-            Tcl_DecrRefCount(script);
-            return TCL_ERROR;
-        }
     }
 
     TbcxOut w;
@@ -6833,42 +7405,9 @@ int Tbcx_SaveObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_O
         sourcePath = NULL;
     }
 
-    if (weOpenedOut) {
-        if (Tcl_Close(interp, outCh) != TCL_OK)
-            rc = TCL_ERROR;
-    }
-
-    if (rc == TCL_OK) {
-        if (weOpenedOut) {
-            /* Atomic rename: temp -> final destination */
-            Tcl_Obj *outNorm = Tcl_FSGetNormalizedPath(interp, outObj);
-            if (!outNorm) {
-                /* Normalization failed — e.g. parent directory was deleted
-                 * between write and rename.  Clean up temp and report. */
-                Tcl_FSDeleteFile(tmpPath);
-                Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx: cannot normalize output path \"%s\"", Tbcx_GetStringSafe(outObj)));
-                rc = TCL_ERROR;
-            } else if (Tcl_FSRenameFile(tmpPath, outNorm) == TCL_OK) {
-                Tcl_SetObjResult(interp, outNorm);
-            } else {
-                /* Rename failed — clean up temp and report */
-                Tcl_FSDeleteFile(tmpPath);
-                {
-                    Tcl_Size errLen = 0;
-                    (void)Tbcx_GetStringFromObjSafe(Tcl_GetObjResult(interp), &errLen);
-                    if (errLen == 0)
-                        Tcl_SetObjResult(interp, Tcl_NewStringObj("tbcx: failed to rename temp file to output path", -1));
-                }
-                rc = TCL_ERROR;
-            }
-            Tcl_DecrRefCount(tmpPath);
-        } else {
-            Tcl_SetObjResult(interp, outObj);
-        }
-    } else if (weOpenedOut) {
-        /* Serialization failed — remove the partial temp file */
-        Tcl_FSDeleteFile(tmpPath);
-        Tcl_DecrRefCount(tmpPath);
-    }
+    if (weOpenedOut)
+        return Tbcx_CommitTempOutput(interp, outCh, tmpPath, outObj, rc);
+    if (rc == TCL_OK)
+        Tcl_SetObjResult(interp, outObj);
     return rc;
 }
@@ -0,0 +1,532 @@
+/* ==========================================================================
+ * tbcxtrust.c — Trusted-artifact store for .tbcx (Tcl 9.1)
+ *
+ * The loader treats every artifact as hostile: section checksums, then
+ * shape checks on exception ranges and on the names it defines.  An
+ * artifact a build pipeline produced itself does not need them.  tbcx::trust
+ * registers such artifacts by the SHA-256 of their bytes; a load whose
+ * whole-artifact hash is registered skips the checksums and the structural
+ * checks, and anything else keeps the checked path.  SHA-256 rather than
+ * CRC32C because the store vouches for content: a collision would let a
+ * crafted file past the checks.
+ *
+ * The store is process-wide, like the artifact cache: a table of hex
+ * digests under tbcxTrustMutex.  Safe interps never see tbcx::trust.
+ *
+ * Hashing costs more than the checksums it saves, so a load hashes only
+ * an artifact a registered digest could match.  Digests registered from
+ * files (tbcx::trust file) carry the artifact's length, and a load whose
+ * length is not among them is not hashed at all.  A bare digest (add,
+ * load) has no length: while one is registered, every memory load is
+ * hashed.
+ * ========================================================================== */
+
+#include "tbcx.h"
+
+TCL_DECLARE_MUTEX(tbcxTrustMutex);
+
+/* All below guarded by tbcxTrustMutex, except trustEntries and
+ * trustUnsized, which loads read without it to skip hashing while the
+ * store is empty, or to skip the length probe while any length goes. */
+static Tcl_HashTable trustTable;  /* 64 hex digits -> artifact length + 1, or 0 if unknown */
+static Tcl_HashTable trustSizes;  /* artifact length -> digests of that length */
+static int           trustInit;
+static Tcl_WideInt   trustHits;
+static atomic_size_t trustEntries;
+static atomic_size_t trustUnsized; /* digests registered without a length */
+
+#define TBCX_TRUST_UNSIZED ((size_t)-1)
+
+/* ==========================================================================
+ * Forward Declarations
+ * ========================================================================== */
+
+static void Sha256Block(uint32_t st[8], const unsigned char *p);
+static void TrustHex(const unsigned char hash[TBCX_SHA256_LEN], char hex[2 * TBCX_SHA256_LEN + 1]);
+static int  TrustParseHex(const char *s, Tcl_Size n, char hex[2 * TBCX_SHA256_LEN + 1]);
+static int  TrustAddLocked(const char *hex, size_t len);
+static void TrustSizeRefLocked(size_t len, int delta);
+static void TrustRemoveLocked(Tcl_HashEntry *e);
+static void TrustResetLocked(void);
+static int  TrustKeyCmp(const void *a, const void *b);
+static void TrustFinalize(void *cd);
+static int  TrustHashFile(Tcl_Interp *interp, Tcl_Obj *pathObj, unsigned char hash[TBCX_SHA256_LEN], size_t *lenOut);
+static int  TrustLoadFile(Tcl_Interp *interp, Tcl_Obj *pathObj);
+int         Tbcx_TrustObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]);
+
+/* ==========================================================================
+ * SHA-256 (FIPS 180-4)
+ * ========================================================================== */
+
+static const uint32_t sha256K[64] = {
+    0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu, 0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u, 0xd807aa98u, 0x12835b01u, 0x243185beu, 0x550c7dc3u, 0x72be5d74u,
+    0x80deb1feu, 0x9bdc06a7u, 0xc19bf174u, 0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu, 0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau, 0x983e5152u, 0xa831c66du,
+    0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u, 0x06ca6351u, 0x14292967u, 0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu, 0x53380d13u, 0x650a7354u, 0x766a0abbu, 0x81c2c92eu,
+    0x92722c85u, 0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u, 0xd192e819u, 0xd6990624u, 0xf40e3585u, 0x106aa070u, 0x19a4c116u, 0x1e376c08u, 0x2748774cu, 0x34b0bcb5u,
+    0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu, 0x682e6ff3u, 0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u, 0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u};
+
+#define SHA_ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void Sha256Block(uint32_t st[8], const unsigned char *p) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+        w[i] = ((uint32_t)p[4 * i] << 24) | ((uint32_t)p[4 * i + 1] << 16) | ((uint32_t)p[4 * i + 2] << 8) | (uint32_t)p[4 * i + 3];
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = SHA_ROR(w[i - 15], 7) ^ SHA_ROR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = SHA_ROR(w[i - 2], 17) ^ SHA_ROR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i]        = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = st[0], b = st[1], c = st[2], d = st[3], e = st[4], f = st[5], g = st[6], h = st[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (SHA_ROR(e, 6) ^ SHA_ROR(e, 11) ^ SHA_ROR(e, 25)) + ((e & f) ^ (~e & g)) + sha256K[i] + w[i];
+        uint32_t t2 = (SHA_ROR(a, 2) ^ SHA_ROR(a, 13) ^ SHA_ROR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h           = g;
+        g           = f;
+        f           = e;
+        e           = d + t1;
+        d           = c;
+        c           = b;
+        b           = a;
+        a           = t1 + t2;
+    }
+    st[0] += a;
+    st[1] += b;
+    st[2] += c;
+    st[3] += d;
+    st[4] += e;
+    st[5] += f;
+    st[6] += g;
+    st[7] += h;
+}
+
+/* Tbcx_Sha256 — SHA-256 of [p, p + n) into hash. */
+void Tbcx_Sha256(const void *p, size_t n, unsigned char hash[TBCX_SHA256_LEN]) {
+    uint32_t st[8] = {0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au, 0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u};
+    const unsigned char *s    = (const unsigned char *)p;
+    size_t               left = n;
+    for (; left >= 64; s += 64, left -= 64)
+        Sha256Block(st, s);
+    unsigned char tail[128];
+    memset(tail, 0, sizeof(tail));
+    memcpy(tail, s, left);
+    tail[left]    = 0x80;
+    size_t   tlen = left < 56 ? 64 : 128;
+    uint64_t bits = (uint64_t)n * 8;
+    for (int i = 0; i < 8; i++)
+        tail[tlen - 1 - i] = (unsigned char)(bits >> (8 * i));
+    Sha256Block(st, tail);
+    if (tlen == 128)
+        Sha256Block(st, tail + 64);
+    for (int i = 0; i < 8; i++) {
+        hash[4 * i]     = (unsigned char)(st[i] >> 24);
+        hash[4 * i + 1] = (unsigned char)(st[i] >> 16);
+        hash[4 * i + 2] = (unsigned char)(st[i] >> 8);
+        hash[4 * i + 3] = (unsigned char)st[i];
+    }
+}
+
+/* ==========================================================================
+ * Store
+ * ========================================================================== */
+
+static void TrustHex(const unsigned char hash[TBCX_SHA256_LEN], char hex[2 * TBCX_SHA256_LEN + 1]) {
+    static const char digits[] = "0123456789abcdef";
+    for (int i = 0; i < TBCX_SHA256_LEN; i++) {
+        hex[2 * i]     = digits[hash[i] >> 4];
+        hex[2 * i + 1] = digits[hash[i] & 15];
+    }
+    hex[2 * TBCX_SHA256_LEN] = '\0';
+}
+
+/* TrustParseHex — s as a lower-case digest in hex; 0 unless it is exactly
+ * 64 hex digits. */
+static int TrustParseHex(const char *s, Tcl_Size n, char hex[2 * TBCX_SHA256_LEN + 1]) {
+    if (n != 2 * TBCX_SHA256_LEN)
+        return 0;
+    for (Tcl_Size i = 0; i < n; i++) {
+        char c = s[i];
+        if (c >= 'A' && c <= 'F')
+            c = (char)(c - 'A' + 'a');
+        if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f')))
+            return 0;
+        hex[i] = c;
+    }
+    hex[n] = '\0';
+    return 1;
+}
+
+/* TrustAddLocked — register hex, with the artifact's length unless len is
+ * TBCX_TRUST_UNSIZED.  A digest registered bare and later with its length
+ * keeps the length. */
+static int TrustAddLocked(const char *hex, size_t len) {
+    if (!trustInit) {
+        Tcl_InitHashTable(&trustTable, TCL_STRING_KEYS);
+        Tcl_InitHashTable(&trustSizes, TCL_ONE_WORD_KEYS);
+        trustInit = 1;
+        Tcl_CreateExitHandler(TrustFinalize, NULL);
+    }
+    int            isNew;
+    Tcl_HashEntry *e = Tcl_CreateHashEntry(&trustTable, hex, &isNew);
+    if (isNew) {
+        Tcl_SetHashValue(e, NULL);
+        atomic_fetch_add_explicit(&trustUnsized, 1, memory_order_release);
+        atomic_fetch_add_explicit(&trustEntries, 1, memory_order_release);
+    }
+    if (len != TBCX_TRUST_UNSIZED && Tcl_GetHashValue(e) == NULL) {
+        Tcl_SetHashValue(e, (void *)(uintptr_t)(len + 1));
+        TrustSizeRefLocked(len, 1);
+        atomic_fetch_sub_explicit(&trustUnsized, 1, memory_order_release);
+    }
+    return isNew;
+}
+
+static void TrustSizeRefLocked(size_t len, int delta) {
+    int            isNew;
+    Tcl_HashEntry *e = Tcl_CreateHashEntry(&trustSizes, (void *)(uintptr_t)len, &isNew);
+    uintptr_t      n = (isNew ? 0 : (uintptr_t)Tcl_GetHashValue(e)) + (uintptr_t)(intptr_t)delta;
+    if (n)
+        Tcl_SetHashValue(e, (void *)n);
+    else
+        Tcl_DeleteHashEntry(e);
+}
+
+static void TrustRemoveLocked(Tcl_HashEntry *e) {
+    uintptr_t v = (uintptr_t)Tcl_GetHashValue(e);
+    if (v)
+        TrustSizeRefLocked((size_t)(v - 1), -1);
+    else
+        atomic_fetch_sub_explicit(&trustUnsized, 1, memory_order_release);
+    Tcl_DeleteHashEntry(e);
+    atomic_fetch_sub_explicit(&trustEntries, 1, memory_order_release);
+}
+
+/* TrustResetLocked — forget every digest; the tables stay initialized. */
+static void TrustResetLocked(void) {
+    if (trustInit) {
+        Tcl_DeleteHashTable(&trustTable);
+        Tcl_DeleteHashTable(&trustSizes);
+        Tcl_InitHashTable(&trustTable, TCL_STRING_KEYS);
+        Tcl_InitHashTable(&trustSizes, TCL_ONE_WORD_KEYS);
+    }
+    atomic_store_explicit(&trustEntries, 0, memory_order_release);
+    atomic_store_explicit(&trustUnsized, 0, memory_order_release);
+}
+
+static int TrustKeyCmp(const void *a, const void *b) {
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+static void TrustFinalize(TCL_UNUSED(void *)) {
+    Tcl_MutexLock(&tbcxTrustMutex);
+    if (trustInit) {
+        Tcl_DeleteHashTable(&trustTable);
+        Tcl_DeleteHashTable(&trustSizes);
+        trustInit = 0;
+    }
+    atomic_store_explicit(&trustEntries, 0, memory_order_release);
+    atomic_store_explicit(&trustUnsized, 0, memory_order_release);
+    Tcl_MutexUnlock(&tbcxTrustMutex);
+}
+
+/* Tbcx_TrustActive — whether any artifact is registered: loads hash their
+ * input only when one is. */
+int Tbcx_TrustActive(void) {
+    return atomic_load_explicit(&trustEntries, memory_order_acquire) != 0;
+}
+
+/* Tbcx_TrustMayMatch — whether an artifact of len bytes could be
+ * registered, i.e. is worth hashing: some digest has that length, or some
+ * digest has no length on record. */
+int Tbcx_TrustMayMatch(size_t len) {
+    if (!Tbcx_TrustActive())
+        return 0;
+    if (atomic_load_explicit(&trustUnsized, memory_order_acquire) != 0)
+        return 1;
+    Tcl_MutexLock(&tbcxTrustMutex);
+    int found = trustInit && Tcl_FindHashEntry(&trustSizes, (void *)(uintptr_t)len) != NULL;
+    Tcl_MutexUnlock(&tbcxTrustMutex);
+    return found;
+}
+
+/* Tbcx_TrustLookup — whether hash is registered.  Counts the hit. */
+int Tbcx_TrustLookup(const unsigned char hash[TBCX_SHA256_LEN]) {
+    char hex[2 * TBCX_SHA256_LEN + 1];
+    TrustHex(hash, hex);
+    Tcl_MutexLock(&tbcxTrustMutex);
+    int found = trustInit && Tcl_FindHashEntry(&trustTable, hex) != NULL;
+    if (found)
+        trustHits++;
+    Tcl_MutexUnlock(&tbcxTrustMutex);
+    return found;
+}
+
+/* ==========================================================================
+ * Files
+ * ========================================================================== */
+
+/* TrustHashFile — the hash a load of the artifact file pathObj checks: of
+ * the artifact's own bytes, so an appended payload (Tbcx_FindPayload) is
+ * hashed without its host file.  *lenOut gets the artifact's length. */
+static int TrustHashFile(Tcl_Interp *interp, Tcl_Obj *pathObj, unsigned char hash[TBCX_SHA256_LEN], size_t *lenOut) {
+    TbcxMap map;
+    if (Tbcx_MapFile(pathObj, &map)) {
+        size_t off, len;
+        Tbcx_FindPayload(map.base, map.len, &off, &len);
+        Tbcx_Sha256(map.base + off, len, hash);
+        Tbcx_UnmapFile(&map);
+        *lenOut = len;
+        return TCL_OK;
+    }
+    Tcl_Channel ch = Tcl_FSOpenFileChannel(interp, pathObj, "r", 0);
+    if (!ch)
+        return TCL_ERROR;
+    Tcl_Obj *data = Tcl_NewObj();
+    Tcl_IncrRefCount(data);
+    int rc = Tbcx_CheckBinaryChan(interp, ch);
+    if (rc == TCL_OK && Tcl_ReadChars(ch, data, -1, 0) < 0) {
+        Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx::trust: error reading \"%s\": %s", Tcl_GetString(pathObj), Tcl_PosixError(interp)));
+        rc = TCL_ERROR;
+    }
+    if (Tcl_Close(interp, ch) != TCL_OK)
+        rc = TCL_ERROR;
+    if (rc == TCL_OK) {
+        Tcl_Size             n = 0;
+        const unsigned char *p = Tbcx_GetByteArrayFromObjStrict(interp, data, &n);
+        size_t               off, len;
+        if (!p) {
+            rc = TCL_ERROR;
+        } else {
+            Tbcx_FindPayload(p, (size_t)n, &off, &len);
+            Tbcx_Sha256(p + off, len, hash);
+            *lenOut = len;
+        }
+    }
+    Tcl_DecrRefCount(data);
+    return rc;
+}
+
+/* TrustLoadFile — register every digest listed in the file pathObj: one
+ * per line, first word (sha256sum output works as is); blank lines and
+ * lines starting with # are skipped.  All or nothing. */
+static int TrustLoadFile(Tcl_Interp *interp, Tcl_Obj *pathObj) {
+    Tcl_Channel ch = Tcl_FSOpenFileChannel(interp, pathObj, "r", 0);
+    if (!ch)
+        return TCL_ERROR;
+    Tcl_Obj *lines = Tcl_NewListObj(0, NULL);
+    Tcl_IncrRefCount(lines);
+    Tcl_Obj *line = Tcl_NewObj();
+    Tcl_IncrRefCount(line);
+    int      rc   = TCL_OK;
+    Tcl_Size lnum = 0;
+    for (;;) {
+        Tcl_SetObjLength(line, 0);
+        if (Tcl_GetsObj(ch, line) < 0)
+            break;
+        lnum++;
+        Tcl_Size    n;
+        const char *s = Tcl_GetStringFromObj(line, &n);
+        while (n && (*s == ' ' || *s == '\t')) {
+            s++;
+            n--;
+        }
+        if (n == 0 || *s == '#')
+            continue;
+        Tcl_Size w = 0;
+        while (w < n && s[w] != ' ' && s[w] != '\t' && s[w] != '\r')
+            w++;
+        char hex[2 * TBCX_SHA256_LEN + 1];
+        if (!TrustParseHex(s, w, hex)) {
+            Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx::trust: bad digest on line %" TCL_SIZE_MODIFIER "d of \"%s\"", lnum, Tcl_GetString(pathObj)));
+            rc = TCL_ERROR;
+            break;
+        }
+        Tcl_ListObjAppendElement(NULL, lines, Tcl_NewStringObj(hex, -1));
+    }
+    if (rc == TCL_OK && !Tcl_Eof(ch)) {
+        Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx::trust: error reading \"%s\": %s", Tcl_GetString(pathObj), Tcl_PosixError(interp)));
+        rc = TCL_ERROR;
+    }
+    if (Tcl_Close(interp, ch) != TCL_OK)
+        rc = TCL_ERROR;
+    if (rc == TCL_OK) {
+        Tcl_Size  n;
+        Tcl_Obj **ev;
+        Tcl_ListObjGetElements(NULL, lines, &n, &ev);
+        Tcl_MutexLock(&tbcxTrustMutex);
+        for (Tcl_Size i = 0; i < n; i++)
+            TrustAddLocked(Tcl_GetString(ev[i]), TBCX_TRUST_UNSIZED);
+        Tcl_MutexUnlock(&tbcxTrustMutex);
+        Tbcx_CacheTrustChanged();
+    }
+    Tcl_DecrRefCount(line);
+    Tcl_DecrRefCount(lines);
+    return rc;
+}
+
+/* ==========================================================================
+ * Tcl command: tbcx::trust
+ *
+ * Synopsis:   tbcx::trust ?subcommand arg ...?
+ * Arguments:  add digest ?digest ...? — register SHA-256 digests (64 hex
+ *                       digits) of artifacts to trust.
+ *             load file — register the digests listed in file, one per
+ *                       line (sha256sum output is accepted as is).
+ *             file path ?path ...? — register the artifact files' digests
+ *                       together with their lengths, so that loads of
+ *                       any other length are not hashed.
+ *             hash path — the digest a load of the artifact file path
+ *                       checks: of the artifact's bytes, without the host
+ *                       file of an appended payload.
+ *             remove digest ?digest ...? — unregister digests.
+ *             list — the registered digests, sorted.
+ *             clear — unregister everything.
+ * Returns:    hash: the digest.  list: a list.  Otherwise (and with no
+ *             subcommand) a dict: entries registered, sized (those with a
+ *             length on record) and hits, the loads that took the trusted
+ *             path since the process started.
+ * Errors:     TCL_ERROR on a malformed digest or an unreadable file; load
+ *             registers nothing unless every line is well formed.
+ * Thread:     Must be called on the interp-owning thread.  The store is
+ *             process-wide: a digest registered by any interp is trusted
+ *             by all of them.
+ * ========================================================================== */
+
+int Tbcx_TrustObjCmd(TCL_UNUSED(void *), Tcl_Interp *interp, Tcl_Size objc, Tcl_Obj *const objv[]) {
+    TBCX_CHECK_INTERP_THREAD(interp);
+    static const char *const subs[] = {"add", "clear", "file", "hash", "list", "load", "remove", NULL};
+    enum { SUB_ADD, SUB_CLEAR, SUB_FILE, SUB_HASH, SUB_LIST, SUB_LOAD, SUB_REMOVE };
+    int idx = -1;
+    if (objc >= 2 && Tcl_GetIndexFromObj(interp, objv[1], subs, "subcommand", 0, &idx) != TCL_OK)
+        return TCL_ERROR;
+
+    switch (idx) {
+    case SUB_ADD:
+    case SUB_REMOVE: {
+        if (objc < 3) {
+            Tcl_WrongNumArgs(interp, 2, objv, "digest ?digest ...?");
+            return TCL_ERROR;
+        }
+        char (*hex)[2 * TBCX_SHA256_LEN + 1] = (char (*)[2 * TBCX_SHA256_LEN + 1])Tcl_Alloc(sizeof(*hex) * (size_t)(objc - 2));
+        for (Tcl_Size i = 2; i < objc; i++) {
+            Tcl_Size    n;
+            const char *s = Tcl_GetStringFromObj(objv[i], &n);
+            if (!TrustParseHex(s, n, hex[i - 2])) {
+                Tcl_Free((char *)hex);
+                Tcl_SetObjResult(interp, Tcl_ObjPrintf("tbcx::trust: bad digest \"%s\": expected 64 hex digits", s));
+                return TCL_ERROR;
+            }
+        }
+        Tcl_MutexLock(&tbcxTrustMutex);
+        for (Tcl_Size i = 2; i < objc; i++) {
+            if (idx == SUB_ADD) {
+                TrustAddLocked(hex[i - 2], TBCX_TRUST_UNSIZED);
+            } else if (trustInit) {
+                Tcl_HashEntry *e = Tcl_FindHashEntry(&trustTable, hex[i - 2]);
+                if (e)
+                    TrustRemoveLocked(e);
+            }
+        }
+        Tcl_MutexUnlock(&tbcxTrustMutex);
+        Tcl_Free((char *)hex);
+        if (idx == SUB_ADD)
+            Tbcx_CacheTrustChanged();
+        break;
+    }
+    case SUB_FILE: {
+        if (objc < 3) {
+            Tcl_WrongNumArgs(interp, 2, objv, "path ?path ...?");
+            return TCL_ERROR;
+        }
+        /* All files are hashed before any is registered: all or nothing. */
+        unsigned char (*hash)[TBCX_SHA256_LEN] = (unsigned char (*)[TBCX_SHA256_LEN])Tcl_Alloc(sizeof(*hash) * (size_t)(objc - 2));
+        size_t *lens = (size_t *)Tcl_Alloc(sizeof(size_t) * (size_t)(objc - 2));
+        for (Tcl_Size i = 2; i < objc; i++) {
+            if (TrustHashFile(interp, objv[i], hash[i - 2], &lens[i - 2]) != TCL_OK) {
+                Tcl_Free((char *)lens);
+                Tcl_Free((char *)hash);
+                return TCL_ERROR;
+            }
+        }
+        Tcl_MutexLock(&tbcxTrustMutex);
+        for (Tcl_Size i = 2; i < objc; i++) {
+            char hex[2 * TBCX_SHA256_LEN + 1];
+            TrustHex(hash[i - 2], hex);
+            TrustAddLocked(hex, lens[i - 2]);
+        }
+        Tcl_MutexUnlock(&tbcxTrustMutex);
+        Tcl_Free((char *)lens);
+        Tcl_Free((char *)hash);
+        Tbcx_CacheTrustChanged();
+        break;
+    }
+    case SUB_LOAD:
+        if (objc != 3) {
+            Tcl_WrongNumArgs(interp, 2, objv, "file");
+            return TCL_ERROR;
+        }
+        if (TrustLoadFile(interp, objv[2]) != TCL_OK)
+            return TCL_ERROR;
+        break;
+    case SUB_HASH: {
+        if (objc != 3) {
+            Tcl_WrongNumArgs(interp, 2, objv, "path");
+            return TCL_ERROR;
+        }
+        unsigned char hash[TBCX_SHA256_LEN];
+        char          hex[2 * TBCX_SHA256_LEN + 1];
+        size_t        len;
+        if (TrustHashFile(interp, objv[2], hash, &len) != TCL_OK)
+            return TCL_ERROR;
+        TrustHex(hash, hex);
+        Tcl_SetObjResult(interp, Tcl_NewStringObj(hex, -1));
+        return TCL_OK;
+    }
+    case SUB_LIST: {
+        if (objc != 2) {
+            Tcl_WrongNumArgs(interp, 2, objv, NULL);
+            return TCL_ERROR;
+        }
+        Tcl_MutexLock(&tbcxTrustMutex);
+        Tcl_Size     n    = trustInit ? trustTable.numEntries : 0;
+        const char **keys = (const char **)Tcl_Alloc(sizeof(char *) * (size_t)(n ? n : 1));
+        Tcl_Obj    **elems = (Tcl_Obj **)Tcl_Alloc(sizeof(Tcl_Obj *) * (size_t)(n ? n : 1));
+        Tcl_Size     k    = 0;
+        if (trustInit) {
+            Tcl_HashSearch hs;
+            for (Tcl_HashEntry *e = Tcl_FirstHashEntry(&trustTable, &hs); e; e = Tcl_NextHashEntry(&hs))
+                keys[k++] = (const char *)Tcl_GetHashKey(&trustTable, e);
+        }
+        qsort(keys, (size_t)k, sizeof(char *), TrustKeyCmp);
+        for (Tcl_Size i = 0; i < k; i++)
+            elems[i] = Tcl_NewStringObj(keys[i], -1);
+        Tcl_MutexUnlock(&tbcxTrustMutex);
+        Tcl_SetObjResult(interp, Tcl_NewListObj(k, elems));
+        Tcl_Free((char *)elems);
+        Tcl_Free((char *)keys);
+        return TCL_OK;
+    }
+    case SUB_CLEAR:
+        if (objc != 2) {
+            Tcl_WrongNumArgs(interp, 2, objv, NULL);
+            return TCL_ERROR;
+        }
+        Tcl_MutexLock(&tbcxTrustMutex);
+        TrustResetLocked();
+        Tcl_MutexUnlock(&tbcxTrustMutex);
+        break;
+    default: /* no subcommand */
+        break;
+    }
+
+    Tcl_MutexLock(&tbcxTrustMutex);
+    Tcl_Size    entries = trustInit ? trustTable.numEntries : 0;
+    Tcl_Size    sized   = entries - (Tcl_Size)atomic_load_explicit(&trustUnsized, memory_order_relaxed);
+    Tcl_WideInt hits    = trustHits;
+    Tcl_MutexUnlock(&tbcxTrustMutex);
+    Tcl_Obj *res = Tcl_NewDictObj();
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("entries", -1), Tcl_NewWideIntObj((Tcl_WideInt)entries));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("sized", -1), Tcl_NewWideIntObj((Tcl_WideInt)sized));
+    Tcl_DictObjPut(NULL, res, Tcl_NewStringObj("hits", -1), Tcl_NewWideIntObj(hits));
+    Tcl_SetObjResult(interp, res);
+    return TCL_OK;
+}
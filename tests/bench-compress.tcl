@@ -0,0 +1,115 @@
+#!/usr/bin/env tclsh
+# ============================================================================
+# bench-compress.tcl
+#
+# Where does tbcx::save -compress start to pay off?  Saves one script raw
+# and compressed, then times tbcx::load from a reflected channel that
+# delivers bytes at a simulated storage bandwidth.  Inflating costs CPU;
+# reading fewer bytes saves I/O time.  The crossover is the bandwidth below
+# which the compressed artifact loads faster.
+#
+#     tclsh bench-compress.tcl ?script.tcl? ?iterations?
+#
+# Without a script, tests/comprehensive.tcl is used.  Not part of the
+# tcltest suite: timings depend on the host.
+# ============================================================================
+
+package require tbcx
+
+set here [file dirname [file normalize [info script]]]
+set src  [expr {[llength $argv] > 0 ? [lindex $argv 0] : [file join $here comprehensive.tcl]}]
+set iter [expr {[llength $argv] > 1 ? [lindex $argv 1] : 20}]
+
+set raw [tbcx::save $src -tobytes]
+set lz  [tbcx::save $src -tobytes -compress]
+
+# Reflected read-only channel over a byte array.  Every read charges
+# bytes/bandwidth seconds to ::ioCost instead of sleeping, so the figures
+# are deterministic and the run stays short.
+namespace eval slowchan {
+    variable data
+    variable pos
+    variable bw
+    proc open {bytes bandwidth} {
+        variable data $bytes
+        variable pos 0
+        variable bw $bandwidth
+        set ch [chan create read [namespace current]::handler]
+        chan configure $ch -translation binary -eofchar {}
+        return $ch
+    }
+    proc handler {cmd ch args} {
+        variable data
+        variable pos
+        variable bw
+        switch -- $cmd {
+            initialize { return {initialize finalize watch read} }
+            finalize   { return }
+            watch      { return }
+            read {
+                set n [lindex $args 0]
+                set chunk [string range $data $pos [expr {$pos + $n - 1}]]
+                incr pos [string length $chunk]
+                set ::ioCost [expr {$::ioCost + [string length $chunk] / double($bw)}]
+                return $chunk
+            }
+        }
+    }
+}
+
+# Median wall-clock microseconds for one load at the given bandwidth
+# (bytes/s), including the simulated I/O cost.
+proc loadCost {blob bandwidth} {
+    set samples {}
+    for {set i 0} {$i < $::iter} {incr i} {
+        set ::ioCost 0.0
+        set ch [slowchan::open $blob $bandwidth]
+        set us [lindex [time {tbcx::load $ch}] 0]
+        close $ch
+        lappend samples [expr {$us + $::ioCost * 1e6}]
+    }
+    return [lindex [lsort -real $samples] [expr {[llength $samples] / 2}]]
+}
+
+# CPU-only cost (no bandwidth charge) of each form, from memory.
+proc cpuCost {blob} {
+    lindex [time {tbcx::loadbytes $blob} $::iter] 0
+}
+
+puts [format "script:      %s" $src]
+puts [format "raw:         %d bytes" [string length $raw]]
+puts [format "compressed:  %d bytes (%.1f%%)" [string length $lz] \
+    [expr {100.0 * [string length $lz] / [string length $raw]}]]
+set cpuRaw [cpuCost $raw]
+set cpuLz  [cpuCost $lz]
+puts [format "in-memory:   raw %.1f us, compressed %.1f us (inflate overhead %.1f us)" \
+    $cpuRaw $cpuLz [expr {$cpuLz - $cpuRaw}]]
+puts ""
+puts [format "%14s %14s %14s   %s" "bandwidth" "raw (us)" "compressed (us)" "winner"]
+
+set crossover {}
+foreach mbps {2000 1000 500 200 100 50 20 10 5 2 1} {
+    set bw [expr {$mbps * 1000000.0}]
+    set r  [loadCost $raw $bw]
+    set c  [loadCost $lz $bw]
+    set winner [expr {$c < $r ? "compressed" : "raw"}]
+    if {$winner eq "compressed" && $crossover eq ""} {
+        set crossover $mbps
+    }
+    puts [format "%11d MB/s %14.1f %14.1f   %s" $mbps $r $c $winner]
+}
+
+# Analytic estimate: compressed wins once the bytes saved take longer to
+# read than the inflate overhead takes to run.
+set saved [expr {[string length $raw] - [string length $lz]}]
+set over  [expr {max($cpuLz - $cpuRaw, 0.001) / 1e6}]
+puts ""
+if {$saved > 0} {
+    puts [format "estimated crossover: %.1f MB/s (compressed wins below)" \
+        [expr {$saved / $over / 1e6}]]
+} else {
+    puts "compression saved no bytes for this script"
+}
+if {$crossover ne ""} {
+    puts "measured: compressed first wins at $crossover MB/s"
+}
@@ -0,0 +1,68 @@
+# -*-Tcl-*-
+# support.tcl — helpers shared by several test files
+#
+# Sourced by the .test files that need them (runAllTests only picks up
+# *.test, so this file is never run on its own).  Each file that sources it
+# calls cleanupSupport before cleanupTests.
+
+# inChild: evaluate script in a fresh interp with tbcx loaded.
+proc inChild {script} {
+    set i [interp create]
+    try {
+        $i eval {package require tbcx}
+        return [$i eval $script]
+    } finally {
+        interp delete $i
+    }
+}
+
+# settled: save script to a file named name and date it an hour back, so the
+# artifact cache will take it.
+proc settled {script name args} {
+    set out [makeFile "" $name]
+    tbcx::save $script $out {*}$args
+    file mtime $out [expr {[clock seconds] - 3600}]
+    return $out
+}
+
+# cacheStat: one figure of [tbcx::cache].
+proc cacheStat {key} {
+    dict get [tbcx::cache] $key
+}
+
+# Tests that splice bytes into an artifact to reach a particular decoder
+# check reseal it first: recompute every directory checksum (CRC32C, last
+# field of each 24-byte entry), or the checksum check reports the damage.
+# The directory follows the 44 fixed header bytes, the source path (its
+# length is the last fixed field) and 20 bytes of flags and counts.
+proc crc32c {data} {
+    set crc 0xFFFFFFFF
+    binary scan $data cu* bytes
+    foreach b $bytes {
+        set crc [expr {$crc ^ $b}]
+        for {set k 0} {$k < 8} {incr k} {
+            set crc [expr {($crc & 1) ? (($crc >> 1) ^ 0x82F63B78) : ($crc >> 1)}]
+        }
+    }
+    expr {$crc ^ 0xFFFFFFFF}
+}
+proc reseal {blob} {
+    binary scan $blob x40iu plen
+    set dir [expr {44 + $plen + 20}]
+    binary scan $blob x[expr {$dir - 4}]iu ns
+    set base [expr {$dir + $ns*24}]
+    for {set i 0} {$i < $ns} {incr i} {
+        set e [expr {$dir + $i*24}]
+        binary scan $blob x[expr {$e + 4}]wuwu off len
+        set from [expr {$base + $off}]
+        set crc [crc32c [string range $blob $from [expr {$from + $len - 1}]]]
+        set blob [string replace $blob [expr {$e + 20}] [expr {$e + 23}] [binary format i $crc]]
+    }
+    return $blob
+}
+
+proc cleanupSupport {} {
+    foreach p {inChild settled cacheStat crc32c reseal cleanupSupport} {
+        rename $p {}
+    }
+}